@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-9-4
- * Update   : 2019-1-7
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -22,11 +22,13 @@
 #include "Engine/Toolkit/Utils/Tween.h"
 #include "Engine/Graphics/Draw/Drawable.h"
 #include "Engine/Extension/Extension.h"
+#include "Engine/Extension/Loader.h"
 #include "Engine/Physics/Physics.h"
 #include "Engine/Physics/PhysicsWorld.h"
 #include "Engine/Toolkit/Utils/Coroutine.h"
 #include "Engine/Toolkit/Platform/Log.h"
-#include "Engine/Toolkit/Utils/Thread.h"
+#include "Engine/Toolkit/Utils/Job.h"
+#include "Engine/Toolkit/Utils/Arena.h"
 
 
 static struct timespec now;
@@ -69,11 +71,15 @@ static void Loop()
     float deltaSeconds = (float) ((now.tv_nsec - last.tv_nsec) * 0.000000001 + (now.tv_sec - last.tv_sec));
     last               =  now;
 
+    // free all memory of last frame
+    AArena->Reset(AArena->frameArena);
+
     APhysicsWorld->Update(deltaSeconds);
     ATween       ->Update(deltaSeconds);
     AScheduler   ->Update(deltaSeconds);
     ACoroutine   ->Update(deltaSeconds);
     AAudio       ->Update(deltaSeconds);
+    ALoader      ->Update(deltaSeconds);
 
     // root update
     AComponent->Update(AApplication->rootComponent, deltaSeconds);
@@ -132,7 +138,7 @@ static void Touch(int fingerID, float pixelX, float pixelY, InputTouchType input
 
 static void Touches(int fingerIDs[], float pixelXs[], float pixelYs[], int touchesCount, InputTouchType inputTouchType)
 {
-    InputTouch* touches[touchesCount];
+    InputTouch** touches = AArena_AllocArr(AArena->frameArena, InputTouch*, touchesCount);
 
     for (int i = 0; i < touchesCount; ++i)
     {
@@ -149,15 +155,15 @@ static void Touches(int fingerIDs[], float pixelXs[], float pixelYs[], int touch
 }
 
 
-void* SaveDataRun(void* param)
+static void SaveDataRun(void* param)
 {
     AApplication->callbacks->OnSaveData(param);
-    return NULL;
 }
 
+
 static void SaveData(void* param)
 {
-    AThread->StartThread(SaveDataRun, param);
+    AJob->Detach(AJob->Run(SaveDataRun, param));
 }
 
 
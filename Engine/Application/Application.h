@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-09-04
- * Update   : 2019-1-25
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -165,7 +165,7 @@ struct AApplication
     /**
      * Callback when application request save persistent data,
      * or can called manually if need to save persistent data,
-     * and this method will start a detached thread to execute ApplicationCallbacks->OnSaveData.
+     * and this method will run ApplicationCallbacks->OnSaveData as a detached Job on worker thread.
      *
      * param: if application request call this method then pass NULL
      */
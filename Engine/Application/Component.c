@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-8-19
- * Update   : 2019-1-27
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -34,7 +34,9 @@ static void Init(Component* outComponent)
     AArrayIntSet->Init(outComponent->observerSet);
     AArrayIntMap->InitWithCapacity(sizeof(ComponentState*), 1, outComponent->stateMap);
 
+    outComponent->stateMap->keyList->increase     = 5;
     outComponent->stateMap->elementList->increase = 5;
+
     outComponent->defaultState = AComponent->AddState(outComponent, ComponentState_Default, NULL, NULL);
     outComponent->curState     = outComponent->defaultState;
     outComponent->preState     = outComponent->defaultState;
@@ -146,32 +148,21 @@ static void RemoveAllChildren(Component* parent)
 }
 
 
-static int Compare(const void* a, const void* b)
-{
-    int keyA = (int) (*(ArrayIntMapElement**) a)->key;
-    int keyB = (int) (*(ArrayIntMapElement**) b)->key;
-    ALog_A(keyA != keyB, "AComponent ReorderAllChildren failed, two child has same order = %d", keyA);
-
-    return keyA - keyB;
-}
-
-
 static void ReorderAllChildren(Component* parent)
 {
     // renew all children key
     for (int i = 0; i < parent->childMap->elementList->size; ++i)
     {
-        ArrayIntMapElement* element = AArrayList_Get(parent->childMap->elementList, i, ArrayIntMapElement*);
-        element->key                = (*(Component**) element->valuePtr)->order;
+        AArrayList_Set
+        (
+            parent->childMap->keyList,
+            i,
+            AArrayIntMap_GetAt(parent->childMap, i, Component*)->order,
+            intptr_t
+        );
     }
 
-    qsort
-    (
-        parent->childMap->elementList->elementArr->data,
-        (size_t) parent->childMap->elementList->size,
-        sizeof(ArrayIntMapElement*),
-        Compare
-    );
+    AArrayIntMap->Reorder(parent->childMap);
 }
 
 
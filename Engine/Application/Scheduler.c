@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2014-1-16
- * Update   : 2019-1-25
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -19,22 +19,18 @@
 #include "Engine/Application/Scheduler.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Toolkit/Utils/ArrayList.h"
+#include "Engine/Toolkit/Utils/Pool.h"
 
 
 static ArrayList(Scheduler*) schedulerRun [1] = AArrayList_Init(Scheduler*, 30);
-static ArrayList(Scheduler*) schedulerList[1] = AArrayList_Init(Scheduler*, 30);
+static Pool     (Scheduler)  schedulerPool[1] = APool_Init     (Scheduler,  30, NULL, NULL);
 
 
 static inline Scheduler* GetScheduler(SchedulerUpdate Update, float intervalTime)
 {
     ALog_A(Update != NULL, "ASchedule GetScheduler Update must not NULL");
 
-    Scheduler* scheduler = AArrayList_Pop(schedulerList, Scheduler*);
-
-    if (scheduler == NULL)
-    {
-        scheduler = malloc(sizeof(Scheduler));
-    }
+    Scheduler* scheduler = APool_Get(schedulerPool, Scheduler);
 
     AUserData_Init(scheduler->userData);
     scheduler->currentTime  = 0.0f;
@@ -80,7 +76,7 @@ static void Update(float deltaSeconds)
             if (scheduler->isCancel)
             {
                 AArrayList->RemoveByLast(schedulerRun, i);
-                AArrayList_Add(schedulerList, scheduler);
+                APool     ->Free        (schedulerPool, scheduler);
             }
             else
             {
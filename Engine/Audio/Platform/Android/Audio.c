@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2017-2-16
- * Update   : 2019-1-7
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -28,7 +28,9 @@
 
 #include "Engine/Toolkit/Utils/ArrayList.h"
 #include "Engine/Toolkit/Utils/ArrayStrSet.h"
+#include "Engine/Toolkit/Utils/Pool.h"
 #include "Engine/Toolkit/Platform/File.h"
+#include "Engine/Toolkit/Utils/Pack.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Audio/Platform/Audio.h"
 
@@ -54,7 +56,7 @@ struct AudioPlayer
 };
 
 
-static ArrayList  (AudioPlayer*) cacheList    [1] = AArrayList_Init (AudioPlayer*, 20);
+static Pool       (AudioPlayer)  playerPool   [1] = APool_Init      (AudioPlayer,  20, NULL, NULL);
 static ArrayList  (AudioPlayer*) destroyList  [1] = AArrayList_Init (AudioPlayer*, 20);
 static ArrayList  (AudioPlayer*) loopList     [1] = AArrayList_Init (AudioPlayer*, 5);
 static ArrayList  (AudioPlayer*) testErrorList[1] = AArrayList_Init (AudioPlayer*, 5);
@@ -95,7 +97,7 @@ static void Update(float deltaSeconds)
         player->seek   = NULL;
         player->object = NULL;
 
-        AArrayList_Add(cacheList, player);
+        APool->Free(playerPool, player);
     }
 
     for (int i = testErrorList->size - 1; i > -1 ; --i)
@@ -111,7 +113,7 @@ static void Update(float deltaSeconds)
             // player callback not called, maybe E/libOpenSLES: Error after prepare: 1
             AArrayList->RemoveByLast(testErrorList, i);
             (*player->object)->Destroy(player->object);
-            AArrayList_Add(cacheList, player);
+            APool->Free(playerPool, player);
 
             ALog_E("AAudio player = %s not callback normal", player->filePath);
         }
@@ -205,9 +207,19 @@ static void PlayerCallback(SLPlayItf caller, void* pContext, SLuint32 event)
 
 static inline void InitPlayer(const char* relativeFilePath, AudioPlayer* player)
 {
-    off_t start;
-    off_t length;
-    int   fd = AFile->OpenFileDescriptor(relativeFilePath, &start, &length);
+    long             start;
+    long             length;
+    int              fd;
+    const PackAsset* asset = APack->Find(relativeFilePath);
+
+    if (asset != NULL)
+    {
+        fd = APack->OpenFileDescriptor(asset, &start, &length);
+    }
+    else
+    {
+        fd = AFile->OpenFileDescriptor(relativeFilePath, &start, &length);
+    }
 
     // configure audio source
     SLDataLocator_AndroidFD locFD     = {SL_DATALOCATOR_ANDROIDFD, fd, start, length};
@@ -358,13 +370,7 @@ static bool IsPlaying(AudioPlayer* player)
 
 static AudioPlayer* GetPlayer(const char* relativeFilePath)
 {
-    AudioPlayer* player = AArrayList_Pop(cacheList, AudioPlayer*);
-
-    if (player == NULL)
-    {
-        player = malloc(sizeof(AudioPlayer));
-    }
-
+    AudioPlayer* player = APool_Get(playerPool, AudioPlayer);
     InitPlayer(relativeFilePath, player);
 
     return player;
@@ -387,7 +393,7 @@ static void Release()
     Destroy(loopList);
     Destroy(testErrorList);
 
-    AArrayList  ->Release(cacheList);
+    APool       ->Release(playerPool);
     AArrayList  ->Release(destroyList);
     AArrayList  ->Release(loopList);
     AArrayList  ->Release(testErrorList);
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+/**
+ * The test tool that checks AJob without engine running:
+ * Wait runs other Jobs while waiting, idle workers steal Jobs from the deque of busy worker,
+ * and ParallelFor runs every index exactly once before return.
+ * it is not a part of engine, and runs on Linux or macOS, best built with -fsanitize=thread once.
+ *
+ * build: cc -std=c99 -O2 -DPLATFORM_TARGET=PLATFORM_IOS -I <Mojoc root> -o JobTest Engine/Build/Tools/JobTest.c
+ *           Engine/Toolkit/Utils/Job.c Engine/Toolkit/Utils/Pool.c Engine/Toolkit/Utils/ArrayList.c -lpthread
+ * usage: JobTest [worker count]
+ *
+ * the worker count is at least 2 for stealing, default 3.
+ * exit 1 when any check failed, a Job that never runs fails by timeout instead of hanging.
+ */
+
+
+// nanosleep in -std=c99
+#define _POSIX_C_SOURCE 199309L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "Engine/Toolkit/Utils/Job.h"
+
+
+#define Check(e, ...)                              \
+    if (!(e))                                      \
+    {                                              \
+        fprintf(stderr, "JobTest " __VA_ARGS__);   \
+        fprintf(stderr, "\n");                     \
+        exit(1);                                   \
+    }
+
+
+/**
+ * The seconds of each test before it fails by timeout.
+ */
+#define TimeoutSeconds 30
+
+
+/**
+ * The count of children Jobs in stealing test.
+ */
+#define ChildCount     64
+
+
+static const char* testName = NULL;
+static pthread_t   mainThread;
+
+
+static void OnTimeout(int signal)
+{
+    (void) signal;
+
+    static const char message[] = "JobTest timeout, a Job never ran\n";
+    write(STDERR_FILENO, message, sizeof(message) - 1);
+    _exit(1);
+}
+
+
+static void BeginTest(const char* name)
+{
+    testName = name;
+    alarm(TimeoutSeconds);
+}
+
+
+static void EndTest()
+{
+    alarm(0);
+    printf("%s ok\n", testName);
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static atomic_int isBlockerStarted;
+static atomic_int isBlockerReleased;
+static pthread_t  helperThread;
+
+
+/**
+ * Keep the only worker busy until Release runs.
+ */
+static void Blocker(void* param)
+{
+    (void) param;
+
+    atomic_store(&isBlockerStarted, 1);
+
+    while (atomic_load(&isBlockerReleased) == 0)
+    {
+        sched_yield();
+    }
+}
+
+
+static void ReleaseBlocker(void* param)
+{
+    (void) param;
+
+    helperThread = pthread_self();
+    atomic_store(&isBlockerReleased, 1);
+}
+
+
+/**
+ * With one worker blocked, Wait of Blocker only returns if the waiting thread runs ReleaseBlocker itself.
+ */
+static void TestWaitHelpRun()
+{
+    BeginTest("Wait help-run");
+
+    Job* blocker = AJob->Run(Blocker, NULL);
+
+    while (atomic_load(&isBlockerStarted) == 0)
+    {
+        sched_yield();
+    }
+
+    // all workers but one are kept busy too, so ReleaseBlocker can only run in Wait
+    int   otherCount = AJob->GetWorkerCount() - 1;
+    Job*  others[otherCount > 0 ? otherCount : 1];
+
+    for (int i = 0; i < otherCount; ++i)
+    {
+        others[i] = AJob->Run(Blocker, NULL);
+    }
+
+    // give the other workers time to take their Blockers
+    nanosleep(&(struct timespec) {0, 100000000}, NULL);
+
+    Job* releaser = AJob->Run(ReleaseBlocker, NULL);
+    AJob->Wait(blocker);
+
+    Check(atomic_load(&isBlockerReleased) == 1, "Wait returned before Blocker completed");
+    Check(AJob->IsComplete(releaser), "Wait returned before ReleaseBlocker completed");
+
+    AJob->Wait(releaser);
+
+    for (int i = 0; i < otherCount; ++i)
+    {
+        AJob->Wait(others[i]);
+    }
+
+    Check(pthread_equal(helperThread, mainThread), "ReleaseBlocker not run by the waiting thread");
+
+    EndTest();
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static atomic_int childDoneCount;
+static atomic_int childOnParentCount;
+static atomic_int isParentStarted;
+static pthread_t  parentThread;
+
+
+static void Child(void* param)
+{
+    (void) param;
+
+    if (pthread_equal(pthread_self(), parentThread))
+    {
+        atomic_fetch_add(&childOnParentCount, 1);
+    }
+
+    atomic_fetch_add(&childDoneCount, 1);
+}
+
+
+/**
+ * Push children into the deque of worker, then spin without Wait, so the children only run if other workers steal them.
+ */
+static void Parent(void* param)
+{
+    Job** children = param;
+    parentThread   = pthread_self();
+    atomic_store(&isParentStarted, 1);
+
+    for (int i = 0; i < ChildCount; ++i)
+    {
+        children[i] = AJob->Run(Child, NULL);
+    }
+
+    while (atomic_load(&childDoneCount) < ChildCount)
+    {
+        sched_yield();
+    }
+}
+
+
+static void TestStealing()
+{
+    BeginTest("work stealing");
+
+    Job* children[ChildCount];
+    Job* parent = AJob->Run(Parent, children);
+
+    // not Wait until a worker takes Parent, or this thread may run it
+    while (atomic_load(&isParentStarted) == 0)
+    {
+        sched_yield();
+    }
+
+    Check(pthread_equal(parentThread, mainThread) == 0, "Parent not run by worker");
+    AJob->Wait(parent);
+
+    for (int i = 0; i < ChildCount; ++i)
+    {
+        AJob->Wait(children[i]);
+    }
+
+    Check(atomic_load(&childDoneCount) == ChildCount, "children done %d", atomic_load(&childDoneCount));
+    Check(atomic_load(&childOnParentCount) == 0, "%d children run by the spinning parent", atomic_load(&childOnParentCount));
+
+    EndTest();
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+typedef struct
+{
+    atomic_int* counterArr;
+    int         count;
+}
+RangeParam;
+
+
+static void CountRange(int fromIndex, int toIndex, void* param)
+{
+    RangeParam* rangeParam = param;
+
+    Check
+    (
+        fromIndex >= 0 && fromIndex < toIndex && toIndex <= rangeParam->count,
+        "ParallelFor range [%d, %d) out of count %d", fromIndex, toIndex, rangeParam->count
+    );
+
+    for (int i = fromIndex; i < toIndex; ++i)
+    {
+        atomic_fetch_add(rangeParam->counterArr + i, 1);
+    }
+}
+
+
+static void RunParallelFor(int count, int batchSize)
+{
+    atomic_int* counterArr = calloc((size_t) count + 1, sizeof(atomic_int));
+    RangeParam  rangeParam = {counterArr, count};
+
+    AJob->ParallelFor(count, batchSize, CountRange, &rangeParam);
+
+    for (int i = 0; i < count; ++i)
+    {
+        Check
+        (
+            atomic_load(counterArr + i) == 1,
+            "ParallelFor count %d batch %d index %d run %d times", count, batchSize, i, atomic_load(counterArr + i)
+        );
+    }
+
+    free(counterArr);
+}
+
+
+static void RunNestedParallelFor(void* param)
+{
+    (void) param;
+
+    RunParallelFor(10007, 16);
+}
+
+
+static void TestParallelFor()
+{
+    BeginTest("ParallelFor");
+
+    static const int counts    [] = {0, 1, 7, 64, 1000, 100003};
+    static const int batchSizes[] = {1, 3, 64, 1000, 200000};
+
+    for (int i = 0; i < (int) (sizeof(counts) / sizeof(int)); ++i)
+    {
+        for (int j = 0; j < (int) (sizeof(batchSizes) / sizeof(int)); ++j)
+        {
+            RunParallelFor(counts[i], batchSizes[j]);
+        }
+    }
+
+    // ParallelFor in worker threads at the same time
+    Job* jobs[8];
+
+    for (int i = 0; i < 8; ++i)
+    {
+        jobs[i] = AJob->Run(RunNestedParallelFor, NULL);
+    }
+
+    for (int i = 0; i < 8; ++i)
+    {
+        AJob->Wait(jobs[i]);
+    }
+
+    EndTest();
+}
+
+
+int main(int argc, char** argv)
+{
+    int workerCount = argc > 1 ? atoi(argv[1]) : 3;
+
+    if (workerCount < 2)
+    {
+        fprintf(stderr, "usage: JobTest [worker count >= 2]\n");
+        return 1;
+    }
+
+    mainThread = pthread_self();
+    signal(SIGALRM, OnTimeout);
+
+    AJob->Init(workerCount);
+
+    TestWaitHelpRun();
+    TestStealing();
+    TestParallelFor();
+
+    AJob->Release();
+
+    return 0;
+}
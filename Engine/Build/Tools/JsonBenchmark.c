@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+/**
+ * The benchmark tool that measures AJsonReader reading json files token by token,
+ * from the whole file in buffer, and from the file streamed by a small buffer.
+ * it is not a part of engine, and runs on Linux or macOS.
+ *
+ * build: cc -std=c99 -O2 -DPLATFORM_TARGET=PLATFORM_IOS -I <Mojoc root> -o JsonBenchmark Engine/Build/Tools/JsonBenchmark.c
+ *           Engine/Toolkit/Utils/JsonReader.c Engine/Toolkit/Utils/ArrayList.c -lm
+ * usage: JsonBenchmark [-n iterations] <json files>
+ *
+ * for example the Spine animations of sample:
+ *     find Samples/SuperLittleRed/Android/app/src/main/assets/Animation -name "*.json" | xargs JsonBenchmark
+ *
+ * -n: the iterations of each file, default 200.
+ *
+ * the buffer time includes copying the file into buffer, because the reader unescapes strings in place.
+ */
+
+
+// clock_gettime in -std=c99
+#define _POSIX_C_SOURCE 199309L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Engine/Toolkit/Utils/JsonReader.h"
+
+
+/**
+ * The buffer length of streamed reading.
+ */
+#define StreamBufferLength 4096
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+/**
+ * The AFile of host that opens file path directly, only the functions used by AJsonReader.
+ */
+static File* Open(const char* resourceFilePath)
+{
+    return (File*) fopen(resourceFilePath, "rb");
+}
+
+
+static void Close(File* file)
+{
+    fclose((FILE*) file);
+}
+
+
+static int Read(File* file, void* buffer, size_t count)
+{
+    return (int) fread(buffer, 1, count, (FILE*) file);
+}
+
+
+struct AFile AFile[1] =
+{{
+    .Open  = Open,
+    .Close = Close,
+    .Read  = Read,
+}};
+
+
+/**
+ * The APack of host that has no pack mounted.
+ */
+static const PackAsset* Find(const char* resourceFilePath)
+{
+    (void) resourceFilePath;
+
+    return NULL;
+}
+
+
+struct APack APack[1] =
+{{
+    .Find = Find,
+}};
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static double GetSeconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+
+/**
+ * Read all tokens, return the count of tokens.
+ */
+static long ReadTokens(JsonReader* reader)
+{
+    long count = 0;
+
+    while (AJsonReader->Next(reader) != JsonToken_End)
+    {
+        ++count;
+    }
+
+    AJsonReader->Release(reader);
+
+    return count;
+}
+
+
+/**
+ * Create the data of file, return NULL if failed.
+ */
+static char* CreateFileData(const char* filePath, long* outLength)
+{
+    FILE* file = fopen(filePath, "rb");
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* data = malloc((size_t) length);
+
+    if (fread(data, 1, (size_t) length, file) != (size_t) length)
+    {
+        free(data);
+        data = NULL;
+    }
+
+    fclose(file);
+    *outLength = length;
+
+    return data;
+}
+
+
+static const char* GetScanName()
+{
+    #if defined(__SSE2__)
+        return "SSE2";
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        return "NEON";
+    #else
+        return "scalar";
+    #endif
+}
+
+
+int main(int argc, char** argv)
+{
+    int iterations = 200;
+    int argIndex   = 1;
+
+    if (argc > 2 && strcmp(argv[1], "-n") == 0)
+    {
+        iterations = atoi(argv[2]);
+        argIndex   = 3;
+    }
+
+    if (argIndex >= argc || iterations < 1)
+    {
+        fprintf(stderr, "usage: JsonBenchmark [-n iterations] <json files>\n");
+        return 1;
+    }
+
+    printf("scan by %s, %d iterations\n", GetScanName(), iterations);
+    printf("%-32s %10s %10s %14s %14s\n", "file", "bytes", "tokens", "buffer MB/s", "stream MB/s");
+
+    long   totalBytes         = 0;
+    double totalBufferSeconds = 0.0;
+    double totalStreamSeconds = 0.0;
+
+    for (; argIndex < argc; ++argIndex)
+    {
+        const char* filePath = argv[argIndex];
+        long        length;
+        char*       data     = CreateFileData(filePath, &length);
+
+        if (data == NULL)
+        {
+            fprintf(stderr, "JsonBenchmark cannot read %s\n", filePath);
+            return 1;
+        }
+
+        char*      buffer = malloc((size_t) length);
+        long       tokens = 0;
+        JsonReader reader[1];
+
+        double startSeconds = GetSeconds();
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            memcpy(buffer, data, (size_t) length);
+            AJsonReader->InitWithBuffer(buffer, (int) length, reader);
+            tokens = ReadTokens(reader);
+        }
+
+        double bufferSeconds = GetSeconds() - startSeconds;
+        startSeconds         = GetSeconds();
+
+        for (int i = 0; i < iterations; ++i)
+        {
+            AJsonReader->InitWithFile(filePath, StreamBufferLength, reader);
+
+            if (ReadTokens(reader) != tokens)
+            {
+                fprintf(stderr, "JsonBenchmark %s streamed tokens differ from buffer\n", filePath);
+                return 1;
+            }
+        }
+
+        double streamSeconds = GetSeconds() - startSeconds;
+        double megabytes     = (double) length * iterations * 1e-6;
+        const char* name     = strrchr(filePath, '/') != NULL ? strrchr(filePath, '/') + 1 : filePath;
+
+        printf
+        (
+            "%-32s %10ld %10ld %14.1f %14.1f\n",
+            name,
+            length,
+            tokens,
+            megabytes / bufferSeconds,
+            megabytes / streamSeconds
+        );
+
+        totalBytes         += length;
+        totalBufferSeconds += bufferSeconds;
+        totalStreamSeconds += streamSeconds;
+
+        free(buffer);
+        free(data);
+    }
+
+    printf
+    (
+        "%-32s %10ld %10s %14.1f %14.1f\n",
+        "total",
+        totalBytes,
+        "",
+        (double) totalBytes * iterations * 1e-6 / totalBufferSeconds,
+        (double) totalBytes * iterations * 1e-6 / totalStreamSeconds
+    );
+
+    return 0;
+}
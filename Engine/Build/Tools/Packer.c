@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+/**
+ * The build tool that packs all files of assets directory into one pack file for APack.
+ * it is not a part of engine, and runs on Linux or macOS.
+ *
+ * build: cc -std=c99 -O2 -I <Mojoc root> -o Packer Engine/Build/Tools/Packer.c Engine/Toolkit/Utils/LZ4.c
+ * usage: Packer [-z] [-x extension]... <assets directory> <output pack file>
+ *
+ * -z: compress files by ALZ4, the file is stored raw if compression saves less than 1/8,
+ *     so the compressed formats (png, mp3, ogg) are always raw that can be mapped or played by fd.
+ *
+ * -x: exclude the files with extension, and the excluded files are still read by AFile.
+ *     for example "-x .mp3" keeps audio files out of pack, which is needed by IOS,
+ *     because IOS audio is always read from NSBundle.
+ */
+
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include "Engine/Toolkit/Utils/Pack.h"
+#include "Engine/Toolkit/Utils/LZ4.h"
+
+
+/**
+ * One file to be packed.
+ */
+typedef struct
+{
+    char*    path;
+    uint32_t hash;
+    uint32_t pathOffset;
+    uint32_t offset;
+    uint32_t length;
+
+    /**
+     * The data stored in pack.
+     */
+    char*    stored;
+    uint32_t storedLength;
+
+    /**
+     * The index of first block end, APack_NoBlock means not compressed.
+     */
+    uint32_t blockIndex;
+}
+PackerFile;
+
+
+static PackerFile*  files         = NULL;
+static int          fileCount     = 0;
+static int          fileCapacity  = 0;
+
+static uint32_t*    blockEnds     = NULL;
+static uint32_t     blockCount    = 0;
+
+static const char** excludeArr    = NULL;
+static int          excludeLength = 0;
+
+
+static int IsExcluded(const char* name)
+{
+    size_t nameLength = strlen(name);
+
+    for (int i = 0; i < excludeLength; ++i)
+    {
+        size_t extLength = strlen(excludeArr[i]);
+
+        if (nameLength >= extLength && strcmp(name + nameLength - extLength, excludeArr[i]) == 0)
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+
+/**
+ * The max length of path, include '\0'.
+ */
+#define PathMax 4096
+
+
+/**
+ * Join dir and name by '/' into outPath, the dir can be empty, exit if the path is longer than PathMax.
+ */
+static void JoinPath(const char* dir, const char* name, char* outPath)
+{
+    int length = dir[0] == '\0' ?
+                 snprintf(outPath, PathMax, "%s", name) :
+                 snprintf(outPath, PathMax, "%s/%s", dir, name);
+
+    if (length < 0 || length >= PathMax)
+    {
+        fprintf(stderr, "Packer path is too long = %s/%s\n", dir, name);
+        exit(1);
+    }
+}
+
+
+/**
+ * Collect the files in rootDir/relativeDir recursively, skip hidden files.
+ */
+static void CollectFiles(const char* rootDir, const char* relativeDir)
+{
+    char dirPath[PathMax];
+    JoinPath(rootDir, relativeDir, dirPath);
+
+    DIR* dir = opendir(dirPath);
+
+    if (dir == NULL)
+    {
+        fprintf(stderr, "Packer cannot open directory = %s\n", dirPath);
+        exit(1);
+    }
+
+    struct dirent* item;
+
+    while ((item = readdir(dir)) != NULL)
+    {
+        if (item->d_name[0] == '.')
+        {
+            continue;
+        }
+
+        char        relativePath[PathMax];
+        char        fullPath    [PathMax];
+        struct stat fileStat;
+
+        JoinPath(relativeDir, item->d_name, relativePath);
+        JoinPath(rootDir,     relativePath, fullPath);
+
+        if (stat(fullPath, &fileStat) != 0)
+        {
+            continue;
+        }
+
+        if (S_ISDIR(fileStat.st_mode))
+        {
+            CollectFiles(rootDir, relativePath);
+        }
+        else if (S_ISREG(fileStat.st_mode) && IsExcluded(item->d_name) == 0)
+        {
+            if (fileCount == fileCapacity)
+            {
+                fileCapacity = fileCapacity == 0 ? 256 : fileCapacity * 2;
+                files        = realloc(files, sizeof(PackerFile) * (size_t) fileCapacity);
+            }
+
+            if ((uint64_t) fileStat.st_size > UINT32_MAX)
+            {
+                fprintf(stderr, "Packer file is too large = %s\n", fullPath);
+                exit(1);
+            }
+
+            PackerFile* file = files + fileCount++;
+            file->path       = strdup(relativePath);
+            file->hash       = APack_GetHash(relativePath);
+            file->length     = (uint32_t) fileStat.st_size;
+        }
+    }
+
+    closedir(dir);
+}
+
+
+static int ComparePath(const void* a, const void* b)
+{
+    return strcmp(((const PackerFile*) a)->path, ((const PackerFile*) b)->path);
+}
+
+
+static int CompareHash(const void* a, const void* b)
+{
+    const PackerFile* fileA = a;
+    const PackerFile* fileB = b;
+
+    if (fileA->hash != fileB->hash)
+    {
+        return fileA->hash < fileB->hash ? -1 : 1;
+    }
+
+    return strcmp(fileA->path, fileB->path);
+}
+
+
+static void WritePadding(FILE* out, uint64_t* position)
+{
+    static const char zeros[APack_DataAlignment] = {0};
+    uint64_t          padding                    = (APack_DataAlignment - *position % APack_DataAlignment) % APack_DataAlignment;
+
+    fwrite(zeros, 1, (size_t) padding, out);
+    *position += padding;
+}
+
+
+/**
+ * Read the file data, and compress it block by block if isCompress.
+ */
+static void LoadFile(const char* assetsDir, PackerFile* file, int isCompress)
+{
+    char fullPath[PathMax];
+    JoinPath(assetsDir, file->path, fullPath);
+
+    FILE* in   = fopen(fullPath, "rb");
+    char* data = malloc((size_t) file->length + 1);
+
+    if (in == NULL || fread(data, 1, file->length, in) != file->length)
+    {
+        fprintf(stderr, "Packer cannot read file = %s\n", fullPath);
+        exit(1);
+    }
+
+    fclose(in);
+
+    file->stored       = data;
+    file->storedLength = file->length;
+    file->blockIndex   = APack_NoBlock;
+
+    if (isCompress == 0 || file->length == 0)
+    {
+        return;
+    }
+
+    uint32_t  count    = (file->length + APack_BlockSize - 1) / APack_BlockSize;
+    uint32_t* ends     = malloc(sizeof(uint32_t) * count);
+    char*     stored   = malloc((size_t) count * (size_t) ALZ4->GetCompressBound(APack_BlockSize));
+    uint32_t  position = 0;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t rawStart  = i * APack_BlockSize;
+        int      rawLength = (int) (file->length - rawStart < APack_BlockSize ? file->length - rawStart : APack_BlockSize);
+        int      size      = ALZ4->Compress(data + rawStart, rawLength, stored + position, rawLength - 1);
+
+        if (size <= 0)
+        {
+            // the block cannot be compressed smaller, store raw
+            memcpy(stored + position, data + rawStart, (size_t) rawLength);
+            size = rawLength;
+        }
+
+        position += (uint32_t) size;
+        ends[i]   = position;
+    }
+
+    if (position > file->length - file->length / 8)
+    {
+        free(ends);
+        free(stored);
+        return;
+    }
+
+    blockEnds = realloc(blockEnds, sizeof(uint32_t) * (blockCount + count));
+    memcpy(blockEnds + blockCount, ends, sizeof(uint32_t) * count);
+
+    free(ends);
+    free(data);
+
+    file->stored       = stored;
+    file->storedLength = position;
+    file->blockIndex   = blockCount;
+    blockCount        += count;
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32_t endian = 1;
+
+    if (*(uint8_t*) &endian != 1)
+    {
+        fprintf(stderr, "Packer only runs on little-endian machine\n");
+        return 1;
+    }
+
+    excludeArr     = malloc(sizeof(char*) * (size_t) argc);
+
+    int argIndex   = 1;
+    int isCompress = 0;
+
+    for (; argIndex < argc && argv[argIndex][0] == '-'; ++argIndex)
+    {
+        if (strcmp(argv[argIndex], "-z") == 0)
+        {
+            isCompress = 1;
+        }
+        else if (strcmp(argv[argIndex], "-x") == 0 && argIndex + 1 < argc)
+        {
+            excludeArr[excludeLength++] = argv[++argIndex];
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (argc - argIndex != 2)
+    {
+        fprintf(stderr, "usage: Packer [-z] [-x extension]... <assets directory> <output pack file>\n");
+        return 1;
+    }
+
+    const char* assetsDir = argv[argIndex];
+    const char* outPath   = argv[argIndex + 1];
+
+    CollectFiles(assetsDir, "");
+
+    // store data in path order, so the files of same directory are close
+    qsort(files, (size_t) fileCount, sizeof(PackerFile), ComparePath);
+
+    uint32_t pathSize     = 0;
+    uint64_t rawSize      = 0;
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        LoadFile(assetsDir, files + i, isCompress);
+
+        files[i].pathOffset = pathSize;
+        pathSize           += (uint32_t) strlen(files[i].path) + 1;
+        rawSize            += files[i].length;
+    }
+
+    uint64_t indexEnd = sizeof(PackHeader)                        +
+                        sizeof(PackEntry) * (uint64_t) fileCount  +
+                        sizeof(uint32_t)  * (uint64_t) blockCount +
+                        pathSize;
+    uint64_t position = indexEnd;
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        position        += (APack_DataAlignment - position % APack_DataAlignment) % APack_DataAlignment;
+
+        if (position + files[i].storedLength > UINT32_MAX)
+        {
+            fprintf(stderr, "Packer pack file is too large, at file = %s\n", files[i].path);
+            return 1;
+        }
+
+        files[i].offset  = (uint32_t) position;
+        position        += files[i].storedLength;
+    }
+
+    FILE* out = fopen(outPath, "wb");
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "Packer cannot create file = %s\n", outPath);
+        return 1;
+    }
+
+    PackHeader header[1] = {{APack_Magic, APack_Version, (uint32_t) fileCount, blockCount, pathSize}};
+    fwrite(header, sizeof(PackHeader), 1, out);
+
+    // the index is sorted by hash for APack binary search
+    PackerFile* sortedFiles = malloc(sizeof(PackerFile) * (size_t) (fileCount + 1));
+    memcpy(sortedFiles, files, sizeof(PackerFile) * (size_t) fileCount);
+    qsort(sortedFiles, (size_t) fileCount, sizeof(PackerFile), CompareHash);
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        PackEntry entry[1] =
+        {{
+            sortedFiles[i].hash,
+            sortedFiles[i].pathOffset,
+            sortedFiles[i].offset,
+            sortedFiles[i].length,
+            sortedFiles[i].storedLength,
+            sortedFiles[i].blockIndex,
+        }};
+
+        fwrite(entry, sizeof(PackEntry), 1, out);
+    }
+
+    fwrite(blockEnds, sizeof(uint32_t), blockCount, out);
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        fwrite(files[i].path, 1, strlen(files[i].path) + 1, out);
+    }
+
+    position = indexEnd;
+
+    for (int i = 0; i < fileCount; ++i)
+    {
+        WritePadding(out, &position);
+        fwrite(files[i].stored, 1, files[i].storedLength, out);
+        position += files[i].storedLength;
+    }
+
+    fclose(out);
+    printf
+    (
+        "Packer packed %d files into %s, %llu bytes from %llu bytes\n",
+        fileCount,
+        outPath,
+        (unsigned long long) position,
+        (unsigned long long) rawSize
+    );
+
+    return 0;
+}
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+/**
+ * The test tool that stresses SPSCQueue and MPMCQueue with threads, and reports the throughput.
+ * it is not a part of engine, and runs on Linux or macOS, best built with -fsanitize=thread once.
+ *
+ * build: cc -std=c99 -O2 -DPLATFORM_TARGET=PLATFORM_IOS -I <Mojoc root> -o QueueTest Engine/Build/Tools/QueueTest.c
+ *           Engine/Toolkit/Utils/SPSCQueue.c Engine/Toolkit/Utils/MPMCQueue.c -lpthread
+ * usage: QueueTest [element count] [producer count] [consumer count]
+ *
+ * SPSC: one producer mixes Push and PushBatch, main thread mixes Pop, PopBatch and Drain, the order is checked.
+ * MPMC: producers push their own increasing values, each consumer checks the order of each producer,
+ *       and all popped values are summed and counted.
+ *
+ * exit 1 when any check failed.
+ */
+
+
+// clock_gettime in -std=c99
+#define _POSIX_C_SOURCE 199309L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#include "Engine/Toolkit/Utils/SPSCQueue.h"
+#include "Engine/Toolkit/Utils/MPMCQueue.h"
+
+
+#define Check(e, ...)                                \
+    if (!(e))                                        \
+    {                                                \
+        fprintf(stderr, "QueueTest " __VA_ARGS__);   \
+        fprintf(stderr, "\n");                       \
+        exit(1);                                     \
+    }
+
+
+/**
+ * The max count of MPMC producers.
+ */
+#define ProducerMax 64
+
+
+static long long       elementCount  = 2000000;
+static int             producerCount = 4;
+static int             consumerCount = 4;
+
+static SPSCQueue       spscQueue[1];
+static MPMCQueue       mpmcQueue[1];
+
+static atomic_llong    poppedSum;
+static atomic_llong    poppedCount;
+
+/**
+ * The next value expected by SPSC consumer.
+ */
+static long long       expectedValue = 0;
+
+
+static double GetSeconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static void* SPSCProduce(void* param)
+{
+    (void) param;
+
+    long long batch[16];
+    long long value = 0;
+
+    while (value < elementCount)
+    {
+        int count = 0;
+
+        for (; count < 16 && value + count < elementCount; ++count)
+        {
+            batch[count] = value + count;
+        }
+
+        // odd rounds push by batch, even rounds push one by one
+        for (int pushed = 0; pushed < count;)
+        {
+            if ((value & 1) == 1)
+            {
+                pushed += ASPSCQueue->PushBatch(spscQueue, batch + pushed, count - pushed);
+            }
+            else if (ASPSCQueue->Push(spscQueue, batch + pushed))
+            {
+                ++pushed;
+            }
+
+            if (pushed < count)
+            {
+                sched_yield();
+            }
+        }
+
+        value += count;
+    }
+
+    return NULL;
+}
+
+
+static void OnSPSCElement(void* elementPtr, void* context)
+{
+    (void) context;
+
+    Check(*(long long*) elementPtr == expectedValue, "SPSC Drain %lld expected %lld", *(long long*) elementPtr, expectedValue);
+    ++expectedValue;
+}
+
+
+static void TestSPSC()
+{
+    ASPSCQueue->Init(sizeof(long long), 1000, spscQueue);
+
+    pthread_t producer;
+    double    startSeconds = GetSeconds();
+    long long batch[64];
+
+    pthread_create(&producer, NULL, SPSCProduce, NULL);
+
+    while (expectedValue < elementCount)
+    {
+        long long lastValue = expectedValue;
+
+        switch (expectedValue % 3)
+        {
+            case 0:
+                ASPSCQueue->Drain(spscQueue, 37, OnSPSCElement, NULL);
+                break;
+
+            case 1:
+            {
+                int count = ASPSCQueue->PopBatch(spscQueue, batch, 64);
+
+                for (int i = 0; i < count; ++i)
+                {
+                    Check(batch[i] == expectedValue, "SPSC PopBatch %lld expected %lld", batch[i], expectedValue);
+                    ++expectedValue;
+                }
+                break;
+            }
+
+            case 2:
+                if (ASPSCQueue->Pop(spscQueue, batch))
+                {
+                    Check(batch[0] == expectedValue, "SPSC Pop %lld expected %lld", batch[0], expectedValue);
+                    ++expectedValue;
+                }
+                break;
+        }
+
+        if (expectedValue == lastValue)
+        {
+            sched_yield();
+        }
+    }
+
+    pthread_join(producer, NULL);
+
+    double seconds = GetSeconds() - startSeconds;
+    Check(ASPSCQueue->GetSize(spscQueue) == 0, "SPSC size %d after all popped", ASPSCQueue->GetSize(spscQueue));
+    printf("SPSC 1 x 1 ok, %.1f M elements/s\n", (double) elementCount / seconds * 1e-6);
+
+    ASPSCQueue->Release(spscQueue);
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+/**
+ * The value is producerIndex * elementCount + sequence, so the producer and order can be found by value.
+ */
+static void* MPMCProduce(void* param)
+{
+    long long base  = (long long) (intptr_t) param * elementCount;
+    long long count = elementCount / producerCount;
+
+    for (long long i = 0; i < count; ++i)
+    {
+        long long value = base + i;
+
+        while (AMPMCQueue->Push(mpmcQueue, &value) == false)
+        {
+            // let consumers run when there are fewer cores than threads
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+static void* MPMCConsume(void* param)
+{
+    (void) param;
+
+    long long lastSequences[ProducerMax];
+    long long total = elementCount / producerCount * producerCount;
+    long long sum   = 0;
+    long long value;
+
+    for (int i = 0; i < producerCount; ++i)
+    {
+        lastSequences[i] = -1;
+    }
+
+    while (atomic_load(&poppedCount) < total)
+    {
+        if (AMPMCQueue->Pop(mpmcQueue, &value))
+        {
+            int       producer = (int) (value / elementCount);
+            long long sequence = value % elementCount;
+
+            Check
+            (
+                producer < producerCount && sequence > lastSequences[producer],
+                "MPMC producer %d popped %lld after %lld", producer, sequence, lastSequences[producer]
+            );
+
+            lastSequences[producer] = sequence;
+            sum                    += value;
+            atomic_fetch_add(&poppedCount, 1);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+
+    atomic_fetch_add(&poppedSum, sum);
+
+    return NULL;
+}
+
+
+static void TestMPMC()
+{
+    AMPMCQueue->Init(sizeof(long long), 1024, mpmcQueue);
+
+    pthread_t producers[ProducerMax];
+    pthread_t consumers[ProducerMax];
+    double    startSeconds = GetSeconds();
+
+    for (int i = 0; i < producerCount; ++i)
+    {
+        pthread_create(producers + i, NULL, MPMCProduce, (void*) (intptr_t) i);
+    }
+
+    for (int i = 0; i < consumerCount; ++i)
+    {
+        pthread_create(consumers + i, NULL, MPMCConsume, NULL);
+    }
+
+    for (int i = 0; i < producerCount; ++i)
+    {
+        pthread_join(producers[i], NULL);
+    }
+
+    for (int i = 0; i < consumerCount; ++i)
+    {
+        pthread_join(consumers[i], NULL);
+    }
+
+    double    seconds = GetSeconds() - startSeconds;
+    long long count   = elementCount / producerCount;
+    long long sum     = 0;
+
+    for (long long p = 0; p < producerCount; ++p)
+    {
+        // sum of p * elementCount + [0, count)
+        sum += p * elementCount * count + count * (count - 1) / 2;
+    }
+
+    Check(atomic_load(&poppedCount) == count * producerCount, "MPMC popped %lld", atomic_load(&poppedCount));
+    Check(atomic_load(&poppedSum)   == sum, "MPMC sum %lld expected %lld", atomic_load(&poppedSum), sum);
+    Check(AMPMCQueue->GetSize(mpmcQueue) == 0, "MPMC size %d after all popped", AMPMCQueue->GetSize(mpmcQueue));
+
+    printf
+    (
+        "MPMC %d x %d ok, %.1f M elements/s\n",
+        producerCount,
+        consumerCount,
+        (double) (count * producerCount) / seconds * 1e-6
+    );
+
+    AMPMCQueue->Release(mpmcQueue);
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        elementCount = atoll(argv[1]);
+    }
+
+    if (argc > 2)
+    {
+        producerCount = atoi(argv[2]);
+    }
+
+    if (argc > 3)
+    {
+        consumerCount = atoi(argv[3]);
+    }
+
+    if
+    (
+        elementCount  < 1 ||
+        producerCount < 1 || producerCount > ProducerMax ||
+        consumerCount < 1 || consumerCount > ProducerMax ||
+        elementCount  < producerCount
+    )
+    {
+        fprintf(stderr, "usage: QueueTest [element count] [producer count 1-64] [consumer count 1-64]\n");
+        return 1;
+    }
+
+    TestSPSC();
+    TestMPMC();
+
+    return 0;
+}
@@ -0,0 +1,1317 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+/**
+ * The build tool that compiles Spine JSON into compiled skeleton file for ASkeletonData->Get,
+ * then the skeleton is loaded from mapped file without parsing JSON.
+ * it is not a part of engine, and runs on little endian Linux or macOS.
+ *
+ * build: cc -std=c99 -O2 -I <Mojoc root> -o SkeletonCompiler Engine/Build/Tools/SkeletonCompiler.c
+ * usage: SkeletonCompiler <input json> <output file>
+ *
+ * the output file can keep the name of JSON, so the code and atlas files need not change,
+ * for example compile the copy of assets directory before Packer:
+ *     find assets/Animation -name "*.json" -exec SkeletonCompiler {} {} \;
+ *
+ * the JSON is checked same as ASkeletonData, so the error exits here instead of at runtime.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#include "Engine/Extension/Spine/SkeletonBinary.h"
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+typedef enum
+{
+    ValueType_Null,
+    ValueType_Bool,
+    ValueType_Number,
+    ValueType_String,
+    ValueType_Array,
+    ValueType_Object,
+}
+ValueType;
+
+
+typedef struct Value Value;
+
+
+/**
+ * The JSON value, the keys of object are kept in order.
+ */
+struct Value
+{
+    ValueType type;
+    bool      boolean;
+    float     number;
+    char*     string;
+    int       length;
+    char**    keys;
+    Value**   items;
+};
+
+
+static const char* json = NULL;
+static Value       nullValue[1];
+
+
+static void Fail(const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+
+    fprintf (stderr, "SkeletonCompiler ");
+    vfprintf(stderr, format, args);
+    fprintf (stderr, "\n");
+
+    va_end(args);
+    exit(1);
+}
+
+
+static void SkipSpace(void)
+{
+    while (*json == ' ' || *json == '\t' || *json == '\n' || *json == '\r')
+    {
+        ++json;
+    }
+}
+
+
+static char* ParseString(void)
+{
+    // the escaped string is never longer than the JSON string
+    const char* end = ++json;
+
+    while (*end != '"')
+    {
+        if (*end == '\0')
+        {
+            Fail("unterminated string");
+        }
+
+        end += *end == '\\' ? 2 : 1;
+    }
+
+    char* string = malloc((size_t) (end - json + 1));
+    char* out    = string;
+
+    while (*json != '"')
+    {
+        if (*json != '\\')
+        {
+            *out++ = *json++;
+            continue;
+        }
+
+        switch (json[1])
+        {
+            case 'n':
+                *out++ = '\n';
+                break;
+
+            case 't':
+                *out++ = '\t';
+                break;
+
+            case 'r':
+                *out++ = '\r';
+                break;
+
+            case 'b':
+                *out++ = '\b';
+                break;
+
+            case 'f':
+                *out++ = '\f';
+                break;
+
+            case 'u':
+            {
+                unsigned int code = 0;
+                sscanf(json + 2, "%4x", &code);
+                json += 4;
+
+                // the names of Spine are mostly ASCII, others are encoded as UTF-8 without surrogate pairs
+                if (code < 0x80)
+                {
+                    *out++ = (char) code;
+                }
+                else if (code < 0x800)
+                {
+                    *out++ = (char) (0xC0 | (code >> 6));
+                    *out++ = (char) (0x80 | (code & 0x3F));
+                }
+                else
+                {
+                    *out++ = (char) (0xE0 | (code >> 12));
+                    *out++ = (char) (0x80 | ((code >> 6) & 0x3F));
+                    *out++ = (char) (0x80 | (code & 0x3F));
+                }
+                break;
+            }
+
+            default:
+                *out++ = json[1];
+                break;
+        }
+
+        json += 2;
+    }
+
+    ++json;
+    *out = '\0';
+
+    return string;
+}
+
+
+static Value* ParseValue(void)
+{
+    SkipSpace();
+
+    Value* value = calloc(1, sizeof(Value));
+
+    switch (*json)
+    {
+        case '{':
+        case '[':
+        {
+            bool isObject = *json == '{';
+            char close    = isObject ? '}' : ']';
+            int  capacity = 0;
+
+            value->type   = isObject ? ValueType_Object : ValueType_Array;
+            ++json;
+            SkipSpace();
+
+            while (*json != close)
+            {
+                if (value->length == capacity)
+                {
+                    capacity     = capacity == 0 ? 8 : capacity * 2;
+                    value->items = realloc(value->items, sizeof(Value*) * capacity);
+                    value->keys  = realloc(value->keys,  sizeof(char*)  * capacity);
+                }
+
+                if (isObject)
+                {
+                    if (*json != '"')
+                    {
+                        Fail("expect object key at: %.20s", json);
+                    }
+
+                    value->keys[value->length] = ParseString();
+                    SkipSpace();
+
+                    if (*json++ != ':')
+                    {
+                        Fail("expect ':' at: %.20s", json - 1);
+                    }
+                }
+
+                value->items[value->length++] = ParseValue();
+                SkipSpace();
+
+                if (*json == ',')
+                {
+                    ++json;
+                    SkipSpace();
+                }
+                else if (*json != close)
+                {
+                    Fail("expect ',' or '%c' at: %.20s", close, json);
+                }
+            }
+
+            ++json;
+            break;
+        }
+
+        case '"':
+            value->type   = ValueType_String;
+            value->string = ParseString();
+            break;
+
+        case 't':
+        case 'f':
+        case 'n':
+            if (strncmp(json, "true", 4) == 0)
+            {
+                value->type    = ValueType_Bool;
+                value->boolean = true;
+                json          += 4;
+            }
+            else if (strncmp(json, "false", 5) == 0)
+            {
+                value->type    = ValueType_Bool;
+                json          += 5;
+            }
+            else if (strncmp(json, "null", 4) == 0)
+            {
+                value->type    = ValueType_Null;
+                json          += 4;
+            }
+            else
+            {
+                Fail("invalid value at: %.20s", json);
+            }
+            break;
+
+        default:
+        {
+            char* end;
+            value->type   = ValueType_Number;
+            value->number = strtof(json, &end);
+
+            if (end == json)
+            {
+                Fail("invalid value at: %.20s", json);
+            }
+
+            json = end;
+            break;
+        }
+    }
+
+    return value;
+}
+
+
+/**
+ * Get value by key of object, not found return NULL.
+ */
+static Value* Get(Value* object, const char* key)
+{
+    if (object->type == ValueType_Object)
+    {
+        for (int i = 0; i < object->length; ++i)
+        {
+            if (strcmp(object->keys[i], key) == 0)
+            {
+                return object->items[i];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+
+static float GetFloat(Value* object, const char* key, float defaultValue)
+{
+    Value* value = Get(object, key);
+    return value != NULL ? value->number : defaultValue;
+}
+
+
+static int GetInt(Value* object, const char* key, int defaultValue)
+{
+    Value* value = Get(object, key);
+    return value != NULL ? (int) value->number : defaultValue;
+}
+
+
+static bool GetBool(Value* object, const char* key, bool defaultValue)
+{
+    Value* value = Get(object, key);
+    return value != NULL ? value->boolean : defaultValue;
+}
+
+
+static const char* GetString(Value* object, const char* key, const char* defaultValue)
+{
+    Value* value = Get(object, key);
+    return value != NULL && value->type == ValueType_String ? value->string : defaultValue;
+}
+
+
+/**
+ * Get array or object by key, not found return empty value.
+ */
+static Value* GetChildren(Value* object, const char* key)
+{
+    Value* value = Get(object, key);
+    return value != NULL ? value : nullValue;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+/**
+ * The growable output buffer.
+ */
+typedef struct
+{
+    char* data;
+    int   length;
+    int   capacity;
+}
+Buffer;
+
+
+static Buffer stringBuffer[1];
+static Buffer bodyBuffer  [1];
+
+
+static void Write(Buffer* buffer, const void* data, int length)
+{
+    if (buffer->length + length > buffer->capacity)
+    {
+        buffer->capacity = (buffer->length + length) * 2;
+        buffer->data     = realloc(buffer->data, (size_t) buffer->capacity);
+    }
+
+    memcpy(buffer->data + buffer->length, data, (size_t) length);
+    buffer->length += length;
+}
+
+
+static void WriteInt(int value)
+{
+    int32_t word = value;
+    Write(bodyBuffer, &word, sizeof(int32_t));
+}
+
+
+static void WriteFloat(float value)
+{
+    Write(bodyBuffer, &value, sizeof(float));
+}
+
+
+/**
+ * Write the string into string table and the offset into body, NULL writes 0.
+ */
+static void WriteString(const char* string)
+{
+    if (string == NULL)
+    {
+        WriteInt(0);
+        return;
+    }
+
+    int length = (int) strlen(string) + 1;
+
+    // reuse the same string
+    for (int i = 0; i <= stringBuffer->length - length; i += (int) strlen(stringBuffer->data + i) + 1)
+    {
+        if (memcmp(stringBuffer->data + i, string, (size_t) length) == 0)
+        {
+            WriteInt((int) sizeof(SkeletonBinaryHeader) + i);
+            return;
+        }
+    }
+
+    WriteInt((int) sizeof(SkeletonBinaryHeader) + stringBuffer->length);
+    Write(stringBuffer, string, length);
+}
+
+
+/**
+ * Write the color string "rrggbbaa" as r, g, b, a.
+ */
+static void WriteColor(const char* color)
+{
+    unsigned int rgba[4] = {255, 255, 255, 255};
+
+    if (color != NULL)
+    {
+        if (sscanf(color, "%2x%2x%2x%2x", rgba, rgba + 1, rgba + 2, rgba + 3) != 4)
+        {
+            Fail("invalid color = %s", color);
+        }
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        WriteFloat(rgba[i] / 255.0f);
+    }
+}
+
+
+static void WriteCurve(Value* frame)
+{
+    Value* curve = Get(frame, "curve");
+
+    if (curve == NULL || curve->type == ValueType_Null)
+    {
+        WriteInt(SkeletonBinaryCurve_Linear);
+        WriteFloat(0.0f);
+        WriteFloat(0.0f);
+        WriteFloat(0.0f);
+        WriteFloat(0.0f);
+    }
+    else if (curve->type == ValueType_Array && curve->length >= 4)
+    {
+        WriteInt(SkeletonBinaryCurve_Bezier);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            WriteFloat(curve->items[i]->number);
+        }
+    }
+    else
+    {
+        bool isStepped = curve->type == ValueType_String && strcmp(curve->string, "stepped") == 0;
+        WriteInt(isStepped ? SkeletonBinaryCurve_Stepped : SkeletonBinaryCurve_None);
+        WriteFloat(0.0f);
+        WriteFloat(0.0f);
+        WriteFloat(0.0f);
+        WriteFloat(0.0f);
+    }
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static Value* root = NULL;
+
+
+/**
+ * The written attachment, index is the order in file.
+ */
+typedef struct
+{
+    int         skinIndex;
+    int         slotIndex;
+    const char* key;
+    int         type;
+}
+Attachment;
+
+
+static Attachment* attachments      = NULL;
+static int         attachmentLength = 0;
+
+
+/**
+ * Find the index of item by "name" in array, not found return -1.
+ */
+static int FindIndex(Value* array, const char* name)
+{
+    for (int i = 0; i < array->length; ++i)
+    {
+        const char* itemName = GetString(array->items[i], "name", NULL);
+
+        if (itemName != NULL && strcmp(itemName, name) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+
+static int FindSlotIndex(const char* slotName)
+{
+    int slotIndex = FindIndex(GetChildren(root, "slots"), slotName);
+
+    if (slotIndex == -1)
+    {
+        Fail("slot not found = %s", slotName);
+    }
+
+    return slotIndex;
+}
+
+
+static void WriteBones(void)
+{
+    Value* bones = GetChildren(root, "bones");
+    WriteInt(bones->length);
+
+    for (int i = 0; i < bones->length; ++i)
+    {
+        Value*      bone        = bones->items[i];
+        const char* parentName  = GetString(bone, "parent", NULL);
+        int         parentIndex = -1;
+
+        if (parentName != NULL)
+        {
+            parentIndex = FindIndex(bones, parentName);
+
+            if (parentIndex == -1 || parentIndex >= i)
+            {
+                Fail("bone parent not found = %s", parentName);
+            }
+        }
+
+        WriteString(GetString(bone, "name", NULL));
+        WriteInt   (parentIndex);
+        WriteFloat (GetFloat(bone, "length",   0.0f));
+        WriteFloat (GetFloat(bone, "x",        0.0f));
+        WriteFloat (GetFloat(bone, "y",        0.0f));
+        WriteFloat (GetFloat(bone, "rotation", 0.0f));
+        WriteFloat (GetFloat(bone, "scaleX",   1.0f));
+        WriteFloat (GetFloat(bone, "scaleY",   1.0f));
+        WriteInt   (GetBool (bone, "inheritScale",    true));
+        WriteInt   (GetBool (bone, "inheritRotation", true));
+    }
+}
+
+
+static void WriteSlots(void)
+{
+    Value* slots = GetChildren(root, "slots");
+    WriteInt(slots->length);
+
+    for (int i = 0; i < slots->length; ++i)
+    {
+        Value*      slot      = slots->items[i];
+        const char* boneName  = GetString(slot, "bone", "");
+        int         boneIndex = FindIndex(GetChildren(root, "bones"), boneName);
+
+        if (boneIndex == -1)
+        {
+            Fail("slot bone not found = %s", boneName);
+        }
+
+        WriteString(GetString(slot, "name",       NULL));
+        WriteString(GetString(slot, "attachment", NULL));
+        WriteInt   (boneIndex);
+        WriteColor (GetString(slot, "color",      NULL));
+        WriteInt   (GetBool  (slot, "additive",   false));
+    }
+}
+
+
+/**
+ * Get the event of root by name, not found or empty return NULL.
+ */
+static Value* GetEvent(const char* name)
+{
+    Value* event = Get(GetChildren(root, "events"), name);
+    return event != NULL && event->length > 0 ? event : NULL;
+}
+
+
+static void WriteEvents(void)
+{
+    Value* events = GetChildren(root, "events");
+    int    count  = 0;
+
+    for (int i = 0; i < events->length; ++i)
+    {
+        count += events->items[i]->length > 0;
+    }
+
+    WriteInt(count);
+
+    for (int i = 0; i < events->length; ++i)
+    {
+        Value* event = events->items[i];
+
+        if (event->length > 0)
+        {
+            WriteString(events->keys[i]);
+            WriteString(GetString(event, "string", ""));
+            WriteInt   (GetInt   (event, "int",    0));
+            WriteFloat (GetFloat (event, "float",  0.0f));
+        }
+    }
+}
+
+
+static void WriteFloats(Value* array, int from, int step)
+{
+    for (int i = from; i < array->length; i += step)
+    {
+        WriteFloat(array->items[i]->number);
+    }
+}
+
+
+/**
+ * Write x, y array as x, y, 0.
+ */
+static void WriteVertices(Value* array)
+{
+    for (int i = 0; i + 1 < array->length; i += 2)
+    {
+        WriteFloat(array->items[i]    ->number);
+        WriteFloat(array->items[i + 1]->number);
+        WriteFloat(0.0f);
+    }
+}
+
+
+static void WriteTriangles(Value* array)
+{
+    for (int i = 0; i < array->length; ++i)
+    {
+        int16_t triangle = (int16_t) array->items[i]->number;
+        Write(bodyBuffer, &triangle, sizeof(int16_t));
+    }
+
+    if (array->length % 2 == 1)
+    {
+        int16_t padding = 0;
+        Write(bodyBuffer, &padding, sizeof(int16_t));
+    }
+}
+
+
+static void WriteAttachment(const char* key, Value* attachment, int skinIndex, int slotIndex)
+{
+    const char* type = GetString(attachment, "type", NULL);
+    int         binaryType;
+
+    if (type == NULL)
+    {
+        binaryType = SkeletonBinaryAttachment_Region;
+    }
+    else if (strcmp(type, "boundingbox") == 0)
+    {
+        binaryType = SkeletonBinaryAttachment_BoundingBox;
+    }
+    else if (strcmp(type, "mesh") == 0)
+    {
+        binaryType = SkeletonBinaryAttachment_Mesh;
+    }
+    else if (strcmp(type, "skinnedmesh") == 0)
+    {
+        binaryType = SkeletonBinaryAttachment_SkinnedMesh;
+    }
+    else
+    {
+        // same as ASkeletonData skips it
+        fprintf(stderr, "SkeletonCompiler skip attachment = %s, type = %s\n", key, type);
+        return;
+    }
+
+    attachments = realloc(attachments, sizeof(Attachment) * (attachmentLength + 1));
+    attachments[attachmentLength++] = (Attachment) {skinIndex, slotIndex, key, binaryType};
+
+    WriteString(key);
+    WriteString(GetString(attachment, "name", key));
+    WriteInt   (binaryType);
+
+    Value* vertices  = GetChildren(attachment, "vertices");
+    Value* uvs       = GetChildren(attachment, "uvs");
+    Value* triangles = GetChildren(attachment, "triangles");
+
+    switch (binaryType)
+    {
+        case SkeletonBinaryAttachment_Region:
+            WriteFloat(GetFloat(attachment, "x",        0.0f));
+            WriteFloat(GetFloat(attachment, "y",        0.0f));
+            WriteFloat(GetFloat(attachment, "rotation", 0.0f));
+            WriteFloat(GetFloat(attachment, "scaleX",   1.0f));
+            WriteFloat(GetFloat(attachment, "scaleY",   1.0f));
+            WriteFloat(GetFloat(attachment, "width",    0.0f));
+            WriteFloat(GetFloat(attachment, "height",   0.0f));
+            break;
+
+        case SkeletonBinaryAttachment_BoundingBox:
+            WriteInt   (vertices->length);
+            WriteFloats(vertices, 0, 1);
+            break;
+
+        case SkeletonBinaryAttachment_Mesh:
+            WriteFloat    (GetFloat(attachment, "width",  0.0f));
+            WriteFloat    (GetFloat(attachment, "height", 0.0f));
+            WriteInt      (vertices->length + (vertices->length >> 1));
+            WriteInt      (uvs->length);
+            WriteInt      (triangles->length);
+            WriteVertices (vertices);
+            WriteFloats   (uvs, 0, 1);
+            WriteTriangles(triangles);
+            break;
+
+        case SkeletonBinaryAttachment_SkinnedMesh:
+        {
+            // one block data is [boneCount, boneIndex, x, y, weight ...]
+            int boneCount         = 0;
+            int weightCount       = 0;
+            int vertexCount       = 0;
+
+            for (int i = 0; i < vertices->length; ++vertexCount)
+            {
+                int count    = (int) vertices->items[i]->number;
+                boneCount   += count + 1;
+                weightCount += count;
+                i           += (count << 2) + 1;
+            }
+
+            WriteFloat(GetFloat(attachment, "width",  0.0f));
+            WriteFloat(GetFloat(attachment, "height", 0.0f));
+            WriteInt  (vertexCount * 3);
+            WriteInt  (weightCount * 3);
+            WriteInt  (boneCount);
+            WriteInt  (weightCount);
+            WriteInt  (uvs->length);
+            WriteInt  (triangles->length);
+
+            for (int i = 0; i < vertexCount * 3; ++i)
+            {
+                WriteFloat(0.0f);
+            }
+
+            for (int i = 0; i < vertices->length;)
+            {
+                int count = (int) vertices->items[i++]->number;
+
+                for (int n = i + count * 4; i < n; i += 4)
+                {
+                    WriteFloat(vertices->items[i + 1]->number);
+                    WriteFloat(vertices->items[i + 2]->number);
+                    WriteFloat(0.0f);
+                }
+            }
+
+            for (int i = 0; i < vertices->length;)
+            {
+                int count = (int) vertices->items[i++]->number;
+                WriteInt(count);
+
+                for (int n = i + count * 4; i < n; i += 4)
+                {
+                    WriteInt((int) vertices->items[i]->number);
+                }
+            }
+
+            for (int i = 0; i < vertices->length;)
+            {
+                int count = (int) vertices->items[i++]->number;
+
+                for (int n = i + count * 4; i < n; i += 4)
+                {
+                    WriteFloat(vertices->items[i + 3]->number);
+                }
+            }
+
+            WriteFloats   (uvs, 0, 1);
+            WriteTriangles(triangles);
+            break;
+        }
+    }
+}
+
+
+static void WriteSkins(void)
+{
+    Value* skins = GetChildren(root, "skins");
+    WriteInt(skins->length);
+
+    for (int i = 0; i < skins->length; ++i)
+    {
+        Value* skinSlots = skins->items[i];
+
+        WriteString(skins->keys[i]);
+        WriteInt   (skinSlots->length);
+
+        for (int j = 0; j < skinSlots->length; ++j)
+        {
+            Value* skinAttachments = skinSlots->items[j];
+            int    slotIndex       = FindSlotIndex(skinSlots->keys[j]);
+            int    countOffset;
+
+            WriteInt(slotIndex);
+
+            // the skipped attachments are not counted
+            countOffset = bodyBuffer->length;
+            WriteInt(0);
+
+            int from = attachmentLength;
+
+            for (int k = 0; k < skinAttachments->length; ++k)
+            {
+                WriteAttachment(skinAttachments->keys[k], skinAttachments->items[k], i, slotIndex);
+            }
+
+            int32_t count = attachmentLength - from;
+            memcpy(bodyBuffer->data + countOffset, &count, sizeof(int32_t));
+        }
+    }
+}
+
+
+/**
+ * Write the frame times and return the last time.
+ */
+static float WriteTimes(Value* frames)
+{
+    float time = 0.0f;
+
+    for (int i = 0; i < frames->length; ++i)
+    {
+        time = GetFloat(frames->items[i], "time", 0.0f);
+        WriteFloat(time);
+    }
+
+    return time;
+}
+
+
+static void WriteCurves(Value* frames)
+{
+    for (int i = 0; i < frames->length; ++i)
+    {
+        WriteCurve(frames->items[i]);
+    }
+}
+
+
+/**
+ * Write timelines of animation and return the duration.
+ */
+static float WriteTimelines(Value* animation, int* outTimelineCount)
+{
+    float  duration  = 0.0f;
+    int    count     = 0;
+    Value* bones     = GetChildren(animation, "bones");
+    Value* slots     = GetChildren(animation, "slots");
+    Value* events    = Get        (animation, "events");
+    Value* drawOrder = Get        (animation, "drawOrder");
+    Value* deform    = GetChildren(animation, "deform");
+
+    for (int i = 0; i < bones->length; ++i)
+    {
+        int boneIndex = FindIndex(GetChildren(root, "bones"), bones->keys[i]);
+
+        if (boneIndex == -1)
+        {
+            Fail("animation bone not found = %s", bones->keys[i]);
+        }
+
+        for (int j = 0; j < bones->items[i]->length; ++j)
+        {
+            const char* type   = bones->items[i]->keys [j];
+            Value*      frames = bones->items[i]->items[j];
+            int         binaryType;
+
+            if (strcmp(type, "rotate") == 0)
+            {
+                binaryType = SkeletonBinaryTimeline_Rotate;
+            }
+            else if (strcmp(type, "translate") == 0)
+            {
+                binaryType = SkeletonBinaryTimeline_Translate;
+            }
+            else if (strcmp(type, "scale") == 0)
+            {
+                binaryType = SkeletonBinaryTimeline_Scale;
+            }
+            else
+            {
+                Fail("invalid timeline type for a bone: %s", type);
+            }
+
+            WriteInt(binaryType);
+            WriteInt(boneIndex);
+            WriteInt(frames->length);
+
+            for (int k = 0; k < frames->length; ++k)
+            {
+                Value* frame = frames->items[k];
+                WriteFloat(GetFloat(frame, "time", 0.0f));
+
+                if (binaryType == SkeletonBinaryTimeline_Rotate)
+                {
+                    WriteFloat(GetFloat(frame, "angle", 0.0f));
+                }
+                else
+                {
+                    WriteFloat(GetFloat(frame, "x", 0.0f));
+                    WriteFloat(GetFloat(frame, "y", 0.0f));
+                }
+            }
+
+            WriteCurves(frames);
+
+            if (frames->length > 0)
+            {
+                float time = GetFloat(frames->items[frames->length - 1], "time", 0.0f);
+                duration   = time > duration ? time : duration;
+            }
+
+            ++count;
+        }
+    }
+
+    for (int i = 0; i < slots->length; ++i)
+    {
+        int slotIndex = FindSlotIndex(slots->keys[i]);
+
+        for (int j = 0; j < slots->items[i]->length; ++j)
+        {
+            const char* type   = slots->items[i]->keys [j];
+            Value*      frames = slots->items[i]->items[j];
+            float       time;
+
+            if (strcmp(type, "color") == 0)
+            {
+                WriteInt(SkeletonBinaryTimeline_Color);
+                WriteInt(slotIndex);
+                WriteInt(frames->length);
+
+                for (int k = 0; k < frames->length; ++k)
+                {
+                    const char* color = GetString(frames->items[k], "color", NULL);
+
+                    if (color == NULL)
+                    {
+                        Fail("color timeline has no color, slot = %s", slots->keys[i]);
+                    }
+
+                    WriteFloat(GetFloat(frames->items[k], "time", 0.0f));
+                    WriteColor(color);
+                }
+
+                WriteCurves(frames);
+                time = frames->length > 0 ? GetFloat(frames->items[frames->length - 1], "time", 0.0f) : 0.0f;
+            }
+            else if (strcmp(type, "attachment") == 0)
+            {
+                WriteInt(SkeletonBinaryTimeline_Attachment);
+                WriteInt(slotIndex);
+                WriteInt(frames->length);
+
+                time = WriteTimes(frames);
+
+                for (int k = 0; k < frames->length; ++k)
+                {
+                    WriteString(GetString(frames->items[k], "name", NULL));
+                }
+            }
+            else
+            {
+                Fail("invalid timeline type for a slot: %s", type);
+            }
+
+            duration = time > duration ? time : duration;
+            ++count;
+        }
+    }
+
+    if (events != NULL)
+    {
+        WriteInt(SkeletonBinaryTimeline_Event);
+        WriteInt(events->length);
+
+        float time = WriteTimes(events);
+        duration   = time > duration ? time : duration;
+
+        for (int i = 0; i < events->length; ++i)
+        {
+            Value*      frame       = events->items[i];
+            const char* name        = GetString(frame, "name", "");
+            Value*      event       = GetEvent(name);
+            const char* stringValue = "";
+            int         intValue    = 0;
+            float       floatValue  = 0.0f;
+
+            if (event != NULL)
+            {
+                stringValue = GetString(event, "string", "");
+                intValue    = GetInt   (event, "int",    0);
+                floatValue  = GetFloat (event, "float",  0.0f);
+            }
+
+            WriteString(name);
+            WriteString(GetString(frame, "string", stringValue));
+            WriteInt   (GetInt   (frame, "int",    intValue));
+            WriteFloat (GetFloat (frame, "float",  floatValue));
+        }
+
+        ++count;
+    }
+
+    if (drawOrder != NULL)
+    {
+        int slotCount = GetChildren(root, "slots")->length;
+        int drawOrders[slotCount];
+        int unchanged [slotCount];
+
+        WriteInt(SkeletonBinaryTimeline_DrawOrder);
+        WriteInt(drawOrder->length);
+
+        float time = WriteTimes(drawOrder);
+        duration   = time > duration ? time : duration;
+
+        for (int i = 0; i < drawOrder->length; ++i)
+        {
+            Value* offsets = Get(drawOrder->items[i], "offsets");
+
+            if (offsets == NULL)
+            {
+                fprintf(stderr, "SkeletonCompiler drawOrder offsets not found\n");
+                WriteInt(false);
+                continue;
+            }
+
+            // same as ASkeletonData, the unchanged slots are filled in the remaining places by order
+            int originalIndex  = 0;
+            int unchangedIndex = 0;
+
+            for (int j = 0; j < slotCount; ++j)
+            {
+                drawOrders[j] = -1;
+            }
+
+            for (int j = 0; j < offsets->length; ++j)
+            {
+                int slotIndex = FindSlotIndex(GetString(offsets->items[j], "slot", ""));
+                int newIndex  = slotIndex + GetInt(offsets->items[j], "offset", 0);
+
+                if (slotIndex < originalIndex || newIndex < 0 || newIndex >= slotCount)
+                {
+                    Fail("invalid drawOrder offset of slot index = %d", slotIndex);
+                }
+
+                while (originalIndex != slotIndex)
+                {
+                    unchanged[unchangedIndex++] = originalIndex++;
+                }
+
+                drawOrders[newIndex] = originalIndex++;
+            }
+
+            while (originalIndex < slotCount)
+            {
+                unchanged[unchangedIndex++] = originalIndex++;
+            }
+
+            for (int j = slotCount - 1; j > -1; --j)
+            {
+                if (drawOrders[j] == -1)
+                {
+                    drawOrders[j] = unchanged[--unchangedIndex];
+                }
+            }
+
+            WriteInt(true);
+
+            for (int j = 0; j < slotCount; ++j)
+            {
+                WriteInt(drawOrders[j]);
+            }
+        }
+
+        ++count;
+    }
+
+    for (int i = 0; i < deform->length; ++i)
+    {
+        int skinIndex = -1;
+
+        for (int j = 0; j < GetChildren(root, "skins")->length; ++j)
+        {
+            if (strcmp(GetChildren(root, "skins")->keys[j], deform->keys[i]) == 0)
+            {
+                skinIndex = j;
+                break;
+            }
+        }
+
+        if (skinIndex == -1)
+        {
+            Fail("deform skin not found = %s", deform->keys[i]);
+        }
+
+        Value* deformSlots = deform->items[i];
+
+        for (int j = 0; j < deformSlots->length; ++j)
+        {
+            int    slotIndex = FindSlotIndex(deformSlots->keys[j]);
+            Value* meshes    = deformSlots->items[j];
+
+            for (int k = 0; k < meshes->length; ++k)
+            {
+                Value* frames          = meshes->items[k];
+                int    attachmentIndex = -1;
+
+                for (int l = 0; l < attachmentLength; ++l)
+                {
+                    Attachment* attachment = attachments + l;
+
+                    if
+                    (
+                        attachment->skinIndex == skinIndex &&
+                        attachment->slotIndex == slotIndex &&
+                        strcmp(attachment->key, meshes->keys[k]) == 0
+                    )
+                    {
+                        attachmentIndex = l;
+                        break;
+                    }
+                }
+
+                if
+                (
+                    attachmentIndex == -1                                                 ||
+                    attachments[attachmentIndex].type == SkeletonBinaryAttachment_Region ||
+                    attachments[attachmentIndex].type == SkeletonBinaryAttachment_BoundingBox
+                )
+                {
+                    Fail("deform mesh not found = %s, slot = %s", meshes->keys[k], deformSlots->keys[j]);
+                }
+
+                WriteInt(SkeletonBinaryTimeline_Deform);
+                WriteInt(slotIndex);
+                WriteInt(attachmentIndex);
+                WriteInt(frames->length);
+
+                float time = WriteTimes(frames);
+                duration   = time > duration ? time : duration;
+
+                WriteCurves(frames);
+
+                for (int l = 0; l < frames->length; ++l)
+                {
+                    Value* vertices = GetChildren(frames->items[l], "vertices");
+
+                    WriteInt   (GetInt(frames->items[l], "offset", 0));
+                    WriteInt   (vertices->length);
+                    WriteFloats(vertices, 0, 1);
+                }
+
+                ++count;
+            }
+        }
+    }
+
+    *outTimelineCount = count;
+
+    return duration;
+}
+
+
+static void WriteAnimations(void)
+{
+    Value* animations = Get(root, "animations");
+
+    if (animations == NULL)
+    {
+        Fail("animations not found");
+    }
+
+    WriteInt(animations->length);
+
+    for (int i = 0; i < animations->length; ++i)
+    {
+        WriteString(animations->keys[i]);
+
+        // duration and timelineCount are known after timelines
+        int offset = bodyBuffer->length;
+        WriteFloat(0.0f);
+        WriteInt  (0);
+
+        int     timelineCount;
+        float   duration = WriteTimelines(animations->items[i], &timelineCount);
+        int32_t count    = timelineCount;
+
+        memcpy(bodyBuffer->data + offset,                   &duration, sizeof(float));
+        memcpy(bodyBuffer->data + offset + sizeof(float),   &count,    sizeof(int32_t));
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: SkeletonCompiler <input json> <output file>\n");
+        return 1;
+    }
+
+    FILE* in = fopen(argv[1], "rb");
+
+    if (in == NULL)
+    {
+        Fail("cannot open %s", argv[1]);
+    }
+
+    fseek(in, 0, SEEK_END);
+    long  length = ftell(in);
+    char* data   = malloc((size_t) length + 1);
+    fseek(in, 0, SEEK_SET);
+
+    if (fread(data, 1, (size_t) length, in) != (size_t) length)
+    {
+        Fail("cannot read %s", argv[1]);
+    }
+
+    fclose(in);
+    data[length] = '\0';
+
+    if (length >= (long) sizeof(SkeletonBinaryHeader) && memcmp(data, ASkeletonBinary_Magic, 4) == 0)
+    {
+        Fail("%s is already compiled", argv[1]);
+    }
+
+    json = data;
+    root = ParseValue();
+
+    if (root->type != ValueType_Object)
+    {
+        Fail("%s is not JSON object", argv[1]);
+    }
+
+    Value* skeleton = GetChildren(root, "skeleton");
+    WriteFloat(GetFloat(skeleton, "width",  0.0f));
+    WriteFloat(GetFloat(skeleton, "height", 0.0f));
+
+    WriteBones     ();
+    WriteSlots     ();
+    WriteEvents    ();
+    WriteSkins     ();
+    WriteAnimations();
+
+    // the body is aligned by 4 bytes
+    while (stringBuffer->length % 4 != 0)
+    {
+        Write(stringBuffer, "", 1);
+    }
+
+    SkeletonBinaryHeader header[1];
+    memcpy(header->magic, ASkeletonBinary_Magic, sizeof(header->magic));
+    header->version    = ASkeletonBinary_Version;
+    header->bodyOffset = (uint32_t) (sizeof(SkeletonBinaryHeader) + stringBuffer->length);
+    header->length     = header->bodyOffset + (uint32_t) bodyBuffer->length;
+
+    // the input can be the output
+    FILE* out = fopen(argv[2], "wb");
+
+    if (out == NULL)
+    {
+        Fail("cannot write %s", argv[2]);
+    }
+
+    fwrite(header,             sizeof(SkeletonBinaryHeader), 1, out);
+    fwrite(stringBuffer->data, 1, (size_t) stringBuffer->length, out);
+    fwrite(bodyBuffer->data,   1, (size_t) bodyBuffer->length,   out);
+    fclose(out);
+
+    printf
+    (
+        "SkeletonCompiler %s: json %ld bytes, compiled %u bytes, %d attachments\n",
+        argv[1], length, header->length, attachmentLength
+    );
+
+    return 0;
+}
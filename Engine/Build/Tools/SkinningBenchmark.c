@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+/**
+ * The benchmark tool that measures ASkeletonSkinning_SkinPositions skinning the meshes of Spine json files,
+ * and checks the positions against the scalar skinning.
+ * it is not a part of engine, and runs on Linux or macOS.
+ *
+ * build: cc -std=c99 -O2 -DPLATFORM_TARGET=PLATFORM_IOS -I <Mojoc root> -o SkinningBenchmark
+ *           Engine/Build/Tools/SkinningBenchmark.c Engine/Toolkit/Utils/Json.c Engine/Toolkit/Utils/JsonReader.c
+ *           Engine/Toolkit/Utils/FileTool.c Engine/Toolkit/Utils/Arena.c Engine/Toolkit/Utils/HashStrMap.c
+ *           Engine/Toolkit/Utils/ArrayList.c -lm
+ * usage: SkinningBenchmark [-n iterations] [-w weights] <json files>
+ *
+ * for example the Spine animations of sample:
+ *     SkinningBenchmark Samples/SuperLittleRed/Android/app/src/main/assets/Animation/redgirl.json
+ *                       Samples/SuperLittleRed/Android/app/src/main/assets/UI/Curtain.json
+ *
+ * -n: the iterations of each mesh, default 20000.
+ * -w: the max weights of each vertex of the unweighted meshes, default 2.
+ *
+ * the weighted meshes ("skinnedmesh" and the "mesh" that has bone weights) are skinned by their weights,
+ * and the vertices of unweighted meshes are bound to the slot bone and its ancestors by equal weights,
+ * the bone affines are made from the bone index, because the values of affines not affect the time.
+ */
+
+
+// clock_gettime in -std=c99
+#define _POSIX_C_SOURCE 199309L
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "Engine/Toolkit/Utils/Json.h"
+#include "Engine/Toolkit/Utils/Pack.h"
+#include "Engine/Extension/Spine/SkeletonSkinning.h"
+
+
+#define Check(e, ...)                     \
+    if (!(e))                             \
+    {                                     \
+        fprintf(stderr, __VA_ARGS__);     \
+        fprintf(stderr, "\n");            \
+        exit(1);                          \
+    }
+
+
+/**
+ * The max relative difference between kernel and scalar positions.
+ */
+#define MaxDifference 1e-4
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+/**
+ * The AFile of host, AJson->Parse not reads file.
+ */
+struct AFile AFile[1];
+
+
+/**
+ * The APack of host that has no pack mounted.
+ */
+static const PackAsset* Find(const char* resourceFilePath)
+{
+    (void) resourceFilePath;
+
+    return NULL;
+}
+
+
+struct APack APack[1] =
+{{
+    .Find = Find,
+}};
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+/**
+ * The skinning data of one mesh, same as SkeletonSkinnedMeshAttachmentData.
+ */
+typedef struct
+{
+    int*   bones;
+    int    boneLength;
+    float* weights;
+    int    weightCount;
+    float* weightVertices;
+    int    vertexCount;
+}
+SkinMesh;
+
+
+static double GetSeconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+
+/**
+ * Create the string of file, return NULL if failed.
+ */
+static char* CreateFileString(const char* filePath)
+{
+    FILE* file = fopen(filePath, "rb");
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long  length = ftell(file);
+    char* string = malloc((size_t) length + 1);
+    fseek(file, 0, SEEK_SET);
+
+    Check(fread(string, 1, (size_t) length, file) == (size_t) length, "Read file %s failed", filePath);
+    fclose(file);
+    string[length] = '\0';
+
+    return string;
+}
+
+
+/**
+ * Get the index of bone name in bones, return -1 if not found.
+ */
+static int GetBoneIndex(JsonArray* boneArr, const char* boneName)
+{
+    for (int i = 0; i < boneArr->valueArr->length; ++i)
+    {
+        if (strcmp(AJsonObject->GetString(AJsonArray->GetObject(boneArr, i), "name", ""), boneName) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+
+/**
+ * Init skinMesh by the weighted vertices, each vertex is [boneCount, boneIndex, x, y, weight ...].
+ */
+static void InitWeighted(JsonArray* jsonVertexArr, SkinMesh* skinMesh)
+{
+    int length = jsonVertexArr->valueArr->length;
+
+    skinMesh->bones          = malloc(sizeof(int)   * length);
+    skinMesh->weights        = malloc(sizeof(float) * length);
+    skinMesh->weightVertices = malloc(sizeof(float) * length * 3);
+    skinMesh->boneLength     = 0;
+    skinMesh->weightCount    = 0;
+    skinMesh->vertexCount    = 0;
+
+    for (int i = 0; i < length; ++skinMesh->vertexCount)
+    {
+        int boneCount = AJsonArray->GetInt(jsonVertexArr, i++);
+
+        skinMesh->bones[skinMesh->boneLength++] = boneCount;
+
+        for (int j = 0; j < boneCount; ++j, i += 4)
+        {
+            float* weightVertex = skinMesh->weightVertices + skinMesh->weightCount * 3;
+
+            skinMesh->bones[skinMesh->boneLength++]    = AJsonArray->GetInt  (jsonVertexArr, i);
+            weightVertex[0]                            = AJsonArray->GetFloat(jsonVertexArr, i + 1);
+            weightVertex[1]                            = AJsonArray->GetFloat(jsonVertexArr, i + 2);
+            weightVertex[2]                            = 0.0f;
+            skinMesh->weights[skinMesh->weightCount++] = AJsonArray->GetFloat(jsonVertexArr, i + 3);
+        }
+    }
+}
+
+
+/**
+ * Init skinMesh by the unweighted vertices [x, y ...],
+ * each vertex is bound to the slotBoneIndex and its ancestors, max maxWeights bones by equal weights.
+ */
+static void InitUnweighted
+(
+    JsonArray* jsonVertexArr,
+    int*       boneParents,
+    int        slotBoneIndex,
+    int        maxWeights,
+    SkinMesh*  skinMesh
+)
+{
+    int boneCount = 1;
+
+    for (int i = boneParents[slotBoneIndex]; i != -1 && boneCount < maxWeights; i = boneParents[i])
+    {
+        ++boneCount;
+    }
+
+    skinMesh->vertexCount    = jsonVertexArr->valueArr->length >> 1;
+    skinMesh->boneLength     = skinMesh->vertexCount * (boneCount + 1);
+    skinMesh->weightCount    = skinMesh->vertexCount * boneCount;
+    skinMesh->bones          = malloc(sizeof(int)   * skinMesh->boneLength);
+    skinMesh->weights        = malloc(sizeof(float) * skinMesh->weightCount);
+    skinMesh->weightVertices = malloc(sizeof(float) * skinMesh->weightCount * 3);
+
+    for (int i = 0, b = 0, w = 0; i < skinMesh->vertexCount; ++i)
+    {
+        skinMesh->bones[b++] = boneCount;
+
+        for (int j = 0, boneIndex = slotBoneIndex; j < boneCount; ++j, ++w, boneIndex = boneParents[boneIndex])
+        {
+            skinMesh->bones[b++]                = boneIndex;
+            skinMesh->weights[w]                = 1.0f / boneCount;
+            skinMesh->weightVertices[w * 3]     = AJsonArray->GetFloat(jsonVertexArr, i << 1);
+            skinMesh->weightVertices[w * 3 + 1] = AJsonArray->GetFloat(jsonVertexArr, (i << 1) + 1);
+            skinMesh->weightVertices[w * 3 + 2] = 0.0f;
+        }
+    }
+}
+
+
+/**
+ * The scalar linear blend skinning, as the reference of kernel.
+ */
+static void SkinPositionsScalar(SkinMesh* skinMesh, const float* affines, float* positions)
+{
+    for (int i = 0, w = 0, p = 0; i < skinMesh->boneLength; p += 3)
+    {
+        int   k  = skinMesh->bones[i] + i + 1;
+        float wx = 0.0f;
+        float wy = 0.0f;
+
+        for (++i; i < k; ++i, ++w)
+        {
+            const float* affine = affines + skinMesh->bones[i] * SkeletonSkinning_AffineSize;
+            const float* vertex = skinMesh->weightVertices + w * 3;
+
+            wx += (affine[0] * vertex[0] + affine[2] * vertex[1] + affine[4]) * skinMesh->weights[w];
+            wy += (affine[1] * vertex[0] + affine[3] * vertex[1] + affine[5]) * skinMesh->weights[w];
+        }
+
+        positions[p]     = wx;
+        positions[p + 1] = wy;
+    }
+}
+
+
+/**
+ * Skin the skinMesh by scalar and kernel, check the difference and print the time.
+ */
+static void BenchmarkMesh(const char* name, SkinMesh* skinMesh, const float* affines, int iterations)
+{
+    float* scalarPositions = calloc((size_t) skinMesh->vertexCount * 3, sizeof(float));
+    float* kernelPositions = calloc((size_t) skinMesh->vertexCount * 3, sizeof(float));
+    double maxDifference   = 0.0;
+
+    SkinPositionsScalar(skinMesh, affines, scalarPositions);
+
+    ASkeletonSkinning_SkinPositions
+    (
+        skinMesh->bones,
+        skinMesh->boneLength,
+        skinMesh->weights,
+        skinMesh->weightVertices,
+        affines,
+        kernelPositions
+    );
+
+    for (int i = 0; i < skinMesh->vertexCount * 3; ++i)
+    {
+        double difference = fabs(scalarPositions[i] - kernelPositions[i]) / (1.0 + fabs(scalarPositions[i]));
+
+        if (difference > maxDifference)
+        {
+            maxDifference = difference;
+        }
+    }
+
+    Check
+    (
+        maxDifference < MaxDifference,
+        "%s: the kernel positions differ from scalar by %g",
+        name,
+        maxDifference
+    );
+
+    double start = GetSeconds();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        SkinPositionsScalar(skinMesh, affines, scalarPositions);
+    }
+
+    double scalarSeconds = GetSeconds() - start;
+    start                = GetSeconds();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        ASkeletonSkinning_SkinPositions
+        (
+            skinMesh->bones,
+            skinMesh->boneLength,
+            skinMesh->weights,
+            skinMesh->weightVertices,
+            affines,
+            kernelPositions
+        );
+    }
+
+    double kernelSeconds = GetSeconds() - start;
+
+    // use the positions, so the loops are not optimized out
+    Check(scalarPositions[0] == scalarPositions[0] && kernelPositions[0] == kernelPositions[0], "%s: NaN", name);
+
+    printf
+    (
+        "    %-52s vertices %4d weights %4d  scalar %8.1f ns  kernel %8.1f ns  %.2fx  diff %.1e\n",
+        name,
+        skinMesh->vertexCount,
+        skinMesh->weightCount,
+        scalarSeconds * 1e9 / iterations,
+        kernelSeconds * 1e9 / iterations,
+        scalarSeconds / kernelSeconds,
+        maxDifference
+    );
+
+    free(scalarPositions);
+    free(kernelPositions);
+}
+
+
+/**
+ * Benchmark all mesh attachments of Spine json file, return the count of meshes.
+ */
+static int BenchmarkFile(const char* filePath, int iterations, int maxWeights)
+{
+    char* jsonString = CreateFileString(filePath);
+    Check(jsonString != NULL, "Cannot open file %s", filePath);
+
+    JsonValue*  value   = AJson->Parse(jsonString);
+    JsonObject* root    = value->jsonObject;
+    JsonArray*  boneArr = AJsonObject->GetArray(root, "bones");
+    JsonArray*  slotArr = AJsonObject->GetArray(root, "slots");
+    JsonObject* skinMap = AJsonObject->GetObject(root, "skins");
+    int         count   = 0;
+
+    Check(boneArr != NULL && slotArr != NULL && skinMap != NULL, "%s is not a Spine json file", filePath);
+
+    int    boneCount   = boneArr->valueArr->length;
+    int*   boneParents = malloc(sizeof(int)   * boneCount);
+    float* affines     = malloc(sizeof(float) * boneCount * SkeletonSkinning_AffineSize);
+
+    for (int i = 0; i < boneCount; ++i)
+    {
+        float* affine  = affines + i * SkeletonSkinning_AffineSize;
+        float  radians = 0.1f * (float) i;
+        float  scale   = 1.0f + 0.01f * (float) i;
+
+        boneParents[i] = GetBoneIndex(boneArr, AJsonObject->GetString(AJsonArray->GetObject(boneArr, i), "parent", ""));
+        affine[0]      = cosf(radians) * scale;
+        affine[1]      = sinf(radians) * scale;
+        affine[2]      = -affine[1];
+        affine[3]      = affine[0];
+        affine[4]      = (float) i;
+        affine[5]      = (float) -i;
+    }
+
+    printf("%s: bones %d\n", filePath, boneCount);
+
+    for (int i = 0; i < skinMap->pairArr->length; ++i)
+    {
+        JsonObject* slotMap = AJsonObject->GetObjectByIndex(skinMap, i);
+
+        for (int j = 0; j < slotMap->pairArr->length; ++j)
+        {
+            const char* slotName      = AJsonObject->GetKey(slotMap, j);
+            JsonObject* attachmentMap = AJsonObject->GetObjectByIndex(slotMap, j);
+            int         slotBoneIndex = -1;
+
+            for (int k = 0; k < slotArr->valueArr->length; ++k)
+            {
+                JsonObject* slotObject = AJsonArray->GetObject(slotArr, k);
+
+                if (strcmp(AJsonObject->GetString(slotObject, "name", ""), slotName) == 0)
+                {
+                    slotBoneIndex = GetBoneIndex(boneArr, AJsonObject->GetString(slotObject, "bone", ""));
+                    break;
+                }
+            }
+
+            Check(slotBoneIndex != -1, "%s: the bone of slot %s not found", filePath, slotName);
+
+            for (int k = 0; k < attachmentMap->pairArr->length; ++k)
+            {
+                JsonObject* attachmentObject = AJsonObject->GetObjectByIndex(attachmentMap, k);
+                const char* type             = AJsonObject->GetString(attachmentObject, "type", "region");
+                SkinMesh    skinMesh[1];
+                char        name[128];
+
+                if (strcmp(type, "mesh") != 0 && strcmp(type, "skinnedmesh") != 0)
+                {
+                    continue;
+                }
+
+                JsonArray* jsonVertexArr = AJsonObject->GetArray(attachmentObject, "vertices");
+                JsonArray* jsonUVArr     = AJsonObject->GetArray(attachmentObject, "uvs");
+
+                if (strcmp(type, "skinnedmesh") == 0 || jsonVertexArr->valueArr->length > jsonUVArr->valueArr->length)
+                {
+                    InitWeighted(jsonVertexArr, skinMesh);
+                    snprintf
+                    (
+                        name,
+                        sizeof(name),
+                        "%s/%s/%s",
+                        AJsonObject->GetKey(skinMap, i),
+                        slotName,
+                        AJsonObject->GetKey(attachmentMap, k)
+                    );
+                }
+                else
+                {
+                    InitUnweighted(jsonVertexArr, boneParents, slotBoneIndex, maxWeights, skinMesh);
+                    snprintf
+                    (
+                        name,
+                        sizeof(name),
+                        "%s/%s/%s (unweighted)",
+                        AJsonObject->GetKey(skinMap, i),
+                        slotName,
+                        AJsonObject->GetKey(attachmentMap, k)
+                    );
+                }
+
+                BenchmarkMesh(name, skinMesh, affines, iterations);
+
+                free(skinMesh->bones);
+                free(skinMesh->weights);
+                free(skinMesh->weightVertices);
+                ++count;
+            }
+        }
+    }
+
+    free(boneParents);
+    free(affines);
+    AJson->Destroy(value);
+    free(jsonString);
+
+    return count;
+}
+
+
+int main(int argc, char** argv)
+{
+    int iterations = 20000;
+    int maxWeights = 2;
+    int i          = 1;
+
+    for (; i + 1 < argc && argv[i][0] == '-'; i += 2)
+    {
+        if (strcmp(argv[i], "-n") == 0)
+        {
+            iterations = atoi(argv[i + 1]);
+        }
+        else if (strcmp(argv[i], "-w") == 0)
+        {
+            maxWeights = atoi(argv[i + 1]);
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (i >= argc || iterations < 1 || maxWeights < 1)
+    {
+        fprintf(stderr, "usage: SkinningBenchmark [-n iterations] [-w weights] <json files>\n");
+        return 1;
+    }
+
+    #if defined(SKELETON_SKINNING_SSE2)
+    printf("kernel: SSE2\n");
+    #elif defined(SKELETON_SKINNING_NEON)
+    printf("kernel: NEON\n");
+    #else
+    printf("kernel: scalar\n");
+    #endif
+
+    int count = 0;
+
+    for (; i < argc; ++i)
+    {
+        count += BenchmarkFile(argv[i], iterations, maxWeights);
+    }
+
+    printf("meshes %d\n", count);
+
+    return 0;
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+/**
+ * The build tool that converts PNG into pre-decoded texture file for AImage->Init,
+ * then the texture is uploaded from mapped file without decoding.
+ * it is not a part of engine, and runs on Linux or macOS with libpng 1.6.
+ *
+ * build: cc -std=c99 -O2 -I <Mojoc root> -o TextureConverter Engine/Build/Tools/TextureConverter.c -lpng
+ * usage: TextureConverter [-f rgba8888|rgb565|rgba4444] [-p] [-m] <input png> <output file>
+ *
+ * -f: the pixel format, default rgba8888.
+ * -p: premultiply RGB by alpha, it needs glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA) when drawing.
+ * -m: generate mip levels down to 1x1 by box filter.
+ *
+ * the output file can keep the name of PNG, so the atlas files need not change,
+ * for example convert the copy of assets directory before Packer:
+ *     find assets -name "*.png" -exec TextureConverter -f rgba4444 {} {} \;
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <png.h>
+
+#include "Engine/Graphics/Utils/Image.h"
+
+
+/**
+ * Premultiply RGB of RGBA8888 pixels by alpha.
+ */
+static void Premultiply(uint8_t* pixels, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        uint8_t* pixel = pixels + i * 4;
+
+        pixel[0] = (uint8_t) ((pixel[0] * pixel[3] + 127) / 255);
+        pixel[1] = (uint8_t) ((pixel[1] * pixel[3] + 127) / 255);
+        pixel[2] = (uint8_t) ((pixel[2] * pixel[3] + 127) / 255);
+    }
+}
+
+
+/**
+ * Create the next mip level of RGBA8888 pixels by 2x2 box filter, the edge pixels are clamped.
+ */
+static uint8_t* CreateNextLevel(const uint8_t* pixels, int width, int height, int* outWidth, int* outHeight)
+{
+    int      nextWidth  = width  > 1 ? width  / 2 : 1;
+    int      nextHeight = height > 1 ? height / 2 : 1;
+    uint8_t* next       = malloc((size_t) nextWidth * (size_t) nextHeight * 4);
+
+    for (int y = 0; y < nextHeight; ++y)
+    {
+        int y0 = y * 2;
+        int y1 = y0 + 1 < height ? y0 + 1 : y0;
+
+        for (int x = 0; x < nextWidth; ++x)
+        {
+            int x0 = x * 2;
+            int x1 = x0 + 1 < width ? x0 + 1 : x0;
+
+            for (int c = 0; c < 4; ++c)
+            {
+                int sum = pixels[(y0 * width + x0) * 4 + c] +
+                          pixels[(y0 * width + x1) * 4 + c] +
+                          pixels[(y1 * width + x0) * 4 + c] +
+                          pixels[(y1 * width + x1) * 4 + c];
+
+                next[(y * nextWidth + x) * 4 + c] = (uint8_t) ((sum + 2) / 4);
+            }
+        }
+    }
+
+    *outWidth  = nextWidth;
+    *outHeight = nextHeight;
+
+    return next;
+}
+
+
+/**
+ * Convert RGBA8888 pixels into format, and write with padding to 4 bytes.
+ */
+static void WriteLevel(FILE* out, const uint8_t* pixels, int width, int height, ImageFormat format)
+{
+    int      count = width * height;
+    int      bytes = AImage_GetLevelBytes(format, width, height, 0);
+    uint8_t* data  = calloc((size_t) bytes, 1);
+
+    if (format == ImageFormat_RGBA8888)
+    {
+        memcpy(data, pixels, (size_t) count * 4);
+    }
+    else
+    {
+        uint16_t* shorts = (uint16_t*) data;
+
+        for (int i = 0; i < count; ++i)
+        {
+            const uint8_t* pixel = pixels + i * 4;
+
+            if (format == ImageFormat_RGB565)
+            {
+                shorts[i] = (uint16_t)
+                (
+                    ((pixel[0] * 31 + 127) / 255) << 11 |
+                    ((pixel[1] * 63 + 127) / 255) << 5  |
+                    ((pixel[2] * 31 + 127) / 255)
+                );
+            }
+            else
+            {
+                shorts[i] = (uint16_t)
+                (
+                    ((pixel[0] * 15 + 127) / 255) << 12 |
+                    ((pixel[1] * 15 + 127) / 255) << 8  |
+                    ((pixel[2] * 15 + 127) / 255) << 4  |
+                    ((pixel[3] * 15 + 127) / 255)
+                );
+            }
+        }
+    }
+
+    fwrite(data, 1, (size_t) bytes, out);
+    free(data);
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32_t endian = 1;
+
+    if (*(uint8_t*) &endian != 1)
+    {
+        fprintf(stderr, "TextureConverter only runs on little-endian machine\n");
+        return 1;
+    }
+
+    ImageFormat format          = ImageFormat_RGBA8888;
+    int         isPremultiplied = 0;
+    int         isMipmap        = 0;
+    int         argIndex        = 1;
+
+    for (; argIndex < argc && argv[argIndex][0] == '-'; ++argIndex)
+    {
+        if (strcmp(argv[argIndex], "-f") == 0 && argIndex + 1 < argc)
+        {
+            const char* name = argv[++argIndex];
+
+            if (strcmp(name, "rgba8888") == 0)
+            {
+                format = ImageFormat_RGBA8888;
+            }
+            else if (strcmp(name, "rgb565") == 0)
+            {
+                format = ImageFormat_RGB565;
+            }
+            else if (strcmp(name, "rgba4444") == 0)
+            {
+                format = ImageFormat_RGBA4444;
+            }
+            else
+            {
+                fprintf(stderr, "TextureConverter unknown format = %s\n", name);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[argIndex], "-p") == 0)
+        {
+            isPremultiplied = 1;
+        }
+        else if (strcmp(argv[argIndex], "-m") == 0)
+        {
+            isMipmap = 1;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (argc - argIndex != 2)
+    {
+        fprintf
+        (
+            stderr,
+            "usage: TextureConverter [-f rgba8888|rgb565|rgba4444] [-p] [-m] <input png> <output file>\n"
+        );
+        return 1;
+    }
+
+    const char* inPath  = argv[argIndex];
+    const char* outPath = argv[argIndex + 1];
+
+    png_image png[1];
+    memset(png, 0, sizeof(png_image));
+    png->version = PNG_IMAGE_VERSION;
+
+    if (png_image_begin_read_from_file(png, inPath) == 0)
+    {
+        fprintf(stderr, "TextureConverter cannot read PNG = %s, %s\n", inPath, png->message);
+        return 1;
+    }
+
+    // the palette, tRNS, gray and 16 bits are all transformed into RGBA8888
+    png->format     = PNG_FORMAT_RGBA;
+    uint8_t* pixels = malloc(PNG_IMAGE_SIZE(*png));
+
+    if (png_image_finish_read(png, NULL, pixels, 0, NULL) == 0)
+    {
+        fprintf(stderr, "TextureConverter cannot decode PNG = %s, %s\n", inPath, png->message);
+        return 1;
+    }
+
+    int width      = (int) png->width;
+    int height     = (int) png->height;
+    int levelCount = 1;
+
+    if (isMipmap)
+    {
+        for (int size = width > height ? width : height; size > 1; size /= 2)
+        {
+            ++levelCount;
+        }
+    }
+
+    if (isPremultiplied)
+    {
+        Premultiply(pixels, width * height);
+    }
+
+    // the output may be the input, so write after reading
+    FILE* out = fopen(outPath, "wb");
+
+    if (out == NULL)
+    {
+        fprintf(stderr, "TextureConverter cannot create file = %s\n", outPath);
+        return 1;
+    }
+
+    ImageTextureHeader header[1] =
+    {{
+        AImage_TextureMagic,
+        AImage_TextureVersion,
+        (uint8_t) format,
+        (uint8_t) levelCount,
+        (uint8_t) (isPremultiplied ? ImageFlag_Premultiplied : 0),
+        (uint32_t) width,
+        (uint32_t) height,
+    }};
+
+    fwrite(header, sizeof(ImageTextureHeader), 1, out);
+
+    uint8_t* level       = pixels;
+    int      levelWidth  = width;
+    int      levelHeight = height;
+
+    for (int i = 0; i < levelCount; ++i)
+    {
+        WriteLevel(out, level, levelWidth, levelHeight, format);
+
+        if (i + 1 < levelCount)
+        {
+            uint8_t* next = CreateNextLevel(level, levelWidth, levelHeight, &levelWidth, &levelHeight);
+            free(level);
+            level = next;
+        }
+    }
+
+    free(level);
+    fclose(out);
+
+    printf
+    (
+        "TextureConverter converted %s into %s, %dx%d with %d levels\n",
+        inPath,
+        outPath,
+        width,
+        height,
+        levelCount
+    );
+
+    return 0;
+}
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2017-1-2017
- * Update   : 2019-2-1
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -23,6 +23,46 @@
 static ArrayList(DrawAtlas*) drawAtlasCacheList[1] = AArrayList_Init(DrawAtlas*, 10);
 
 
+static void Evict(ResourceRef* ref)
+{
+    DrawAtlas* drawAtlas = AStruct_GetParentWithName(ref, DrawAtlas, resourceRef);
+
+    for (int i = 0; i < drawAtlasCacheList->size; ++i)
+    {
+        if (AArrayList_Get(drawAtlasCacheList, i, DrawAtlas*) == drawAtlas)
+        {
+            AArrayList->RemoveByLast(drawAtlasCacheList, i);
+            break;
+        }
+    }
+
+    AMesh     ->Release(drawAtlas->mesh);
+    AArrayList->Release(drawAtlas->quadList);
+
+    free(drawAtlas);
+}
+
+
+/**
+ * Find the released DrawAtlas that Mesh uses the texture, and remove it from drawAtlasCacheList.
+ */
+static inline DrawAtlas* PopCache(Texture* texture)
+{
+    for (int i = drawAtlasCacheList->size - 1; i > -1; --i)
+    {
+        DrawAtlas* drawAtlas = AArrayList_Get(drawAtlasCacheList, i, DrawAtlas*);
+
+        if (drawAtlas->mesh->texture == texture)
+        {
+            AArrayList->RemoveByLast(drawAtlasCacheList, i);
+            return drawAtlas;
+        }
+    }
+
+    return NULL;
+}
+
+
 static DrawAtlas* Get(const char* filePath)
 {
     TextureAtlas* textureAtlas = ATextureAtlas->Get(filePath);
@@ -33,7 +73,8 @@ static DrawAtlas* Get(const char* filePath)
         "DrawAtlas not support TextureAtlas has multiple textures"
     );
 
-    DrawAtlas* drawAtlas = AArrayList_Pop(drawAtlasCacheList, DrawAtlas*);
+    Texture*   texture   = AArrayList_Get(textureAtlas->textureList, 0, Texture*);
+    DrawAtlas* drawAtlas = PopCache(texture);
 
     if (drawAtlas == NULL)
     {
@@ -41,17 +82,19 @@ static DrawAtlas* Get(const char* filePath)
 
         AMesh->InitWithCapacity
         (
-            AArrayList_Get(textureAtlas->textureList, 0, Texture*),
+            texture,
             20,
             drawAtlas->mesh
         );
 
         AArrayList->InitWithCapacity(sizeof(SubMesh*), 20, drawAtlas->quadList);
+        AResource ->Add(ResourceClass_DrawAtlas, sizeof(DrawAtlas), Evict, drawAtlas->resourceRef);
     }
     else
     {
         AMesh     ->Clear(drawAtlas->mesh);
         AArrayList->Clear(drawAtlas->quadList);
+        AResource ->Retain(drawAtlas->resourceRef);
     }
 
     drawAtlas->textureAtlas = textureAtlas;
@@ -95,6 +138,20 @@ static SubMesh* GetQuad(DrawAtlas* drawAtlas, const char* quadName)
 }
 
 
+/**
+ * The memory bytes of DrawAtlas, include the SubMeshes and buffer data of mesh.
+ */
+static inline long GetBytes(DrawAtlas* drawAtlas)
+{
+    Mesh* mesh = drawAtlas->mesh;
+
+    return (long) sizeof(DrawAtlas)                              +
+           (long) mesh->childList->size * (long) sizeof(SubMesh) +
+           (long) mesh->vertexDataSize                           +
+           (long) mesh->indexDataSize;
+}
+
+
 static void Release(DrawAtlas* drawAtlas)
 {
     ALog_A
@@ -110,8 +167,13 @@ static void Release(DrawAtlas* drawAtlas)
         ADrawable_SetInvisible(AArrayList_Get(drawAtlas->quadList, i, SubMesh*)->drawable);
     }
 
+    ATextureAtlas->Release(drawAtlas->textureAtlas);
     drawAtlas->textureAtlas = NULL;
     AArrayList_Add(drawAtlasCacheList, drawAtlas);
+
+    // the mesh may grow by quads
+    AResource->SetBytes(drawAtlas->resourceRef, GetBytes(drawAtlas));
+    AResource->Release (drawAtlas->resourceRef);
 }
 
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2017-1-5
- * Update   : 2019-2-1
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -41,6 +41,11 @@ typedef struct
      * Quads in texture which are SubMesh of Mesh.
      */
     ArrayList(SubMesh*) quadList[1];
+
+    /**
+     * The references of DrawAtlas, the released DrawAtlas is kept for reuse until evicted by AResource budget.
+     */
+    ResourceRef         resourceRef[1];
 }
 DrawAtlas;
 
@@ -58,7 +63,8 @@ struct ADrawAtlas
     SubMesh*   (*GetQuad)      (DrawAtlas*  drawAtlas, const char* quadName);
 
     /**
-     * Make drawAtlas can reuse in Get method.
+     * Make drawAtlas can reuse in Get method by same texture,
+     * and release the reference of textureAtlas.
      */
     void       (*Release)      (DrawAtlas* drawAtlas);
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-7-27
- * Update   : 2019-2-1
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -17,14 +17,71 @@
 #include <stdio.h>
 #include <string.h>
 
-#include "Engine/Toolkit/Utils/ArrayIntSet.h"
+#include "Engine/Toolkit/Utils/SlotMap.h"
 #include "Engine/Extension/Font.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Graphics/OpenGL/SubMesh.h"
+#include "Engine/Toolkit/Utils/Pool.h"
+#include "Engine/Toolkit/HeaderUtils/Struct.h"
 
 
-static ArrayList(Font*)     fontCacheList[1] = AArrayList_Init(Font*,     5);
-static ArrayList(FontText*) textCacheList[1] = AArrayList_Init(FontText*, 30);
+static void OnCreateText(void* element)
+{
+    FontText* text = element;
+    AArrayList->InitWithBuffer
+    (
+        sizeof(SubMesh*),
+        text->usedSubMeshBuffer,
+        FontText_SubMeshBufferLength,
+        text->usedSubMeshList
+    );
+    text->usedSubMeshList->increase = 10;
+}
+
+
+static ArrayList(Font*)     fontCacheList[1] = AArrayList_Init(Font*,    5);
+static Pool     (FontText)  textPool     [1] = APool_Init     (FontText, 30, OnCreateText, NULL);
+
+
+static void Evict(ResourceRef* ref)
+{
+    Font* font = AStruct_GetParentWithName(ref, Font, resourceRef);
+
+    for (int i = 0; i < fontCacheList->size; ++i)
+    {
+        if (AArrayList_Get(fontCacheList, i, Font*) == font)
+        {
+            AArrayList->RemoveByLast(fontCacheList, i);
+            break;
+        }
+    }
+
+    AMesh      ->Release(font->mesh);
+    ASlotMap   ->Release(font->fontTextMap);
+    AArrayList ->Release(font->unusedSubMeshList);
+
+    free(font);
+}
+
+
+/**
+ * Find the released Font that Mesh uses the texture, and remove it from fontCacheList.
+ */
+static inline Font* PopCache(Texture* texture)
+{
+    for (int i = fontCacheList->size - 1; i > -1; --i)
+    {
+        Font* font = AArrayList_Get(fontCacheList, i, Font*);
+
+        if (font->mesh->texture == texture)
+        {
+            AArrayList->RemoveByLast(fontCacheList, i);
+            return font;
+        }
+    }
+
+    return NULL;
+}
 
 
 static Font* Get(const char* filePath)
@@ -37,7 +94,8 @@ static Font* Get(const char* filePath)
         "Font not support TextureAtlas has multiple texture"
     );
 
-    Font* font = AArrayList_Pop(fontCacheList, Font*);
+    Texture* texture = AArrayList_Get(textureAtlas->textureList, 0, Texture*);
+    Font*    font    = PopCache(texture);
 
     if (font == NULL)
     {
@@ -45,19 +103,23 @@ static Font* Get(const char* filePath)
 
         AMesh->InitWithCapacity
         (
-            AArrayList_Get(textureAtlas->textureList, 0, Texture*),
+            texture,
             50,
             font->mesh
         );
 
-        AArrayIntSet->Init(font->fontTextSet);
-        AArrayList  ->Init(sizeof(SubMesh*), font->unusedSubMeshList);
+        ASlotMap    ->Init(sizeof(FontText*), font->fontTextMap);
+        AArrayList  ->Init(sizeof(SubMesh*),  font->unusedSubMeshList);
+
+        AResource->Add(ResourceClass_Font, sizeof(Font), Evict, font->resourceRef);
     }
     else
     {
-        AArrayIntSet->Clear(font->fontTextSet);
+        ASlotMap    ->Clear(font->fontTextMap);
         AArrayList  ->Clear(font->unusedSubMeshList);
         AMesh       ->Clear(font->mesh);
+
+        AResource->Retain(font->resourceRef);
     }
 
     font->textureAtlas = textureAtlas;
@@ -68,18 +130,8 @@ static Font* Get(const char* filePath)
 
 static FontText* GetText(Font* font)
 {
-    FontText* text = AArrayList_Pop(textCacheList, FontText*);
-
-    if (text == NULL)
-    {
-        text = malloc(sizeof(FontText));
-        AArrayList->Init(sizeof(SubMesh*), text->usedSubMeshList);
-        text->usedSubMeshList->increase = 10;
-    }
-    else
-    {
-        AArrayList->Clear(text->usedSubMeshList);
-    }
+    FontText* text = APool_Get(textPool, FontText);
+    AArrayList->Clear(text->usedSubMeshList);
 
     // reset drawable
     ADrawable->Init(text->drawable);
@@ -87,7 +139,7 @@ static FontText* GetText(Font* font)
     text->alignment   = FontTextAlignment_HorizontalLeft;
     text->charSpacing = 0.0f;
     text->font        = font;
-    AArrayIntSet->TryAdd(font->fontTextSet, (intptr_t) text);
+    text->handleInFont = ASlotMap_Add(font->fontTextMap, text);
 
     return text;
 }
@@ -95,9 +147,9 @@ static FontText* GetText(Font* font)
 
 static void Draw(Font* font)
 {
-    for (int i = 0; i < font->fontTextSet->elementList->size; ++i)
+    for (int i = 0; i < font->fontTextMap->elementList->size; ++i)
     {
-        ADrawable->Draw(AArrayList_Get(font->fontTextSet->elementList, i, FontText*)->drawable);
+        ADrawable->Draw(ASlotMap_GetAt(font->fontTextMap, i, FontText*)->drawable);
     }
 
     AMesh_Draw(font->mesh);
@@ -321,19 +373,38 @@ static void SetFloat(FontText* text, float num)
 }
 
 
+/**
+ * The memory bytes of Font, include the SubMeshes and buffer data of mesh.
+ */
+static inline long GetBytes(Font* font)
+{
+    Mesh* mesh = font->mesh;
+
+    return (long) sizeof(Font)                                   +
+           (long) mesh->childList->size * (long) sizeof(SubMesh) +
+           (long) mesh->vertexDataSize                           +
+           (long) mesh->indexDataSize;
+}
+
+
 static void Release(Font* font)
 {
     ALog_A(font->textureAtlas != NULL, "AFont Release font %p already Released", font);
 
-    for (int i = 0; i < font->fontTextSet->elementList->size; ++i)
+    for (int i = 0; i < font->fontTextMap->elementList->size; ++i)
     {
-        FontText* text = AArrayList_Get(font->fontTextSet->elementList, i, FontText*);
+        FontText* text = ASlotMap_GetAt(font->fontTextMap, i, FontText*);
         text->font     = NULL;
-        AArrayList_Add(textCacheList, text);
+        APool->Free(textPool, text);
     }
 
+    ATextureAtlas->Release(font->textureAtlas);
     font->textureAtlas = NULL;
     AArrayList_Add(fontCacheList, font);
+
+    // the mesh may grow by texts
+    AResource->SetBytes(font->resourceRef, GetBytes(font));
+    AResource->Release (font->resourceRef);
 }
 
 
@@ -348,10 +419,10 @@ static void ReleaseText(FontText* text)
         AArrayList_Add(text->font->unusedSubMeshList, subMesh);
     }
 
-    AArrayIntSet->TryRemove(text->font->fontTextSet, (intptr_t) text);
+    ASlotMap->TryRemove(text->font->fontTextMap, text->handleInFont);
     text->font = NULL;
 
-    AArrayList_Add(textCacheList, text);
+    APool->Free(textPool, text);
 }
 
 
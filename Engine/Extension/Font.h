@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-7-27
- * Update   : 2019-1-31
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -18,7 +18,7 @@
 #define FONT_H
 
 
-#include "Engine/Toolkit/Utils/ArrayIntSet.h"
+#include "Engine/Toolkit/Utils/SlotMap.h"
 #include "Engine/Extension/TextureAtlas.h"
 #include "Engine/Graphics/OpenGL/Mesh.h"
 
@@ -41,13 +41,18 @@ typedef struct
     /**
      * Cache all FontTexts.
      */
-    ArrayIntSet(FontText*) fontTextSet[1];
+    SlotMap    (FontText*) fontTextMap[1];
 
     /**
      * Font Mesh unused SubMesh list.
      * released FontText's SubMesh will add into this.
      */
     ArrayList  (SubMesh*)  unusedSubMeshList[1];
+
+    /**
+     * The references of Font, the released Font is kept for reuse until evicted by AResource budget.
+     */
+    ResourceRef            resourceRef[1];
 }
 Font;
 
@@ -65,6 +70,12 @@ typedef enum
 FontTextAlignment;
 
 
+/**
+ * The length of FontText usedSubMeshBuffer.
+ */
+#define FontText_SubMeshBufferLength 16
+
+
 /**
  * The text in font textureAtlas.
  */
@@ -94,6 +105,16 @@ typedef struct
      * The SubMesh list that FontText used.
      */
     ArrayList(SubMesh*) usedSubMeshList[1];
+
+    /**
+     * The first SubMeshes of usedSubMeshList store in it.
+     */
+    SubMesh*            usedSubMeshBuffer[FontText_SubMeshBufferLength];
+
+    /**
+     * The handle of FontText in Font fontTextMap.
+     */
+    SlotMapHandle       handleInFont;
 }
 FontText;
 
@@ -119,8 +140,8 @@ struct AFont
     void      (*SetFloat)      (FontText* text, float       num);
 
     /**
-     * Make Font can reuse in Get method,
-     * and release all FontTexts.
+     * Make Font can reuse in Get method by same texture,
+     * and release all FontTexts and the reference of textureAtlas.
      */
     void      (*Release)       (Font* font);
 
@@ -0,0 +1,635 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "Engine/Extension/Loader.h"
+#include "Engine/Extension/TextureAtlas.h"
+#include "Engine/Extension/Font.h"
+#include "Engine/Extension/Spine/SkeletonData.h"
+#include "Engine/Extension/Spine/SkeletonBinary.h"
+#include "Engine/Graphics/OpenGL/Texture.h"
+#include "Engine/Graphics/Utils/Image.h"
+#include "Engine/Audio/Platform/Audio.h"
+#include "Engine/Toolkit/Utils/Json.h"
+#include "Engine/Toolkit/Utils/FileTool.h"
+#include "Engine/Toolkit/Utils/Job.h"
+#include "Engine/Toolkit/Utils/MPMCQueue.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+typedef enum
+{
+    /**
+     * Waiting in pendingList for running in AJob.
+     */
+    LoaderState_Pending,
+
+    /**
+     * Running in AJob, and pushed into completedQueue when Job completed.
+     */
+    LoaderState_Running,
+
+    /**
+     * Waiting in finishingList for creating resource in main thread.
+     */
+    LoaderState_Finishing,
+}
+LoaderState;
+
+
+/**
+ * The texture Image inited in AJob, the pixels are NULL when not inited.
+ */
+typedef struct
+{
+    char*    filePath;
+    Image    image[1];
+
+    /**
+     * The uploaded texture referenced until the resource of request references it, NULL when not uploaded.
+     */
+    Texture* texture;
+}
+LoaderTexture;
+
+
+typedef struct
+{
+    LoaderType               type;
+    LoaderState              state;
+
+    /**
+     * The Load order, the earlier one loads first in same priority.
+     */
+    int                      order;
+    int                      priority;
+
+    LoaderOnLoaded           OnLoaded;
+    void*                    param;
+
+    /**
+     * The handle in requestMap.
+     */
+    SlotMapHandle            handle;
+
+    /**
+     * The canceled request in running is released when its Job completed.
+     */
+    bool                     isCancel;
+
+    /**
+     * The textures to be uploaded in order.
+     */
+    ArrayList(LoaderTexture) textureList[1];
+
+    /**
+     * The index of next texture to be uploaded.
+     */
+    int                      textureIndex;
+
+    /**
+     * The json of SkeletonData.
+     */
+    JsonValue*               json;
+
+    /**
+     * The mapping of compiled skeleton file, the data is NULL if not compiled.
+     */
+    FileMapping              skeletonMapping[1];
+
+    /**
+     * The data follows LoaderRequest.
+     */
+    char*                    filePath;
+}
+LoaderRequest;
+
+
+static SlotMap  (LoaderRequest*) requestMap   [1] = ASlotMap_Init  (LoaderRequest*, 20);
+static ArrayList(LoaderRequest*) pendingList  [1] = AArrayList_Init(LoaderRequest*, 20);
+static ArrayList(LoaderRequest*) finishingList[1] = AArrayList_Init(LoaderRequest*, 20);
+
+
+/**
+ * The requests completed by Jobs in worker threads, consumed by main thread in Update.
+ * the capacity is the count of workers, because the running requests are no more than it.
+ */
+static MPMCQueue(LoaderRequest*) completedQueue[1];
+
+
+static int requestOrder = 0;
+static int runningCount = 0;
+static int loadedCount  = 0;
+static int totalCount   = 0;
+
+
+static inline double GetSeconds()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec + now.tv_nsec * 0.000000001;
+}
+
+
+/**
+ * Reset the progress when all requests finished or canceled.
+ */
+static inline void TryResetProgress()
+{
+    if (requestMap->elementList->size == 0)
+    {
+        loadedCount = 0;
+        totalCount  = 0;
+    }
+}
+
+
+static void ReleaseRequest(LoaderRequest* request)
+{
+    for (int i = 0; i < request->textureList->size; ++i)
+    {
+        LoaderTexture* texture = AArrayList_GetPtr(request->textureList, i, LoaderTexture);
+
+        if (texture->image->pixels != NULL)
+        {
+            AImage->Release(texture->image);
+        }
+
+        if (texture->texture != NULL)
+        {
+            ATexture->Release(texture->texture);
+        }
+
+        free(texture->filePath);
+    }
+
+    AArrayList->Release(request->textureList);
+
+    if (request->json != NULL)
+    {
+        AJson->Destroy(request->json);
+    }
+
+    if (request->skeletonMapping->data != NULL)
+    {
+        AFileTool->ReleaseMappedData(request->skeletonMapping);
+    }
+
+    free(request);
+}
+
+
+/**
+ * Get the index of request that has highest priority and earliest order in list.
+ */
+static int GetTopIndex(ArrayList(LoaderRequest*)* list)
+{
+    int topIndex = 0;
+
+    for (int i = 1; i < list->size; ++i)
+    {
+        LoaderRequest* request = AArrayList_Get(list, i,        LoaderRequest*);
+        LoaderRequest* top     = AArrayList_Get(list, topIndex, LoaderRequest*);
+
+        if (request->priority > top->priority || (request->priority == top->priority && request->order < top->order))
+        {
+            topIndex = i;
+        }
+    }
+
+    return topIndex;
+}
+
+
+static bool TryRemoveFromList(ArrayList(LoaderRequest*)* list, LoaderRequest* request)
+{
+    for (int i = 0; i < list->size; ++i)
+    {
+        if (AArrayList_Get(list, i, LoaderRequest*) == request)
+        {
+            AArrayList->RemoveByLast(list, i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static void DecodeTextures(int fromIndex, int toIndex, void* param)
+{
+    LoaderRequest* request = param;
+
+    for (int i = fromIndex; i < toIndex; ++i)
+    {
+        LoaderTexture* texture = AArrayList_GetPtr(request->textureList, i, LoaderTexture);
+        bool           isInit  = AImage->Init(texture->filePath, texture->image);
+
+        ALog_A(isInit, "ALoader DecodeTextures failed, no pixels data found in %s", texture->filePath);
+    }
+}
+
+
+/**
+ * Add the textures of atlas into textureList.
+ */
+static void AddAtlasTextures(LoaderRequest* request, const char* atlasFilePath)
+{
+    ArrayList(char*) pathList[1] = AArrayList_Init(char*, 4);
+    ATextureAtlas->GetTexturePaths(atlasFilePath, pathList);
+
+    for (int i = 0; i < pathList->size; ++i)
+    {
+        LoaderTexture* texture = AArrayList_GetPtrAdd(request->textureList, LoaderTexture);
+        texture->filePath      = AArrayList_Get(pathList, i, char*);
+        texture->image->pixels = NULL;
+        texture->texture       = NULL;
+    }
+
+    AArrayList->Release(pathList);
+}
+
+
+/**
+ * Run in AJob, only touch the data of request.
+ */
+static void LoadInJob(void* param)
+{
+    LoaderRequest* request = param;
+
+    switch (request->type)
+    {
+        case LoaderType_Texture:
+        {
+            size_t         size    = strlen(request->filePath) + 1;
+            LoaderTexture* texture = AArrayList_GetPtrAdd(request->textureList, LoaderTexture);
+            texture->filePath      = memcpy(malloc(size), request->filePath, size);
+            texture->image->pixels = NULL;
+            texture->texture       = NULL;
+            break;
+        }
+
+        case LoaderType_TextureAtlas:
+        case LoaderType_Font:
+            AddAtlasTextures(request, request->filePath);
+            break;
+
+        case LoaderType_SkeletonData:
+        {
+            char path[strlen(request->filePath) + sizeof(".atlas")];
+
+            sprintf(path, "%s.json", request->filePath);
+            AFileTool->CreateMappedDataFromResource(path, request->skeletonMapping);
+
+            // the compiled skeleton file needs no parsing, and it is loaded in main thread
+            if (ASkeletonBinary_IsValid(request->skeletonMapping->data, request->skeletonMapping->length) == false)
+            {
+                request->json = AJson->ParseMapping(request->skeletonMapping);
+            }
+
+            sprintf(path, "%s.atlas", request->filePath);
+            AddAtlasTextures(request, path);
+            break;
+        }
+
+        case LoaderType_AudioPlayer:
+            break;
+    }
+
+    // the pages of atlas are decoded in parallel
+    AJob->ParallelFor(request->textureList->size, 1, DecodeTextures, request);
+
+    bool isPushed = AMPMCQueue_Push(completedQueue, request);
+    ALog_A(isPushed, "ALoader LoadInJob completedQueue is full, %s", request->filePath);
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+/**
+ * Whether the resource of request is cached, so no need to run in AJob.
+ */
+static bool IsCached(LoaderRequest* request)
+{
+    switch (request->type)
+    {
+        case LoaderType_Texture:
+            return ATexture->Find(request->filePath) != NULL;
+
+        case LoaderType_TextureAtlas:
+        case LoaderType_Font:
+            return ATextureAtlas->Find(request->filePath) != NULL;
+
+        case LoaderType_SkeletonData:
+            return ASkeletonData->Find(request->filePath) != NULL;
+
+        case LoaderType_AudioPlayer:
+            return true;
+    }
+
+    return false;
+}
+
+
+static SlotMapHandle Load(LoaderType type, const char* filePath, int priority, LoaderOnLoaded OnLoaded, void* param)
+{
+    size_t         size    = strlen(filePath) + 1;
+    LoaderRequest* request = malloc(sizeof(LoaderRequest) + size);
+
+    request->type                  = type;
+    request->state                 = LoaderState_Pending;
+    request->order                 = requestOrder++;
+    request->priority              = priority;
+    request->OnLoaded              = OnLoaded;
+    request->param                 = param;
+    request->isCancel              = false;
+    request->textureIndex          = 0;
+    request->json                  = NULL;
+    request->skeletonMapping->data = NULL;
+    request->filePath              = (char*) request + sizeof(LoaderRequest);
+    request->handle                = ASlotMap_Add(requestMap, request);
+
+    memcpy(request->filePath, filePath, size);
+    AArrayList->Init(sizeof(LoaderTexture), request->textureList);
+    AArrayList_Add(pendingList, request);
+
+    ++totalCount;
+
+    return request->handle;
+}
+
+
+static bool Cancel(SlotMapHandle handle)
+{
+    LoaderRequest** requestPtr = ASlotMap_GetPtr(requestMap, handle, LoaderRequest*);
+
+    if (requestPtr == NULL)
+    {
+        return false;
+    }
+
+    LoaderRequest* request = *requestPtr;
+    ASlotMap->TryRemove(requestMap, handle);
+    --totalCount;
+
+    switch (request->state)
+    {
+        case LoaderState_Pending:
+            TryRemoveFromList(pendingList, request);
+            ReleaseRequest(request);
+            break;
+
+        case LoaderState_Running:
+            // released in Update when Job completed
+            request->isCancel = true;
+            break;
+
+        case LoaderState_Finishing:
+            TryRemoveFromList(finishingList, request);
+            ReleaseRequest(request);
+            break;
+    }
+
+    TryResetProgress();
+
+    return true;
+}
+
+
+static void CancelAll()
+{
+    while (requestMap->elementList->size > 0)
+    {
+        Cancel(ASlotMap->GetHandleAt(requestMap, 0));
+    }
+}
+
+
+static float GetProgress()
+{
+    return totalCount == 0 ? 1.0f : (float) loadedCount / (float) totalCount;
+}
+
+
+/**
+ * Release the reference of resource that no one owns, and it is kept in cache unused.
+ */
+static inline void ReleaseResource(LoaderType type, void* resource)
+{
+    switch (type)
+    {
+        case LoaderType_Texture:
+            ATexture->Release(resource);
+            break;
+
+        case LoaderType_TextureAtlas:
+            ATextureAtlas->Release(resource);
+            break;
+
+        case LoaderType_SkeletonData:
+            ASkeletonData->Release(resource);
+            break;
+
+        case LoaderType_Font:
+            AFont->Release(resource);
+            break;
+
+        case LoaderType_AudioPlayer:
+            break;
+    }
+}
+
+
+/**
+ * Run one step of finishing request in main thread, return true if the request finished.
+ */
+static bool FinishStep(LoaderRequest* request)
+{
+    if (request->textureIndex < request->textureList->size)
+    {
+        LoaderTexture* texture = AArrayList_GetPtr(request->textureList, request->textureIndex++, LoaderTexture);
+
+        // keep the reference, so the texture cannot be evicted before the resource references it
+        texture->texture = ATexture->GetWithImage(texture->filePath, texture->image);
+        AImage->Release(texture->image);
+
+        return false;
+    }
+
+    void* resource = NULL;
+
+    // the textures are all cached, so Get only creates the resource
+    switch (request->type)
+    {
+        case LoaderType_Texture:
+            resource = ATexture->Get(request->filePath);
+            break;
+
+        case LoaderType_TextureAtlas:
+            resource = ATextureAtlas->Get(request->filePath);
+            break;
+
+        case LoaderType_SkeletonData:
+            if (request->skeletonMapping->data != NULL)
+            {
+                resource = ASkeletonData->GetWithBinary(request->filePath, request->skeletonMapping);
+            }
+            else
+            {
+                resource = request->json != NULL ?
+                           ASkeletonData->GetWithJson(request->filePath, request->json) :
+                           ASkeletonData->Get        (request->filePath);
+            }
+            break;
+
+        case LoaderType_Font:
+            resource = AFont->Get(request->filePath);
+            break;
+
+        case LoaderType_AudioPlayer:
+            resource = AAudio->GetPlayer(request->filePath);
+            break;
+    }
+
+    // the resource references the textures now
+    for (int i = 0; i < request->textureList->size; ++i)
+    {
+        LoaderTexture* texture = AArrayList_GetPtr(request->textureList, i, LoaderTexture);
+        ATexture->Release(texture->texture);
+        texture->texture       = NULL;
+    }
+
+    ASlotMap->TryRemove(requestMap, request->handle);
+    ++loadedCount;
+
+    if (request->OnLoaded != NULL)
+    {
+        request->OnLoaded(request->filePath, resource, request->param);
+    }
+    else if (resource != NULL)
+    {
+        ReleaseResource(request->type, resource);
+    }
+
+    if (ALoader->OnProgress != NULL)
+    {
+        ALoader->OnProgress(loadedCount, totalCount);
+    }
+
+    TryResetProgress();
+
+    return true;
+}
+
+
+/**
+ * Called by Drain in main thread, the Job of request has completed.
+ */
+static void OnCompleted(void* elementPtr, void* context)
+{
+    LoaderRequest* request = *(LoaderRequest**) elementPtr;
+
+    if (request->isCancel)
+    {
+        ReleaseRequest(request);
+    }
+    else
+    {
+        request->state = LoaderState_Finishing;
+        AArrayList_Add(finishingList, request);
+    }
+}
+
+
+static void Update(float deltaSeconds)
+{
+    if (runningCount == 0 && requestMap->elementList->size == 0)
+    {
+        return;
+    }
+
+    double startSeconds = GetSeconds();
+
+    if (completedQueue->data == NULL)
+    {
+        AMPMCQueue->Init(sizeof(LoaderRequest*), AJob->GetWorkerCount(), completedQueue);
+    }
+
+    // collect completed Jobs
+    runningCount -= AMPMCQueue->Drain(completedQueue, runningCount, OnCompleted, NULL);
+
+    // keep the Jobs no more than workers, so the higher priority request can run first
+    while (pendingList->size > 0 && runningCount < AJob->GetWorkerCount())
+    {
+        int            topIndex = GetTopIndex(pendingList);
+        LoaderRequest* request  = AArrayList_Get(pendingList, topIndex, LoaderRequest*);
+        AArrayList->RemoveByLast(pendingList, topIndex);
+
+        if (IsCached(request))
+        {
+            request->state = LoaderState_Finishing;
+            AArrayList_Add(finishingList, request);
+        }
+        else
+        {
+            request->state = LoaderState_Running;
+            AJob->Detach(AJob->Run(LoadInJob, request));
+            ++runningCount;
+        }
+    }
+
+    // create resources in frame budget
+    while (finishingList->size > 0)
+    {
+        int            topIndex = GetTopIndex(finishingList);
+        LoaderRequest* request  = AArrayList_Get(finishingList, topIndex, LoaderRequest*);
+
+        if (FinishStep(request))
+        {
+            // OnLoaded may change finishingList
+            TryRemoveFromList(finishingList, request);
+            ReleaseRequest(request);
+        }
+
+        if (GetSeconds() - startSeconds >= ALoader->frameBudgetSeconds)
+        {
+            break;
+        }
+    }
+}
+
+
+struct ALoader ALoader[1] =
+{{
+    0.004f,
+    NULL,
+    Load,
+    Cancel,
+    CancelAll,
+    GetProgress,
+    Update,
+}};
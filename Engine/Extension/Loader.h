@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#ifndef LOADER_H
+#define LOADER_H
+
+
+#include <stdbool.h>
+#include "Engine/Toolkit/Utils/SlotMap.h"
+
+
+/**
+ * The type of resource loaded by ALoader, and which Get of resource manager is finally called.
+ */
+typedef enum
+{
+    /**
+     * ATexture->Get, the resource is Texture*.
+     */
+    LoaderType_Texture,
+
+    /**
+     * ATextureAtlas->Get, the resource is TextureAtlas*.
+     */
+    LoaderType_TextureAtlas,
+
+    /**
+     * ASkeletonData->Get, the resource is SkeletonData*.
+     */
+    LoaderType_SkeletonData,
+
+    /**
+     * AFont->Get, the resource is Font* that is created for each load.
+     */
+    LoaderType_Font,
+
+    /**
+     * AAudio->GetPlayer, the resource is AudioPlayer*, and it is only created in main thread.
+     */
+    LoaderType_AudioPlayer,
+}
+LoaderType;
+
+
+/**
+ * Callback in main thread when resource loaded.
+ *
+ * filePath: same as the filePath of ALoader->Load
+ * resource: the type of resource is by LoaderType, and OnLoaded owns the reference that needs to Release,
+ *           NULL if the compiled skeleton file is broken
+ * param   : same as the param of ALoader->Load
+ */
+typedef void (*LoaderOnLoaded)  (const char* filePath, void* resource, void* param);
+
+
+/**
+ * Callback in main thread when one resource loaded.
+ *
+ * loadedCount: the count of loaded resources since ALoader idle
+ * totalCount : the count of requested resources since ALoader idle, not include canceled ones
+ */
+typedef void (*LoaderOnProgress)(int loadedCount, int totalCount);
+
+
+/**
+ * Load resources asynchronously, the file read, decompression, json parse and PNG decode run in AJob workers
+ * (the pre-decoded texture file is only mapped),
+ * then the texture upload and resource creation run in ALoader->Update with frameBudgetSeconds.
+ *
+ * important: APack cannot mount or unmount when ALoader is loading.
+ */
+struct ALoader
+{
+    /**
+     * The max seconds of resource creation in one frame, default 0.004f.
+     * at least one step runs in each frame, and one step is one texture upload or one resource creation.
+     */
+    float            frameBudgetSeconds;
+
+    /**
+     * Default NULL.
+     */
+    LoaderOnProgress OnProgress;
+
+    /**
+     * Request to load resource by filePath that same as the Get of resource manager.
+     * the higher priority loads first, and the same priority loads by request order.
+     * if resource already cached, it only calls OnLoaded in ALoader->Update.
+     *
+     * OnLoaded: can be NULL, then the resource is released and kept in cache unused
+     * param   : pass to OnLoaded
+     *
+     * return the handle of request that can be canceled.
+     *
+     * filePath:
+     *     Android: assets
+     *     IOS    : NSBundle
+     */
+    SlotMapHandle    (*Load)       (
+                                       LoaderType     type,
+                                       const char*    filePath,
+                                       int            priority,
+                                       LoaderOnLoaded OnLoaded,
+                                       void*          param
+                                   );
+
+    /**
+     * Cancel request by handle, and OnLoaded will not be called.
+     * the uploaded textures of request are kept in ATexture cache.
+     *
+     * return true success, false handle is invalid or request finished.
+     */
+    bool             (*Cancel)     (SlotMapHandle handle);
+
+    /**
+     * Cancel all requests.
+     */
+    void             (*CancelAll)  (void);
+
+    /**
+     * Get the progress in [0.0, 1.0] of requests since ALoader idle, and 1.0 means idle.
+     */
+    float            (*GetProgress)(void);
+
+    /**
+     * Every frame update by loop.
+     */
+    void             (*Update)     (float deltaSeconds);
+};
+
+
+extern struct ALoader ALoader[1];
+
+
+#endif
@@ -9,15 +9,17 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Styleate.
  *
  * Since    : 2013-7-3
- * Update   : 2019-2-14
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
 
+#include <string.h>
 #include "Engine/Extension/Spine/Skeleton.h"
 #include "Engine/Toolkit/HeaderUtils/Struct.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Toolkit/HeaderUtils/Define.h"
+#include "Engine/Toolkit/Utils/Atom.h"
 #include "Engine/Extension/Spine/SkeletonTimeline.h"
 #include "Engine/Graphics/OpenGL/SubMesh.h"
 
@@ -45,11 +47,8 @@ static inline SubMesh* GetAttachmentSubMesh(Skeleton* skeleton, SkeletonAttachme
 
 static inline void InitBone(Skeleton* skeleton, SkeletonData* skeletonData)
 {
-    Drawable*    root              = skeleton->drawable;
-    ArrayStrMap* boneMap           = skeleton->boneMap;
-
+    Drawable* root                 = skeleton->drawable;
     skeleton->boneArr              = AArray->Create(sizeof(SkeletonBone), skeletonData->boneDataOrderArr->length);
-    AArrayStrMap->InitWithCapacity(sizeof(SkeletonBone*), skeletonData->boneDataOrderArr->length, boneMap);
 
     SkeletonBone*      bones       = skeleton->boneArr->data;
     SkeletonBoneData** bonesData   = skeletonData->boneDataOrderArr->data;
@@ -60,19 +59,21 @@ static inline void InitBone(Skeleton* skeleton, SkeletonData* skeletonData)
         SkeletonBone*     bone     = bones + i;
         ASkeletonBone->Init(boneData, bone);
 
-        AArrayStrMap_TryPut(boneMap, boneData->name, bone);
-
         if (boneData->parent == NULL)
         {
             ADrawable_SetParent(bone->drawable, root);
         }
         else
         {
-            SkeletonBone* boneParent = AArrayStrMap_Get(boneMap, boneData->parent->name, SkeletonBone*);
-
-            ALog_A(boneParent != NULL, "ASkeleton InitBone bone parent = %s, not found", boneData->parent->name);
+            ALog_A
+            (
+                boneData->parent->index < i,
+                "ASkeleton InitBone bone parent = %s, not found before bone = %s",
+                boneData->parent->name,
+                boneData->name
+            );
 
-            ADrawable_SetParent(bone->drawable, boneParent->drawable);
+            ADrawable_SetParent(bone->drawable, bones[boneData->parent->index].drawable);
         }
     }
 }
@@ -80,26 +81,17 @@ static inline void InitBone(Skeleton* skeleton, SkeletonData* skeletonData)
 
 static inline void InitSlot(Skeleton* skeleton, SkeletonData* skeletonData)
 {
-    ArrayStrMap*       slotMap       = skeleton->slotMap;
-
     skeleton->slotArr                = AArray->Create(sizeof(SkeletonSlot),  skeletonData->slotDataOrderArr->length);
     skeleton->slotOrderArr           = AArray->Create(sizeof(SkeletonSlot*), skeletonData->slotDataOrderArr->length);
 
-    AArrayStrMap->InitWithCapacity(sizeof(SkeletonSlot*), skeletonData->slotDataOrderArr->length, slotMap);
-
     SkeletonSlot**     slotOrders    = skeleton->slotOrderArr->data;
     SkeletonSlotData** slotsData     = skeletonData->slotDataOrderArr->data;
 
     for (int i = 0; i < skeleton->slotArr->length; ++i)
     {
-        SkeletonSlotData* slotData   = slotsData[i];
-        SkeletonSlot*     slot       = AArray_GetPtr(skeleton->slotArr, i, SkeletonSlot);
-
-        ASkeletonSlot->Init(slotData, skeleton, slot);
-
-        slotOrders[i]                = slot;
-
-        AArrayStrMap_TryPut(slotMap, slotData->name, slot);
+        SkeletonSlot* slot = AArray_GetPtr(skeleton->slotArr, i, SkeletonSlot);
+        ASkeletonSlot->Init(slotsData[i], skeleton, slot);
+        slotOrders[i]      = slot;
     }
 }
 
@@ -119,14 +111,14 @@ static void SetSkin(Skeleton* skeleton, const char* skinName)
     if (skeleton->curSkinData != skeleton->skeletonData->skinDataDefault)
     {
         // first invisible before skin
-        for (int i = 0; i < skeleton->curSkinData->slotAttachmentMap->elementList->size; ++i)
+        for (int i = 0; i < skeleton->curSkinData->slotAttachmentArr->length; ++i)
         {
-            SkeletonSlot* slot = AArrayStrMap_Get
-                                 (
-                                    skeleton->slotMap,
-                                    AArrayStrMap->GetKey(skeleton->curSkinData->slotAttachmentMap, i),
-                                    SkeletonSlot*
-                                 );
+            if (AArray_Get(skeleton->curSkinData->slotAttachmentArr, i, ArrayIntMap*) == NULL)
+            {
+                continue;
+            }
+
+            SkeletonSlot* slot = AArray_GetPtr(skeleton->slotArr, i, SkeletonSlot);
 
             if (slot->attachmentData != NULL)
             {
@@ -142,26 +134,17 @@ static void SetSkin(Skeleton* skeleton, const char* skinName)
         }
     }
 
-    for (int i = 0; i < skinData->slotAttachmentMap->elementList->size; ++i)
+    for (int i = 0; i < skinData->slotAttachmentArr->length; ++i)
     {
-        SkeletonSlot* slot = AArrayStrMap_Get
-                             (
-                                 skeleton->slotMap,
-                                 AArrayStrMap->GetKey(skinData->slotAttachmentMap, i),
-                                 SkeletonSlot*
-                             );
-
-        if (slot != NULL && slot->slotData->attachmentName != NULL)
+        SkeletonSlot* slot              = AArray_GetPtr(skeleton->slotArr,           i, SkeletonSlot);
+        ArrayIntMap*  attachmentDataMap = AArray_Get   (skinData->slotAttachmentArr, i, ArrayIntMap*);
+
+        if (attachmentDataMap != NULL && slot->slotData->attachmentName != NULL)
         {
             ASkeletonSlot->SetAttachmentData
             (
                 slot,
-                AArrayStrMap_Get
-                (
-                    AArrayStrMap_GetAt(skinData->slotAttachmentMap, i, ArrayStrMap*),
-                    slot->slotData->attachmentName,
-                    SkeletonAttachmentData*
-                )
+                ASkeletonData->GetAttachmentDataBySlotIndex(skinData, i, slot->slotData->attachmentNameAtom)
             );
         }
     }
@@ -188,22 +171,22 @@ static void ResetSlots(Skeleton* skeleton)
 }
 
 
-static SkeletonAttachmentData* GetAttachmentData(Skeleton* skeleton, const char* slotName, const char* attachmentName)
+static SkeletonAttachmentData* GetAttachmentDataBySlotIndex(Skeleton* skeleton, int slotIndex, int attachmentNameAtom)
 {
-    SkeletonAttachmentData* attachmentData = ASkeletonData->GetAttachmentDataBySkinData
+    SkeletonAttachmentData* attachmentData = ASkeletonData->GetAttachmentDataBySlotIndex
                                              (
                                                  skeleton->curSkinData,
-                                                 slotName,
-                                                 attachmentName
+                                                 slotIndex,
+                                                 attachmentNameAtom
                                              );
 
     if (attachmentData == NULL && skeleton->skeletonData->skinDataDefault != skeleton->curSkinData)
     {
-        attachmentData = ASkeletonData->GetAttachmentDataBySkinData
+        attachmentData = ASkeletonData->GetAttachmentDataBySlotIndex
                          (
                              skeleton->skeletonData->skinDataDefault,
-                             slotName,
-                             attachmentName
+                             slotIndex,
+                             attachmentNameAtom
                          );
     }
 
@@ -211,6 +194,26 @@ static SkeletonAttachmentData* GetAttachmentData(Skeleton* skeleton, const char*
 }
 
 
+static SkeletonAttachmentData* GetAttachmentData(Skeleton* skeleton, const char* slotName, const char* attachmentName)
+{
+    SkeletonSlotData* slotData           = AArrayStrMap_Get
+                                           (
+                                               skeleton->skeletonData->slotDataMap,
+                                               slotName,
+                                               SkeletonSlotData*
+                                           );
+    // the attachment names are all interned when SkeletonData loaded
+    int               attachmentNameAtom = AAtom->Find(attachmentName);
+
+    if (slotData == NULL || attachmentNameAtom == -1)
+    {
+        return NULL;
+    }
+
+    return GetAttachmentDataBySlotIndex(skeleton, slotData->index, attachmentNameAtom);
+}
+
+
 static void Release(Skeleton* skeleton)
 {
     free(skeleton->boneArr);
@@ -227,9 +230,8 @@ static void Release(Skeleton* skeleton)
         AMesh->Release(AArrayList_GetPtr(skeleton->meshList, j, Mesh));
     }
     
-    AArrayList  ->Release(skeleton->meshList);
-    AArrayStrMap->Release(skeleton->boneMap);
-    AArrayStrMap->Release(skeleton->slotMap);
+    AArrayList   ->Release(skeleton->meshList);
+    ASkeletonData->Release(skeleton->skeletonData);
 }
 
 
@@ -288,14 +290,18 @@ static void Draw(Drawable* drawable)
 }
 
 
-static inline void InitMeshList(Skeleton* skeleton, SkeletonData* skeletonData)
+/**
+ * Init the meshes of skeletonData that share the static data to the meshList of Skeletons.
+ */
+static inline void InitSharedMeshList(SkeletonData* skeletonData)
 {
-    AArrayList->InitWithCapacity(sizeof(Mesh), skeletonData->textureAtlas->textureList->size, skeleton->meshList);
+    ArrayList* meshList = skeletonData->meshList;
+    AArrayList->SetCapacity(meshList, skeletonData->textureAtlas->textureList->size);
 
     for (int i = 0; i < skeletonData->textureAtlas->textureList->size; ++i)
     {
         Texture* texture = AArrayList_Get      (skeletonData->textureAtlas->textureList, i, Texture*);
-        Mesh*    mesh    = AArrayList_GetPtrAdd(skeleton->meshList, Mesh);
+        Mesh*    mesh    = AArrayList_GetPtrAdd(meshList, Mesh);
 
         AMesh->Init(texture, mesh);
     }
@@ -323,7 +329,7 @@ static inline void InitMeshList(Skeleton* skeleton, SkeletonData* skeletonData)
                                                                      (
                                                                         AArrayList_GetPtr
                                                                         (
-                                                                            skeleton->meshList,
+                                                                            meshList,
                                                                             regionAttachmentData->meshIndex,
                                                                             Mesh
                                                                         ),
@@ -387,7 +393,7 @@ static inline void InitMeshList(Skeleton* skeleton, SkeletonData* skeletonData)
                           (
                               AArrayList_GetPtr
                               (
-                                  skeleton->meshList,
+                                  meshList,
                                   meshData->meshIndex,
                                   Mesh
                               ),
@@ -402,17 +408,41 @@ static inline void InitMeshList(Skeleton* skeleton, SkeletonData* skeletonData)
                     subMesh->drawable->height = meshData->height;
                 }
 
+                // the positions are computed by bones or timeline in each Skeleton
+                subMesh->isDynamicPosition = attachmentData->type == SkeletonAttachmentDataType_SkinnedMesh ||
+                                             meshData->isDeformed;
+
                 break;
             }
         }
+    }
 
-        // first born invisible
-        ADrawable_SetInvisible(subMesh->drawable);
+    for (int i = 0; i < meshList->size; ++i)
+    {
+        AMesh->GenerateSharedBuffer(AArrayList_GetPtr(meshList, i, Mesh));
     }
+}
+
 
-    for (int i = 0; i < skeleton->meshList->size; ++i)
+static inline void InitMeshList(Skeleton* skeleton, SkeletonData* skeletonData)
+{
+    if (skeletonData->meshList->size == 0)
     {
-        AMesh->GenerateBuffer(AArrayList_GetPtr(skeleton->meshList, i, Mesh));
+        InitSharedMeshList(skeletonData);
+    }
+
+    AArrayList->InitWithCapacity(sizeof(Mesh), skeletonData->meshList->size, skeleton->meshList);
+
+    for (int i = 0; i < skeletonData->meshList->size; ++i)
+    {
+        Mesh* mesh = AArrayList_GetPtrAdd(skeleton->meshList, Mesh);
+        AMesh->InitWithShared(AArrayList_GetPtr(skeletonData->meshList, i, Mesh), mesh);
+
+        for (int j = 0; j < mesh->childList->size; ++j)
+        {
+            // first born invisible
+            ADrawable_SetInvisible(AArrayList_Get(mesh->childList, j, SubMesh*)->drawable);
+        }
     }
 }
 
@@ -428,6 +458,9 @@ static void Init(SkeletonData* skeletonData, Skeleton* outSkeleton)
     outSkeleton->curSkinData       = outSkeleton->skeletonData->skinDataDefault;
     outSkeleton->FireSkeletonEvent = NULL;
 
+    // the skeletonData is shared by skeletons, and must not be evicted until all released
+    AResource->Retain(skeletonData->resourceRef);
+
     InitMeshList(outSkeleton, skeletonData);
     InitBone    (outSkeleton, skeletonData);
     InitSlot    (outSkeleton, skeletonData);
@@ -437,6 +470,80 @@ static void Init(SkeletonData* skeletonData, Skeleton* outSkeleton)
 }
 
 
+/**
+ * Get the drawable of outSkeleton that same as the parent drawable in prototype.
+ */
+static inline Drawable* GetCloneParent(Skeleton* prototype, Skeleton* outSkeleton, Drawable* parent)
+{
+    if (parent == prototype->drawable)
+    {
+        return outSkeleton->drawable;
+    }
+
+    SkeletonBone* bones = prototype->boneArr->data;
+
+    if (parent >= bones->drawable && parent < (bones + prototype->boneArr->length)->drawable)
+    {
+        return AArray_GetPtr(outSkeleton->boneArr, (SkeletonBone*) parent - bones, SkeletonBone)->drawable;
+    }
+
+    return parent;
+}
+
+
+static void Clone(Skeleton* prototype, Skeleton* outSkeleton)
+{
+    // the skeletonData, skin and callback are same as prototype
+    *outSkeleton = *prototype;
+
+    AUserData_Init     (outSkeleton->drawable->userData);
+    ADrawable_SetParent(outSkeleton->drawable, NULL);
+    AResource->Retain  (outSkeleton->skeletonData->resourceRef);
+
+    Array* boneArr            = prototype->boneArr;
+    Array* slotArr            = prototype->slotArr;
+
+    outSkeleton->boneArr      = AArray->Create(sizeof(SkeletonBone),  boneArr->length);
+    outSkeleton->slotArr      = AArray->Create(sizeof(SkeletonSlot),  slotArr->length);
+    outSkeleton->slotOrderArr = AArray->Create(sizeof(SkeletonSlot*), slotArr->length);
+
+    memcpy(outSkeleton->boneArr->data, boneArr->data, boneArr->length * sizeof(SkeletonBone));
+    memcpy(outSkeleton->slotArr->data, slotArr->data, slotArr->length * sizeof(SkeletonSlot));
+
+    SkeletonBone*  bones           = outSkeleton->boneArr->data;
+    SkeletonSlot*  slots           = outSkeleton->slotArr->data;
+    SkeletonSlot** slotOrders      = outSkeleton->slotOrderArr->data;
+    SkeletonSlot*  prototypeSlots  = slotArr->data;
+    SkeletonSlot** prototypeOrders = prototype->slotOrderArr->data;
+
+    for (int i = 0; i < boneArr->length; ++i)
+    {
+        bones[i].drawable->parent = GetCloneParent(prototype, outSkeleton, bones[i].drawable->parent);
+    }
+
+    for (int i = 0; i < slotArr->length; ++i)
+    {
+        slots[i].skeleton = outSkeleton;
+        slots[i].bone     = bones + slots[i].slotData->boneData->index;
+        slotOrders[i]     = slots + (prototypeOrders[i] - prototypeSlots);
+    }
+
+    AArrayList->InitWithCapacity(sizeof(Mesh), prototype->meshList->size, outSkeleton->meshList);
+
+    for (int i = 0; i < prototype->meshList->size; ++i)
+    {
+        Mesh* mesh = AArrayList_GetPtrAdd(outSkeleton->meshList, Mesh);
+        AMesh->Clone(AArrayList_GetPtr(prototype->meshList, i, Mesh), mesh);
+
+        for (int j = 0; j < mesh->childList->size; ++j)
+        {
+            Drawable* drawable = AArrayList_Get(mesh->childList, j, SubMesh*)->drawable;
+            drawable->parent   = GetCloneParent(prototype, outSkeleton, drawable->parent);
+        }
+    }
+}
+
+
 static Skeleton* Create(SkeletonData* skeletonData)
 {
     Skeleton* skeleton = malloc(sizeof(Skeleton));
@@ -450,11 +557,13 @@ struct ASkeleton ASkeleton[1] =
 {{
     Create,
     Init,
+    Clone,
     Release,
     SetSkin,
     ResetBones,
     ResetSlots,
     GetAttachmentData,
+    GetAttachmentDataBySlotIndex,
     GetAttachmentSubMesh,
     Apply,
 }};
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-7-2
- * Update   : 2019-2-14
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -38,20 +38,27 @@ struct Skeleton
     /**
      * The base class for provide draw functions.
      */
-    Drawable                             drawable[1];
-    ArrayStrMap(boneName, SkeletonBone*) boneMap [1];
-    ArrayStrMap(slotName, SkeletonSlot*) slotMap [1];
+    Drawable              drawable[1];
+    SkeletonData*         skeletonData;
+    SkeletonSkinData*     curSkinData;
 
-    SkeletonData*                        skeletonData;
-    SkeletonSkinData*                    curSkinData;
-    Array(SkeletonBone)*                 boneArr;
-    Array(SkeletonSlot)*                 slotArr;
-    Array(SkeletonSlot*)*                slotOrderArr;
+    /**
+     * The bones in order of SkeletonData's boneDataOrderArr,
+     * and find by name with boneDataMap of SkeletonData that shared by skeletons.
+     */
+    Array(SkeletonBone)*  boneArr;
+
+    /**
+     * The slots in order of SkeletonData's slotDataOrderArr,
+     * and find by name with slotDataMap of SkeletonData that shared by skeletons.
+     */
+    Array(SkeletonSlot)*  slotArr;
+    Array(SkeletonSlot*)* slotOrderArr;
 
     /**
      * The meshes that Skeleton needs to use.
      */
-    ArrayList(Mesh)                      meshList[1];
+    ArrayList(Mesh)       meshList[1];
 
     /**
      * If not NULL, callback when SkeletonEvent fired.
@@ -67,6 +74,15 @@ struct ASkeleton
 {
     Skeleton*               (*Create)              (SkeletonData* skeletonData);
     void                    (*Init)                (SkeletonData* skeletonData, Skeleton*   outSkeleton);
+
+    /**
+     * Init outSkeleton by copying the bones, slots, skin, draw order and meshes of prototype,
+     * without the setup pose and mesh buffer generating, so it is much faster than Init.
+     *
+     * the drawable of outSkeleton copies the prototype's, but has no parent and userData.
+     */
+    void                    (*Clone)               (Skeleton*     prototype,    Skeleton*   outSkeleton);
+
     void                    (*Release)             (Skeleton*     skeleton);
     void                    (*SetSkin)             (Skeleton*     skeleton,     const char* skinName);
 
@@ -92,6 +108,16 @@ struct ASkeleton
                                                        const char* attachmentName
                                                    );
 
+    /**
+     * Same as GetAttachmentData,
+     * but find by slot index in SkeletonData's slotDataOrderArr and atom of slot attachment name.
+     */
+    SkeletonAttachmentData* (*GetAttachmentDataBySlotIndex)(
+                                                               Skeleton* skeleton,
+                                                               int       slotIndex,
+                                                               int       attachmentNameAtom
+                                                           );
+
     /**
      * Get SubMesh in Mesh that bind in SkeletonAttachmentData.
      */
@@ -126,6 +152,16 @@ static inline void ASkeleton_Draw(Skeleton* skeleton)
 }
 
 
+/**
+ * Get SkeletonBone by boneName, return NULL if not found.
+ */
+static inline SkeletonBone* ASkeleton_GetBone(Skeleton* skeleton, const char* boneName)
+{
+    SkeletonBoneData* boneData = AArrayStrMap_Get(skeleton->skeletonData->boneDataMap, boneName, SkeletonBoneData*);
+    return boneData != NULL ? AArray_GetPtr(skeleton->boneArr, boneData->index, SkeletonBone) : NULL;
+}
+
+
 /**
  * Get SkeletonAnimationData by animationName.
  */
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-7-28
- * Update   : 2019-2-14
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -17,15 +17,67 @@
 #include <math.h>
 #include "Engine/Toolkit/HeaderUtils/UserData.h"
 #include "Engine/Extension/Spine/SkeletonAnimationPlayer.h"
+#include "Engine/Extension/Spine/SkeletonBakedAnimation.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Graphics/OpenGL/GLPrimitive.h"
 
 
+/**
+ * Apply animationData by baked samples in baked mode, else by timelines.
+ */
+static inline void ApplyAnimation
+(
+    SkeletonAnimationPlayer* player,
+    SkeletonAnimationData*   animationData,
+    float                    time,
+    float                    mixPercent,
+    int*                     sampleIndex
+)
+{
+    if (player->bakeSampleRate > 0.0f)
+    {
+        *sampleIndex = ASkeletonBakedAnimation->Apply
+                       (
+                           animationData->bakedAnimation,
+                           player->skeleton,
+                           time,
+                           mixPercent,
+                           *sampleIndex
+                       );
+    }
+    else
+    {
+        ASkeleton->Apply(player->skeleton, animationData, time, mixPercent);
+    }
+}
+
+
+static inline void ApplyCurAnimation(SkeletonAnimationPlayer* player, float time, float mixPercent)
+{
+    ApplyAnimation(player, player->curAnimationData, time, mixPercent, &player->curSampleIndex);
+}
+
+
+static inline void ApplyPreAnimation(SkeletonAnimationPlayer* player, float time)
+{
+    ApplyAnimation(player, player->preAnimationData, time, 1.0f, &player->preSampleIndex);
+}
+
+
+static inline void BakeAnimation(SkeletonAnimationPlayer* player, SkeletonAnimationData* animationData)
+{
+    if (player->bakeSampleRate > 0.0f && animationData->bakedAnimation == NULL)
+    {
+        animationData->bakedAnimation = ASkeletonBakedAnimation->Create(animationData, player->bakeSampleRate);
+    }
+}
+
+
 static inline void UpdateNormal(SkeletonAnimationPlayer* player, float deltaSeconds)
 {
     if (player->curTime < player->curAnimationData->duration)
     {
-        ASkeleton->Apply(player->skeleton, player->curAnimationData, player->curTime, 1.0f);
+        ApplyCurAnimation(player, player->curTime, 1.0f);
         ASkeleton_Draw   (player->skeleton);
 
         player->curTime += deltaSeconds;
@@ -33,8 +85,8 @@ static inline void UpdateNormal(SkeletonAnimationPlayer* player, float deltaSeco
     }
     else
     {
-        ASkeleton->Apply(player->skeleton, player->curAnimationData, player->curAnimationData->duration, 1.0f);
-        ASkeleton_Draw  (player->skeleton);
+        ApplyCurAnimation(player, player->curAnimationData->duration, 1.0f);
+        ASkeleton_Draw   (player->skeleton);
 
         if (player->OnActionOver != NULL)
         {
@@ -57,12 +109,12 @@ static inline void UpdateMix(SkeletonAnimationPlayer* player, float deltaSeconds
 {
     if (player->preTime < player->preAnimationData->duration)
     {
-        ASkeleton->Apply(player->skeleton, player->preAnimationData, player->preTime, 1.0f);
+        ApplyPreAnimation(player, player->preTime);
         player->preTime += deltaSeconds;
     }
     else
     {
-        ASkeleton->Apply(player->skeleton, player->preAnimationData, player->preAnimationData->duration, 1.0f);
+        ApplyPreAnimation(player, player->preAnimationData->duration);
     }
 
     float mixPercent = player->mixTime / player->mixDuration;
@@ -78,15 +130,15 @@ static inline void UpdateMix(SkeletonAnimationPlayer* player, float deltaSeconds
 
     if (player->curTime < player->curAnimationData->duration)
     {
-        ASkeleton->Apply(player->skeleton, player->curAnimationData, player->curTime, mixPercent);
-        ASkeleton_Draw  (player->skeleton);
+        ApplyCurAnimation(player, player->curTime, mixPercent);
+        ASkeleton_Draw   (player->skeleton);
 
         player->curTime += deltaSeconds;
     }
     else
     {
-        ASkeleton->Apply(player->skeleton, player->curAnimationData, player->curAnimationData->duration, mixPercent);
-        ASkeleton_Draw  (player->skeleton);
+        ApplyCurAnimation(player, player->curAnimationData->duration, mixPercent);
+        ASkeleton_Draw   (player->skeleton);
 
         if (player->OnActionOver != NULL)
         {
@@ -134,18 +186,29 @@ static inline void InitSkeletonAnimationPlayer
         animationName
     );
 
-    player->curTime      = 0.0f;
-    player->preTime      = 0.0f;
-    player->mixTime      = 0.0f;
-    player->mixDuration  = 0.0f;
-    player->OnActionOver = NULL;
-    player->loop         = -1;
+    player->curTime        = 0.0f;
+    player->preTime        = 0.0f;
+    player->mixTime        = 0.0f;
+    player->mixDuration    = 0.0f;
+    player->bakeSampleRate = 0.0f;
+    player->curSampleIndex = -1;
+    player->preSampleIndex = -1;
+    player->OnActionOver   = NULL;
+    player->loop           = -1;
 
     //ASkeletonAnimationPlayer->Release(player);
     //ALog_A(0, "stop");
 }
 
 
+static void Clone(SkeletonAnimationPlayer* prototype, SkeletonAnimationPlayer* outPlayer)
+{
+    // the animation state and callback are same as prototype
+    *outPlayer = *prototype;
+    ASkeleton->Clone(prototype->skeleton, outPlayer->skeleton);
+}
+
+
 static void Release(SkeletonAnimationPlayer* player)
 {
     ASkeleton->Release(player->skeleton);
@@ -163,7 +226,10 @@ static void SetAnimation(SkeletonAnimationPlayer* player, const char* animationN
         animationName
     );
     
-    player->curTime = 0.0f;
+    player->curTime        = 0.0f;
+    player->curSampleIndex = -1;
+
+    BakeAnimation(player, player->curAnimationData);
 }
 
 
@@ -171,6 +237,8 @@ static void SetAnimationMix(SkeletonAnimationPlayer* player, const char* animati
 {
     player->preAnimationData = player->curAnimationData;
     player->preTime          = player->curTime;
+    player->preSampleIndex   = player->curSampleIndex;
+    player->curSampleIndex   = -1;
     player->curTime          = 0.0f;
     player->mixTime          = 0.0f;
     player->mixDuration      = mixDuration;
@@ -182,6 +250,23 @@ static void SetAnimationMix(SkeletonAnimationPlayer* player, const char* animati
         "SkeletonAnimationPlayer SetAnimationMix cannot find animationData by name = %s",
         animationName
     );
+
+    BakeAnimation(player, player->curAnimationData);
+}
+
+
+static void SetBakedMode(SkeletonAnimationPlayer* player, float sampleRate)
+{
+    player->bakeSampleRate = sampleRate;
+    player->curSampleIndex = -1;
+    player->preSampleIndex = -1;
+
+    BakeAnimation(player, player->curAnimationData);
+
+    if (player->preAnimationData != NULL)
+    {
+        BakeAnimation(player, player->preAnimationData);
+    }
 }
 
 
@@ -196,8 +281,12 @@ static SkeletonAnimationPlayer* CreateWithData(SkeletonData* skeletonData, const
 
 static SkeletonAnimationPlayer* Create(const char* jsonFilePath, const char* animationName)
 {
-    SkeletonAnimationPlayer* player = malloc(sizeof(SkeletonAnimationPlayer));
-    InitSkeletonAnimationPlayer(player, ASkeletonData->Get(jsonFilePath), animationName);
+    SkeletonAnimationPlayer* player       = malloc(sizeof(SkeletonAnimationPlayer));
+    SkeletonData*            skeletonData = ASkeletonData->Get(jsonFilePath);
+
+    InitSkeletonAnimationPlayer(player, skeletonData, animationName);
+    // the skeleton references the skeletonData
+    ASkeletonData->Release(skeletonData);
 
     return player;
 }
@@ -205,7 +294,11 @@ static SkeletonAnimationPlayer* Create(const char* jsonFilePath, const char* ani
 
 static void Init(const char* jsonFilePath, const char* animationName, SkeletonAnimationPlayer* outPlayer)
 {
-    InitSkeletonAnimationPlayer(outPlayer, ASkeletonData->Get(jsonFilePath), animationName);
+    SkeletonData* skeletonData = ASkeletonData->Get(jsonFilePath);
+
+    InitSkeletonAnimationPlayer(outPlayer, skeletonData, animationName);
+    // the skeleton references the skeletonData
+    ASkeletonData->Release(skeletonData);
 }
 
 
@@ -248,12 +341,14 @@ struct ASkeletonAnimationPlayer ASkeletonAnimationPlayer[1] =
     Create,
     CreateWithData,
     Init,
+    Clone,
 
     Release,
     Update,
 
     SetAnimation,
     SetAnimationMix,
+    SetBakedMode,
 
     InitSlotBoundingBoxDrawable,
  }};
\ No newline at end of file
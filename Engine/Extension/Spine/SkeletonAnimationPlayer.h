@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-7-28
- * Update   : 2019-2-13
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -70,6 +70,22 @@ struct SkeletonAnimationPlayer
      */
     float                  mixDuration;
 
+    /**
+     * The samples per second of baked mode, default 0.
+     * if positive then play the animation by SkeletonBakedAnimation, else by timelines.
+     */
+    float                  bakeSampleRate;
+
+    /**
+     * The curAnimationData sample index applied last time, -1 if not applied.
+     */
+    int                    curSampleIndex;
+
+    /**
+     * The preAnimationData sample index applied last time, -1 if not applied.
+     */
+    int                    preSampleIndex;
+
     /**
      * Callback when action over.
      */
@@ -105,6 +121,11 @@ struct ASkeletonAnimationPlayer
                                                    SkeletonAnimationPlayer* outPlayer
                                                );
     
+    /**
+     * Init outPlayer by ASkeleton->Clone prototype's skeleton, and copy the animation state of prototype.
+     */
+    void                     (*Clone)          (SkeletonAnimationPlayer* prototype, SkeletonAnimationPlayer* outPlayer);
+
     void                     (*Release)        (SkeletonAnimationPlayer*    player);
 
     /**
@@ -128,6 +149,15 @@ struct ASkeletonAnimationPlayer
                                                    float                    mixDuration
                                                );
 
+    /**
+     * Set player play animations by baked samples, the animation is baked once when first used,
+     * and the baked data is shared by all players of same SkeletonData, so that it suits many same skeletons.
+     *
+     * sampleRate: the samples per second, if 0 then play animations by timelines,
+     *             and the animation keeps the sampleRate that first baked.
+     */
+    void                     (*SetBakedMode)   (SkeletonAnimationPlayer* player, float sampleRate);
+
     /**
      * Init Drawable that can render slot bounding box with primitive call.
      */
@@ -147,7 +177,7 @@ extern struct ASkeletonAnimationPlayer ASkeletonAnimationPlayer[1];
  */
 static inline SkeletonBone* ASkeletonAnimationPlayer_GetBone(SkeletonAnimationPlayer* player, const char* boneName)
 {
-    return AArrayStrMap_Get(player->skeleton->boneMap, boneName, SkeletonBone*);
+    return ASkeleton_GetBone(player->skeleton, boneName);
 }
 
 
@@ -156,7 +186,10 @@ static inline SkeletonBone* ASkeletonAnimationPlayer_GetBone(SkeletonAnimationPl
  */
 static inline SkeletonSlot* ASkeletonAnimationPlayer_GetSlot(SkeletonAnimationPlayer* player, const char* slotName)
 {
-    return AArrayStrMap_Get(player->skeleton->slotMap, slotName, SkeletonSlot*);
+    Skeleton*         skeleton = player->skeleton;
+    SkeletonSlotData* slotData = AArrayStrMap_Get(skeleton->skeletonData->slotDataMap, slotName, SkeletonSlotData*);
+
+    return slotData != NULL ? AArray_GetPtr(skeleton->slotArr, slotData->index, SkeletonSlot) : NULL;
 }
 
 
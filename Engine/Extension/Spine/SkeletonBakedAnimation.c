@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <math.h>
+#include <stdlib.h>
+#include "Engine/Extension/Spine/SkeletonBakedAnimation.h"
+#include "Engine/Toolkit/Platform/Log.h"
+#include "Engine/Toolkit/Math/Math.h"
+
+
+/**
+ * The number of curve values of timeline, 0 means not curve timeline.
+ */
+static inline int GetCurveValueNum(SkeletonTimeline* timeline)
+{
+    switch (timeline->type)
+    {
+        case SkeletonTimelineType_Rotate:
+            return 1;
+
+        case SkeletonTimelineType_Translate:
+        case SkeletonTimelineType_Scale:
+            return 2;
+
+        case SkeletonTimelineType_Color:
+            return 4;
+
+        default:
+            return 0;
+    }
+}
+
+
+static inline bool IsStepTimeline(SkeletonTimeline* timeline)
+{
+    return timeline->type == SkeletonTimelineType_Attachment || timeline->type == SkeletonTimelineType_DrawOrder;
+}
+
+
+static inline float GetSampleTime(SkeletonBakedAnimation* bakedAnimation, int sampleIndex)
+{
+    return AMath_Min(sampleIndex / bakedAnimation->sampleRate, bakedAnimation->animationData->duration);
+}
+
+
+static void BakeCurveTrack(SkeletonBakedAnimation* bakedAnimation, SkeletonBakedTrack* track, int valueNum)
+{
+    float* samples = (float*) bakedAnimation->sampleArr->data + track->sampleOffset;
+    float  firstValues[4];
+
+    track->firstFrameTime = ASkeletonTimeline->GetFirstFrameTime(track->timeline);
+    ASkeletonTimeline->GetCurveValues(track->timeline, track->firstFrameTime, firstValues);
+
+    for (int i = 0; i < bakedAnimation->sampleCount; ++i)
+    {
+        float* values = samples + i * valueNum;
+
+        if (ASkeletonTimeline->GetCurveValues(track->timeline, GetSampleTime(bakedAnimation, i), values) == false)
+        {
+            // time is before first frame, and lerp to first frame if time is not before first frame
+            for (int j = 0; j < valueNum; ++j)
+            {
+                values[j] = firstValues[j];
+            }
+        }
+        else if (i > 0 && track->timeline->type == SkeletonTimelineType_Rotate)
+        {
+            // unwrap angle so that lerp between samples goes the short way
+            float amount = values[0] - values[-1];
+            values[0]    = values[-1] + (amount - floorf((amount + 180.0f) / 360.0f) * 360.0f);
+        }
+    }
+}
+
+
+static void BakeStepTrack(SkeletonBakedAnimation* bakedAnimation, SkeletonBakedTrack* track)
+{
+    int* frameIndexes     = (int*) bakedAnimation->frameIndexArr->data + track->sampleOffset;
+    track->firstFrameTime = ASkeletonTimeline->GetFirstFrameTime(track->timeline);
+
+    for (int i = 0; i < bakedAnimation->sampleCount; ++i)
+    {
+        frameIndexes[i] = ASkeletonTimeline->GetFrameIndex(track->timeline, GetSampleTime(bakedAnimation, i));
+    }
+}
+
+
+static SkeletonBakedAnimation* Create(SkeletonAnimationData* animationData, float sampleRate)
+{
+    ALog_A(sampleRate > 0.0f, "ASkeletonBakedAnimation Create sampleRate = %f must be positive", sampleRate);
+
+    SkeletonBakedAnimation*       bakedAnimation = malloc(sizeof(SkeletonBakedAnimation));
+    ArrayList(SkeletonTimeline*)* timelineArr    = animationData->timelineArr;
+    int                           trackCount     = 0;
+    int                           valueCount     = 0;
+    int                           stepCount      = 0;
+
+    bakedAnimation->animationData = animationData;
+    bakedAnimation->sampleRate    = sampleRate;
+    bakedAnimation->sampleCount   = (int) ceilf(animationData->duration * sampleRate) + 1;
+
+    AArrayList->Init(sizeof(SkeletonTimeline*), bakedAnimation->timelineArr);
+
+    for (int i = 0; i < timelineArr->size; ++i)
+    {
+        SkeletonTimeline* timeline = AArrayList_Get(timelineArr, i, SkeletonTimeline*);
+        int               valueNum = GetCurveValueNum(timeline);
+
+        if (valueNum > 0)
+        {
+            ++trackCount;
+            valueCount += valueNum;
+        }
+        else if (IsStepTimeline(timeline))
+        {
+            ++trackCount;
+            ++stepCount;
+        }
+        else
+        {
+            AArrayList_Add(bakedAnimation->timelineArr, timeline);
+        }
+    }
+
+    bakedAnimation->trackArr      = AArray->Create(sizeof(SkeletonBakedTrack), trackCount);
+    bakedAnimation->sampleArr     = AArray->Create(sizeof(float), valueCount * bakedAnimation->sampleCount);
+    bakedAnimation->frameIndexArr = AArray->Create(sizeof(int),   stepCount  * bakedAnimation->sampleCount);
+
+    int trackIndex  = 0;
+    int valueOffset = 0;
+    int stepOffset  = 0;
+
+    for (int i = 0; i < timelineArr->size; ++i)
+    {
+        SkeletonTimeline*   timeline = AArrayList_Get(timelineArr, i, SkeletonTimeline*);
+        int                 valueNum = GetCurveValueNum(timeline);
+        SkeletonBakedTrack* track;
+
+        if (valueNum > 0)
+        {
+            track               = AArray_GetPtr(bakedAnimation->trackArr, trackIndex++, SkeletonBakedTrack);
+            track->timeline     = timeline;
+            track->sampleOffset = valueOffset;
+            valueOffset        += valueNum * bakedAnimation->sampleCount;
+
+            BakeCurveTrack(bakedAnimation, track, valueNum);
+        }
+        else if (IsStepTimeline(timeline))
+        {
+            track               = AArray_GetPtr(bakedAnimation->trackArr, trackIndex++, SkeletonBakedTrack);
+            track->timeline     = timeline;
+            track->sampleOffset = stepOffset;
+            stepOffset         += bakedAnimation->sampleCount;
+
+            BakeStepTrack(bakedAnimation, track);
+        }
+    }
+
+    bakedAnimation->memorySize = (int) sizeof(SkeletonBakedAnimation)                                               +
+                                 (int) sizeof(Array) * 3                                                            +
+                                 bakedAnimation->trackArr->length                * (int) sizeof(SkeletonBakedTrack) +
+                                 bakedAnimation->sampleArr->length               * (int) sizeof(float)              +
+                                 bakedAnimation->frameIndexArr->length           * (int) sizeof(int)                +
+                                 bakedAnimation->timelineArr->elementArr->length * (int) sizeof(SkeletonTimeline*);
+
+    ALog_D
+    (
+        "ASkeletonBakedAnimation Create animation = %s, samples = %d, tracks = %d, memory = %d",
+        animationData->name,
+        bakedAnimation->sampleCount,
+        trackCount,
+        bakedAnimation->memorySize
+    );
+
+    return bakedAnimation;
+}
+
+
+static void Release(SkeletonBakedAnimation* bakedAnimation)
+{
+    free(bakedAnimation->trackArr);
+    free(bakedAnimation->sampleArr);
+    free(bakedAnimation->frameIndexArr);
+    AArrayList->Release(bakedAnimation->timelineArr);
+
+    bakedAnimation->trackArr      = NULL;
+    bakedAnimation->sampleArr     = NULL;
+    bakedAnimation->frameIndexArr = NULL;
+    bakedAnimation->animationData = NULL;
+}
+
+
+static int Apply(SkeletonBakedAnimation* bakedAnimation, Skeleton* skeleton, float time, float mixPercent, int preSampleIndex)
+{
+    int   lastIndex   = bakedAnimation->sampleCount - 1;
+    int   sampleIndex = AMath_Min((int) (time * bakedAnimation->sampleRate), lastIndex);
+    int   nextIndex   = AMath_Min(sampleIndex + 1, lastIndex);
+    float sampleTime  = GetSampleTime(bakedAnimation, sampleIndex);
+    float nextTime    = GetSampleTime(bakedAnimation, nextIndex);
+    float percent     = nextTime > sampleTime ? AMath_Min((time - sampleTime) / (nextTime - sampleTime), 1.0f) : 0.0f;
+    // the step tracks use the floor sample, which holds the key frame at or before time like timeline
+    int   stepIndex   = percent < 1.0f ? sampleIndex : nextIndex;
+    float values[4];
+
+    if (preSampleIndex > lastIndex)
+    {
+        preSampleIndex = -1;
+    }
+
+    for (int i = 0; i < bakedAnimation->trackArr->length; ++i)
+    {
+        SkeletonBakedTrack* track = AArray_GetPtr(bakedAnimation->trackArr, i, SkeletonBakedTrack);
+
+        if (time < track->firstFrameTime)
+        {
+            continue;
+        }
+
+        if (IsStepTimeline(track->timeline))
+        {
+            int* frameIndexes = (int*) bakedAnimation->frameIndexArr->data + track->sampleOffset;
+            int  frameIndex   = frameIndexes[stepIndex];
+
+            // same as the preFrameIndex of timeline, only apply the changed key frame
+            if (frameIndex != -1 && (preSampleIndex == -1 || frameIndexes[preSampleIndex] != frameIndex))
+            {
+                ASkeletonTimeline->ApplyFrame(track->timeline, skeleton, frameIndex);
+            }
+        }
+        else
+        {
+            int    valueNum = GetCurveValueNum(track->timeline);
+            float* samples  = (float*) bakedAnimation->sampleArr->data + track->sampleOffset;
+            float* from     = samples + sampleIndex * valueNum;
+            float* to       = samples + nextIndex   * valueNum;
+
+            for (int j = 0; j < valueNum; ++j)
+            {
+                values[j] = from[j] + (to[j] - from[j]) * percent;
+            }
+
+            ASkeletonTimeline->ApplyCurveValues(track->timeline, skeleton, time, values, mixPercent);
+        }
+    }
+
+    for (int i = 0; i < bakedAnimation->timelineArr->size; ++i)
+    {
+        SkeletonTimeline* timeline = AArrayList_Get(bakedAnimation->timelineArr, i, SkeletonTimeline*);
+        timeline->Apply(timeline, skeleton, time, mixPercent);
+    }
+
+    return stepIndex;
+}
+
+
+struct ASkeletonBakedAnimation ASkeletonBakedAnimation[1] =
+{{
+    Create,
+    Release,
+    Apply,
+}};
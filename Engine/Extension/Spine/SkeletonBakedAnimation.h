@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef SKELETON_BAKED_ANIMATION_H
+#define SKELETON_BAKED_ANIMATION_H
+
+
+#include "Engine/Extension/Spine/SkeletonData.h"
+#include "Engine/Extension/Spine/SkeletonTimeline.h"
+
+
+/**
+ * The baked samples of one SkeletonTimeline.
+ */
+typedef struct
+{
+    SkeletonTimeline* timeline;
+
+    /**
+     * The time of first key frame, the time before it has no effect same as the timeline.
+     */
+    float             firstFrameTime;
+
+    /**
+     * The offset of samples in sampleArr of SkeletonBakedAnimation.
+     *
+     * Rotate, Translate, Scale and Color: each sample has the values of ASkeletonTimeline->GetCurveValues in sampleArr.
+     * Attachment and DrawOrder          : each sample has the key frame index in frameIndexArr.
+     */
+    int               sampleOffset;
+}
+SkeletonBakedTrack;
+
+
+/**
+ * The SkeletonAnimationData sampled at fixed sample rate,
+ * so the playing only needs the sample index and lerp between samples, without searching key frames and curves.
+ */
+struct SkeletonBakedAnimation
+{
+    SkeletonAnimationData*       animationData;
+
+    /**
+     * The samples per second.
+     */
+    float                        sampleRate;
+
+    /**
+     * The samples of each track, the last sample is at animation duration.
+     */
+    int                          sampleCount;
+
+    Array(SkeletonBakedTrack)*   trackArr;
+
+    /**
+     * The curve values of all Rotate, Translate, Scale and Color tracks.
+     */
+    Array(float)*                sampleArr;
+
+    /**
+     * The key frame index of all Attachment and DrawOrder tracks, -1 means before first key frame.
+     */
+    Array(int)*                  frameIndexArr;
+
+    /**
+     * The timelines that not baked, such as Event and Deform, which are applied by time.
+     */
+    ArrayList(SkeletonTimeline*) timelineArr[1];
+
+    /**
+     * The bytes of all baked data, for budget the memory of baked animations.
+     */
+    int                          memorySize;
+};
+
+
+/**
+ * Control and manage SkeletonBakedAnimation.
+ */
+struct ASkeletonBakedAnimation
+{
+    /**
+     * Bake animationData by sampling all Rotate, Translate, Scale, Color, Attachment and DrawOrder timelines.
+     * sampleRate: the samples per second.
+     */
+    SkeletonBakedAnimation* (*Create) (SkeletonAnimationData* animationData, float sampleRate);
+    void                    (*Release)(SkeletonBakedAnimation* bakedAnimation);
+
+    /**
+     * Apply the samples at time to skeleton, same as ASkeleton->Apply.
+     *
+     * the curve tracks lerp between samples, the Attachment and DrawOrder tracks use the key frame of floor sample,
+     * and only apply when the key frame index is changed from the sample of preSampleIndex,
+     * the preSampleIndex is -1 if not applied this bakedAnimation before.
+     *
+     * return the floor sample index of time, as the preSampleIndex of next Apply.
+     */
+    int                     (*Apply)  (
+                                          SkeletonBakedAnimation* bakedAnimation,
+                                          Skeleton*               skeleton,
+                                          float                   time,
+                                          float                   mixPercent,
+                                          int                     preSampleIndex
+                                      );
+};
+
+
+extern struct ASkeletonBakedAnimation ASkeletonBakedAnimation[1];
+
+
+#endif
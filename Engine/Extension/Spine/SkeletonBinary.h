@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef SKELETON_BINARY_H
+#define SKELETON_BINARY_H
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+
+/**
+ * The header of compiled skeleton file, which is made from Spine JSON by the build tool SkeletonCompiler.
+ *
+ * the body follows the string table, and it is a stream of 4 bytes little endian words (int or float),
+ * so every block of floats, ints and shorts (padded to 4 bytes) is aligned and can be used in place.
+ *
+ * string: the offset of '\0' terminated string from file start, 0 means NULL.
+ * index : the index of bone, slot or attachment in file order, -1 means NULL.
+ * curve : 5 words of SkeletonBinaryCurve, cx1, cy1, cx2, cy2.
+ *
+ * the positions are raw values of JSON, and scaled by ASkeletonData->scale then converted to GL at load time.
+ * the mesh vertices are x, y, 0 for each vertex same as the loaded data.
+ *
+ * body:
+ *     width, height
+ *     boneCount, [string name, index parent, length, x, y, rotation, scaleX, scaleY, inheritScale, inheritRotation]
+ *     slotCount, [string name, string attachmentName, index bone, r, g, b, a, additive]
+ *     eventCount, [string name, string stringValue, intValue, floatValue]
+ *     skinCount, [string name, skinSlotCount, [index slot, attachmentCount, [string key, string name, type, ...]]]
+ *         Region     : x, y, rotation, scaleX, scaleY, width, height
+ *         BoundingBox: vertexCount, vertices
+ *         Mesh       : width, height, vertexCount, uvCount, triangleCount, vertices, uvs, triangles
+ *         SkinnedMesh: width, height, vertexCount, weightVertexCount, boneCount, weightCount, uvCount, triangleCount,
+ *                      vertices(zeros), weightVertices, bones, weights, uvs, triangles
+ *     animationCount, [string name, duration, timelineCount, [type, ...]]
+ *         Rotate     : index bone, frameCount, frames [time, angle],      curves
+ *         Translate  : index bone, frameCount, frames [time, x, y],       curves
+ *         Scale      : index bone, frameCount, frames [time, x, y],       curves
+ *         Color      : index slot, frameCount, frames [time, r, g, b, a], curves
+ *         Attachment : index slot, frameCount, times, [string attachmentName]
+ *         Event      : frameCount, times, [string name, string stringValue, intValue, floatValue]
+ *         DrawOrder  : frameCount, times, [hasDrawOrder, slotCount slot indices if hasDrawOrder]
+ *         Deform     : index slot, index attachment, frameCount, times, curves, [offset, count, vertices(x, y)]
+ */
+typedef struct
+{
+    /**
+     * Always ASkeletonBinary_Magic.
+     */
+    char     magic[4];
+
+    /**
+     * Always ASkeletonBinary_Version.
+     */
+    uint32_t version;
+
+    /**
+     * The bytes of whole file.
+     */
+    uint32_t length;
+
+    /**
+     * The offset of body from file start.
+     */
+    uint32_t bodyOffset;
+}
+SkeletonBinaryHeader;
+
+
+/**
+ * The attachment type in compiled skeleton file.
+ */
+typedef enum
+{
+    SkeletonBinaryAttachment_Region,
+    SkeletonBinaryAttachment_Mesh,
+    SkeletonBinaryAttachment_SkinnedMesh,
+    SkeletonBinaryAttachment_BoundingBox,
+}
+SkeletonBinaryAttachment;
+
+
+/**
+ * The timeline type in compiled skeleton file.
+ */
+typedef enum
+{
+    SkeletonBinaryTimeline_Rotate,
+    SkeletonBinaryTimeline_Translate,
+    SkeletonBinaryTimeline_Scale,
+    SkeletonBinaryTimeline_Color,
+    SkeletonBinaryTimeline_Attachment,
+    SkeletonBinaryTimeline_Event,
+    SkeletonBinaryTimeline_DrawOrder,
+    SkeletonBinaryTimeline_Deform,
+}
+SkeletonBinaryTimeline;
+
+
+/**
+ * The curve type of one frame in compiled skeleton file.
+ */
+typedef enum
+{
+    /**
+     * The curve is not set, such as unknown curve string in JSON.
+     */
+    SkeletonBinaryCurve_None,
+    SkeletonBinaryCurve_Linear,
+    SkeletonBinaryCurve_Stepped,
+    SkeletonBinaryCurve_Bezier,
+}
+SkeletonBinaryCurve;
+
+
+#define ASkeletonBinary_Magic   "MSKL"
+#define ASkeletonBinary_Version 1
+
+
+/**
+ * The words of one curve.
+ */
+#define ASkeletonBinary_CurveSize 5
+
+
+/**
+ * Whether the data is compiled skeleton file which can be loaded by this version.
+ */
+static inline bool ASkeletonBinary_IsValid(const void* data, long length)
+{
+    const SkeletonBinaryHeader* header = data;
+
+    return data           != NULL                                                   &&
+           length         >= (long) sizeof(SkeletonBinaryHeader)                    &&
+           memcmp(header->magic, ASkeletonBinary_Magic, sizeof(header->magic)) == 0 &&
+           header->version == ASkeletonBinary_Version                               &&
+           header->length  <= (uint64_t) length;
+}
+
+
+#endif
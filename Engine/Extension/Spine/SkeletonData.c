@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-6-27
- * Update   : 2019-2-13
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -19,21 +19,27 @@
 #include <stdlib.h>
 #include "Engine/Toolkit/Utils/Json.h"
 #include "Engine/Toolkit/Utils/ArrayStrMap.h"
+#include "Engine/Toolkit/Utils/HashStrMap.h"
+#include "Engine/Toolkit/Utils/Atom.h"
 #include "Engine/Extension/Spine/SkeletonData.h"
+#include "Engine/Extension/Spine/SkeletonBinary.h"
 #include "Engine/Toolkit/Utils/Json.h"
+#include "Engine/Toolkit/Utils/FileTool.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Extension/Spine/SkeletonTimeline.h"
+#include "Engine/Extension/Spine/SkeletonBakedAnimation.h"
 #include "Engine/Graphics/OpenGL/GLTool.h"
+#include "Engine/Toolkit/HeaderUtils/Struct.h"
 
 
-static ArrayStrMap(filePath, SkeletonData*) skeletonDataMap[1] = AArrayStrMap_Init(SkeletonData*, 20);
+static HashStrMap(filePath, SkeletonData*) skeletonDataMap[1] = AHashStrMap_Init(SkeletonData*, 20);
 
 
-static void Release(SkeletonData* skeletonData)
+/**
+ * Release the parsed data of bones, slots, events, skins and animations.
+ */
+static void ReleaseData(SkeletonData* skeletonData)
 {
-    bool isRemoved = AArrayStrMap->TryRemove(skeletonDataMap, skeletonData->filePath);
-    ALog_A(isRemoved, "ASkeletonData Release not found %s in skeletonDataMap", skeletonData->filePath);
-
     // bone data
     ArrayStrMap* boneDataMap = skeletonData->boneDataMap;
     for (int i = 0; i < boneDataMap->elementList->size; ++i)
@@ -73,23 +79,26 @@ static void Release(SkeletonData* skeletonData)
     ArrayStrMap* skinDataMap = skeletonData->skinDataMap;
     for (int i = 0; i < skinDataMap->elementList->size; ++i)
     {
-        SkeletonSkinData* skinData          = AArrayStrMap_GetAt(skinDataMap, i, SkeletonSkinData*);
-        ArrayStrMap*      slotAttachmentMap = skinData->slotAttachmentMap;
+        SkeletonSkinData* skinData = AArrayStrMap_GetAt(skinDataMap, i, SkeletonSkinData*);
 
-        for (int j = 0; j < slotAttachmentMap->elementList->size; ++j)
+        for (int j = 0; j < skinData->slotAttachmentArr->length; ++j)
         {
-            ArrayStrMap* attachmentDataMap = AArrayStrMap_GetAt(slotAttachmentMap, j, ArrayStrMap*);
+            ArrayIntMap* attachmentDataMap = AArray_Get(skinData->slotAttachmentArr, j, ArrayIntMap*);
 
-            for (int k = 0; k < attachmentDataMap->elementList->size; ++k)
+            if (attachmentDataMap != NULL)
             {
-                free(AArrayStrMap_GetAt(attachmentDataMap, k, SkeletonAttachmentData*)->childPtr);
-            }
+                for (int k = 0; k < attachmentDataMap->elementList->size; ++k)
+                {
+                    free(AArrayIntMap_GetAt(attachmentDataMap, k, SkeletonAttachmentData*)->childPtr);
+                }
 
-            AArrayStrMap->Release(attachmentDataMap);
-            free(attachmentDataMap);
+                AArrayIntMap->Release(attachmentDataMap);
+                free(attachmentDataMap);
+            }
         }
 
-        AArrayStrMap->Release(slotAttachmentMap);
+        free(skinData->slotAttachmentArr);
+        free(skinData);
     }
 
     AArrayStrMap->Release(skinDataMap);
@@ -116,33 +125,71 @@ static void Release(SkeletonData* skeletonData)
         }
         AArrayList->Release(timelineList);
 
+        if (animationData->bakedAnimation != NULL)
+        {
+            ASkeletonBakedAnimation->Release(animationData->bakedAnimation);
+            free(animationData->bakedAnimation);
+        }
+
         free(animationData);
     }
+    AArrayStrMap->Release(animationDataMap);
+}
+
+
+static void Evict(ResourceRef* ref)
+{
+    SkeletonData* skeletonData = AStruct_GetParentWithName(ref, SkeletonData, resourceRef);
+
+    bool isRemoved = AHashStrMap->TryRemove(skeletonDataMap, skeletonData->filePath);
+    ALog_A(isRemoved, "ASkeletonData Evict not found %s in skeletonDataMap", skeletonData->filePath);
+
+    ReleaseData(skeletonData);
 
     // attachment
     AArrayList->Release(skeletonData->attachmentDataList);
 
+    // shared meshes
+    for (int i = 0; i < skeletonData->meshList->size; ++i)
+    {
+        AMesh->Release(AArrayList_GetPtr(skeletonData->meshList, i, Mesh));
+    }
+    AArrayList->Release(skeletonData->meshList);
+
     // texture atlas
     ATextureAtlas->Release(skeletonData->textureAtlas);
+
+    // compiled skeleton file
+    if (skeletonData->mapping->data != NULL)
+    {
+        AFileTool->ReleaseMappedData(skeletonData->mapping);
+    }
+
+    free(skeletonData);
 }
 
 
-static SkeletonAttachmentData* GetAttachmentDataBySkinData
+static void Release(SkeletonData* skeletonData)
+{
+    AResource->Release(skeletonData->resourceRef);
+}
+
+
+static SkeletonAttachmentData* GetAttachmentDataBySlotIndex
 (
     SkeletonSkinData* skinData,
-    const char*       slotName,
-    const char*       attachmentName
+    int               slotIndex,
+    int               attachmentNameAtom
 )
 {
-    ArrayStrMap* slotAttachmentMap = skinData->slotAttachmentMap;
-    ArrayStrMap* attachmentDataMap = AArrayStrMap_Get(slotAttachmentMap, slotName, ArrayStrMap*);
+    ArrayIntMap* attachmentDataMap = AArray_Get(skinData->slotAttachmentArr, slotIndex, ArrayIntMap*);
 
     if (attachmentDataMap == NULL)
     {
         return NULL;
     }
 
-    return AArrayStrMap_Get(attachmentDataMap, attachmentName, SkeletonAttachmentData*);
+    return AArrayIntMap_Get(attachmentDataMap, attachmentNameAtom, SkeletonAttachmentData*);
 }
 
 
@@ -172,13 +219,13 @@ static inline void ReadBoneData(JsonObject* root, SkeletonData* skeletonData)
 {
     JsonArray*   boneArr            = AJsonObject->GetArray(root, "bones");
     ArrayStrMap* boneDataMap        = skeletonData->boneDataMap;
-    AArrayStrMap->InitWithCapacity(sizeof(SkeletonBoneData*), boneArr->valueList->size, boneDataMap);
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonBoneData*), boneArr->valueArr->length, boneDataMap);
     
     // hold SkeletonBoneData in JSON order
-    skeletonData->boneDataOrderArr  = AArray->Create(sizeof(SkeletonBoneData*), boneArr->valueList->size);
+    skeletonData->boneDataOrderArr  = AArray->Create(sizeof(SkeletonBoneData*), boneArr->valueArr->length);
     Array(float)* boneDataOrderArr  = skeletonData->boneDataOrderArr;
 
-    for (int i = 0; i < boneArr->valueList->size; ++i)
+    for (int i = 0; i < boneArr->valueArr->length; ++i)
     {
         JsonObject*       jsonBone   = AJsonArray->GetObject(boneArr,  i);
         char*             parentName = AJsonObject->GetString(jsonBone, "parent", NULL);
@@ -212,6 +259,7 @@ static inline void ReadBoneData(JsonObject* root, SkeletonData* skeletonData)
 
         boneData->isInheritScale    = AJsonObject->GetBool(jsonBone, "inheritScale",    true);
         boneData->isInheritRotation = AJsonObject->GetBool(jsonBone, "inheritRotation", true);
+        boneData->index             = i;
 
         AArrayStrMap_TryPut(boneDataMap,      boneData->name, boneData);
         AArray_Set         (boneDataOrderArr, i, boneData,    SkeletonBoneData*);
@@ -223,16 +271,16 @@ static inline void ReadSlotData(JsonObject* root, SkeletonData* skeletonData)
 {
     JsonArray*   slotArr           = AJsonObject->GetArray(root, "slots");
     ArrayStrMap* slotDataMap       = skeletonData->slotDataMap;
-    AArrayStrMap->InitWithCapacity(sizeof(SkeletonSlotData*), slotArr->valueList->size, slotDataMap);
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonSlotData*), slotArr->valueArr->length, slotDataMap);
 
     ArrayStrMap* boneDataMap       = skeletonData->boneDataMap;
 
 
     // hold SkeletonSlotData in JSON order
-    skeletonData->slotDataOrderArr             = AArray->Create(sizeof(SkeletonSlotData*), slotArr->valueList->size);
+    skeletonData->slotDataOrderArr             = AArray->Create(sizeof(SkeletonSlotData*), slotArr->valueArr->length);
     Array(SkeletonSlotData*)* slotDataOrderArr = skeletonData->slotDataOrderArr;
 
-    for (int i = 0; i < slotArr->valueList->size; ++i)
+    for (int i = 0; i < slotArr->valueArr->length; ++i)
     {
         JsonObject* jsonSlot             = AJsonArray->GetObject(slotArr, i);
         char*       name                 = AJsonObject->GetString(jsonSlot, "name",       NULL);
@@ -257,6 +305,8 @@ static inline void ReadSlotData(JsonObject* root, SkeletonData* skeletonData)
             slotData->attachmentName = NULL;
         }
 
+        slotData->attachmentNameAtom = AAtom_InternNullable(attachmentName);
+
         char* bone         = AJsonObject->GetString(jsonSlot, "bone", NULL);
         slotData->boneData = AArrayStrMap_Get(boneDataMap, bone, SkeletonBoneData*);
 
@@ -276,6 +326,7 @@ static inline void ReadSlotData(JsonObject* root, SkeletonData* skeletonData)
         }
 
         slotData->isAdditiveBlending = AJsonObject->GetBool(jsonSlot, "additive", false);
+        slotData->index              = i;
         AArrayStrMap_TryPut(slotDataMap, slotData->name, slotData);
         AArray_Set(slotDataOrderArr, i, slotData, SkeletonSlotData*);
     }
@@ -338,16 +389,19 @@ static inline SkeletonAttachmentData* CreateAttachmentData(int length, SkeletonA
 }
 
 
-static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentDataMapObject)
+/**
+ * Read the attachments of one slot into the map that key is atom of slot attachment name.
+ */
+static inline ArrayIntMap* ReadSkinDataSlotAttachment(JsonObject* attachmentDataMapObject)
 {
     const float  scale             = ASkeletonData->scale;
-    ArrayStrMap* attachmentDataMap = AArrayStrMap->CreateWithCapacity
+    ArrayIntMap* attachmentDataMap = AArrayIntMap->CreateWithCapacity
                                      (
                                          sizeof(SkeletonAttachmentData*),
-                                         attachmentDataMapObject->valueMap->elementList->size
+                                         attachmentDataMapObject->pairArr->length
                                      );
 
-    for (int i = 0; i < attachmentDataMapObject->valueMap->elementList->size; ++i)
+    for (int i = 0; i < attachmentDataMapObject->pairArr->length; ++i)
     {
         const char* name                 = AJsonObject->GetKey          (attachmentDataMapObject, i);
         JsonObject* attachmentDataObject = AJsonObject->GetObjectByIndex(attachmentDataMapObject, i);
@@ -389,19 +443,19 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
         else if (strcmp(attachmentType, "boundingbox") == 0)
         {
             JsonArray* jsonVertexArr = AJsonObject->GetArray(attachmentDataObject, "vertices");
-            length                  += jsonVertexArr->valueList->size * sizeof(float);
+            length                  += jsonVertexArr->valueArr->length * sizeof(float);
 
             attachmentData           = CreateAttachmentData(length + nameLength, SkeletonAttachmentDataType_BoundingBox);
             length                  += sizeof(SkeletonBoundingBoxAttachmentData);
 
             SkeletonBoundingBoxAttachmentData* boundingBoxAttachmentData = attachmentData->childPtr;
 
-            boundingBoxAttachmentData->vertexArr->length = jsonVertexArr->valueList->size;
+            boundingBoxAttachmentData->vertexArr->length = jsonVertexArr->valueArr->length;
             boundingBoxAttachmentData->vertexArr->data   = (char*) boundingBoxAttachmentData
                                                            + sizeof(SkeletonBoundingBoxAttachmentData);
             
             float* vertices = boundingBoxAttachmentData->vertexArr->data;
-            for (int j = 0; j < jsonVertexArr->valueList->size; j += 2)
+            for (int j = 0; j < jsonVertexArr->valueArr->length; j += 2)
             {
                 vertices[j]     = AGLTool_ToGLWidth (AJsonArray->GetFloat(jsonVertexArr, j)     * scale);
                 vertices[j + 1] = AGLTool_ToGLHeight(AJsonArray->GetFloat(jsonVertexArr, j + 1) * scale);
@@ -414,10 +468,10 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
             JsonArray* jsonTriangleArr = AJsonObject->GetArray(attachmentDataObject, "triangles");
             JsonArray* jsonUVArr       = AJsonObject->GetArray(attachmentDataObject, "uvs");
 
-            int        verticesCount   = jsonVertexArr->valueList->size   + (jsonVertexArr->valueList->size >> 1);
+            int        verticesCount   = jsonVertexArr->valueArr->length   + (jsonVertexArr->valueArr->length >> 1);
             int        verticesByte    = verticesCount                    * sizeof(float);
-            int        uvsByte         = jsonUVArr->valueList->size       * sizeof(float);
-            int        trianglesByte   = jsonTriangleArr->valueList->size * sizeof(short);
+            int        uvsByte         = jsonUVArr->valueArr->length       * sizeof(float);
+            int        trianglesByte   = jsonTriangleArr->valueArr->length * sizeof(short);
 
             length                    += verticesByte +  uvsByte +  trianglesByte;
             attachmentData             = CreateAttachmentData(length + nameLength, SkeletonAttachmentDataType_Mesh);
@@ -426,6 +480,7 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
             SkeletonMeshAttachmentData* meshAttachmentData = (SkeletonMeshAttachmentData*) attachmentData->childPtr;
 
             meshAttachmentData->isUVMappedInTexture = false;
+            meshAttachmentData->isDeformed          = false;
             meshAttachmentData->vertexArr->length   = verticesCount;
             meshAttachmentData->vertexArr->data     = (char*) meshAttachmentData + sizeof(SkeletonMeshAttachmentData);
 
@@ -437,21 +492,21 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
                 vertices[j + 2] = 0.0f;
             }
 
-            meshAttachmentData->uvArr->length = jsonUVArr->valueList->size;
+            meshAttachmentData->uvArr->length = jsonUVArr->valueArr->length;
             meshAttachmentData->uvArr->data   = (char*) vertices + verticesByte;
 
             float* uvs = meshAttachmentData->uvArr->data;
-            for (int j = 0; j < jsonUVArr->valueList->size; j += 2)
+            for (int j = 0; j < jsonUVArr->valueArr->length; j += 2)
             {
                 uvs[j]     = AJsonArray->GetFloat(jsonUVArr, j);
                 uvs[j + 1] = AJsonArray->GetFloat(jsonUVArr, j + 1);
             }
 
-            meshAttachmentData->triangleArr->length = jsonTriangleArr->valueList->size;
+            meshAttachmentData->triangleArr->length = jsonTriangleArr->valueArr->length;
             meshAttachmentData->triangleArr->data   = (char*) uvs + uvsByte;
 
             short* triangles = meshAttachmentData->triangleArr->data;
-            for (int j = 0; j < jsonTriangleArr->valueList->size; ++j)
+            for (int j = 0; j < jsonTriangleArr->valueArr->length; ++j)
             {
                 triangles[j] = (short) AJsonArray->GetInt(jsonTriangleArr, j);
             }
@@ -473,7 +528,7 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
             int        weightVerticesCount = 0;
             int        verticesCount       = 0;
 
-            for (int j = 0; j < jsonVertexArr->valueList->size; ++verticesCount)
+            for (int j = 0; j < jsonVertexArr->valueArr->length; ++verticesCount)
             {
                 int boneCount = AJsonArray->GetInt(jsonVertexArr, j);
 
@@ -491,8 +546,8 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
 
             int  verticesByte       = verticesCount                    * sizeof(float);
             int  weightVerticesByte = weightVerticesCount              * sizeof(float);
-            int  trianglesByte      = jsonTriangleArr->valueList->size * sizeof(short);
-            int  uvsByte            = jsonUVArr->valueList->size       * sizeof(float);
+            int  trianglesByte      = jsonTriangleArr->valueArr->length * sizeof(short);
+            int  uvsByte            = jsonUVArr->valueArr->length       * sizeof(float);
             int  bonesByte          = bonesCount                       * sizeof(int);
             int  weightsByte        = weightsCount                     * sizeof(float);
 
@@ -509,6 +564,9 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
             SkeletonSkinnedMeshAttachmentData* skinnedMeshAttachmentData = attachmentData->childPtr;
             SkeletonMeshAttachmentData*        meshAttachmentData        = skinnedMeshAttachmentData->meshAttachmentData;
 
+            meshAttachmentData->isUVMappedInTexture = false;
+            meshAttachmentData->isDeformed          = false;
+
             meshAttachmentData->vertexArr->length = verticesCount;
             meshAttachmentData->vertexArr->data   = (char*) skinnedMeshAttachmentData
                                                     + sizeof(SkeletonSkinnedMeshAttachmentData);
@@ -528,7 +586,7 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
             skinnedMeshAttachmentData->weightArr->data   = (char*) bones + bonesByte;
 
             float* weights = skinnedMeshAttachmentData->weightArr->data;
-            for (int j = 0, b = 0, w = 0, v = 0; j < jsonVertexArr->valueList->size;)
+            for (int j = 0, b = 0, w = 0, v = 0; j < jsonVertexArr->valueArr->length;)
             {
                 int boneCount = AJsonArray->GetInt(jsonVertexArr, j++);
                 bones[b++]    = boneCount;
@@ -545,21 +603,21 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
                 }
             }
 
-            meshAttachmentData->uvArr->length = jsonUVArr->valueList->size;
+            meshAttachmentData->uvArr->length = jsonUVArr->valueArr->length;
             meshAttachmentData->uvArr->data   = (char*) weights + weightsByte;
 
             float* uvs = meshAttachmentData->uvArr->data;
-            for (int j = 0; j < jsonUVArr->valueList->size; j += 2)
+            for (int j = 0; j < jsonUVArr->valueArr->length; j += 2)
             {
                 uvs[j]     = AJsonArray->GetFloat(jsonUVArr, j);
                 uvs[j + 1] = AJsonArray->GetFloat(jsonUVArr, j + 1);
             }
 
-            meshAttachmentData->triangleArr->length = jsonTriangleArr->valueList->size;
+            meshAttachmentData->triangleArr->length = jsonTriangleArr->valueArr->length;
             meshAttachmentData->triangleArr->data   = (char*) uvs + uvsByte;
 
             short* triangles = meshAttachmentData->triangleArr->data;
-            for (int j = 0; j < jsonTriangleArr->valueList->size; ++j)
+            for (int j = 0; j < jsonTriangleArr->valueArr->length; ++j)
             {
                 triangles[j] = (short) AJsonArray->GetInt(jsonTriangleArr, j);
             }
@@ -578,25 +636,34 @@ static inline ArrayStrMap* ReadSkinDataSlotAttachment(JsonObject* attachmentData
         attachmentData->name = (char*) attachmentData->childPtr + length;
         memcpy((void*) attachmentData->name, attachmentName, (size_t) nameLength);
 
-        AArrayStrMap_TryPut(attachmentDataMap, name, attachmentData);
+        AArrayIntMap_TryPut(attachmentDataMap, AAtom->Intern(name), attachmentData);
     }
 
     return attachmentDataMap;
 }
 
 
-static inline void ReadSkinDataSlot(JsonObject* skinSlot, SkeletonSkinData* skinData)
+static inline void ReadSkinDataSlot(SkeletonData* skeletonData, JsonObject* skinSlot, SkeletonSkinData* skinData)
 {
-    ArrayStrMap* slotAttachmentMap = skinData->slotAttachmentMap;
-    AArrayStrMap->InitWithCapacity(sizeof(ArrayStrMap*), skinSlot->valueMap->elementList->size, slotAttachmentMap);
+    skinData->slotAttachmentArr = AArray->Create(sizeof(ArrayIntMap*), skeletonData->slotDataOrderArr->length);
+    memset(skinData->slotAttachmentArr->data, 0, sizeof(ArrayIntMap*) * skinData->slotAttachmentArr->length);
 
-    for (int i = 0; i < skinSlot->valueMap->elementList->size; ++i)
+    for (int i = 0; i < skinSlot->pairArr->length; ++i)
     {
+        // resolve slot name and attachment names, so the timeline apply no need strings
         const char*  slotName                = AJsonObject->GetKey(skinSlot, i);
+        int          slotIndex               = FindSlotIndex(skeletonData, slotName);
         JsonObject*  attachmentDataMapObject = AJsonObject->GetObjectByIndex(skinSlot, i);
-        ArrayStrMap* attachmentDataMap       = ReadSkinDataSlotAttachment(attachmentDataMapObject);
 
-        AArrayStrMap_TryPut(slotAttachmentMap, slotName, attachmentDataMap);
+        ALog_A(slotIndex != -1, "ASkeletonData ReadSkinDataSlot not found slotData = %s in slotDataOrderArr", slotName);
+
+        AArray_Set
+        (
+            skinData->slotAttachmentArr,
+            slotIndex,
+            ReadSkinDataSlotAttachment(attachmentDataMapObject),
+            ArrayIntMap*
+        );
     }
 }
 
@@ -605,9 +672,9 @@ static inline void ReadSkinData(JsonObject* root, SkeletonData* skeletonData)
 {
     JsonObject*  skinDataObject = AJsonObject->GetObject(root, "skins");
     ArrayStrMap* skinDataMap    = skeletonData->skinDataMap;
-    AArrayStrMap->InitWithCapacity(sizeof(SkeletonSkinData*), skinDataObject->valueMap->elementList->size, skinDataMap);
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonSkinData*), skinDataObject->pairArr->length, skinDataMap);
 
-    for (int i = 0; i < skinDataObject->valueMap->elementList->size; ++i)
+    for (int i = 0; i < skinDataObject->pairArr->length; ++i)
     {
         const char* skinName       = AJsonObject->GetKey(skinDataObject, i);
         int   skinNameLength       = (int) strlen(skinName) + 1;
@@ -618,7 +685,7 @@ static inline void ReadSkinData(JsonObject* root, SkeletonData* skeletonData)
 
         // skin all slots
         JsonObject*  skinDataSlot  = AJsonObject->GetObjectByIndex(skinDataObject, i);
-        ReadSkinDataSlot(skinDataSlot, skinData);
+        ReadSkinDataSlot(skeletonData, skinDataSlot, skinData);
 
         AArrayStrMap_TryPut(skinDataMap, skinData->name, skinData);
 
@@ -688,7 +755,7 @@ static inline void ReadAnimationBones
 
     ArrayStrMap* boneDataMap = skeletonData->boneDataMap;
 
-    for (int i = 0; i < jsonBones->valueMap->elementList->size; ++i)
+    for (int i = 0; i < jsonBones->pairArr->length; ++i)
     {
         const char*       boneName = AJsonObject->GetKey(jsonBones, i);
         SkeletonBoneData* boneData = AArrayStrMap_Get(boneDataMap, boneName, SkeletonBoneData*);
@@ -712,7 +779,7 @@ static inline void ReadAnimationBones
         );
 
         JsonObject* jsonBoneTimeline = AJsonObject->GetObjectByIndex(jsonBones, i);
-        for (int j = 0; j < jsonBoneTimeline->valueMap->elementList->size; ++j)
+        for (int j = 0; j < jsonBoneTimeline->pairArr->length; ++j)
         {
             const char* timelineType = AJsonObject->GetKey(jsonBoneTimeline, j);
             JsonArray*  timelineArr  = AJsonObject->GetArrayByIndex(jsonBoneTimeline, j);
@@ -722,11 +789,11 @@ static inline void ReadAnimationBones
             {
                 SkeletonRotateTimeline* rotateTimeline = ASkeletonTimeline->CreateRotate
                                                          (
-                                                             timelineArr->valueList->size,
+                                                             timelineArr->valueArr->length,
                                                              boneIndex
                                                          );
 
-                for (int k = 0, frameIndex = 0; k < timelineArr->valueList->size; ++k, ++frameIndex)
+                for (int k = 0, frameIndex = 0; k < timelineArr->valueArr->length; ++k, ++frameIndex)
                 {
                     JsonObject* jsonTimeline = AJsonArray->GetObject(timelineArr,  k);
                     float time               = AJsonObject->GetFloat(jsonTimeline, "time",  0.0f);
@@ -762,14 +829,14 @@ static inline void ReadAnimationBones
 
                 if (isTranslate)
                 {
-                    translateTimeline = ASkeletonTimeline->CreateTranslate(timelineArr->valueList->size, boneIndex);
+                    translateTimeline = ASkeletonTimeline->CreateTranslate(timelineArr->valueArr->length, boneIndex);
 
                 }
                 else
                 {
                     SkeletonScaleTimeline* scaleTimeline = ASkeletonTimeline->CreateScale
                                                            (
-                                                               timelineArr->valueList->size,
+                                                               timelineArr->valueArr->length,
                                                                boneIndex
                                                            );
                     translateTimeline                    = scaleTimeline->translateTimeline;
@@ -781,7 +848,7 @@ static inline void ReadAnimationBones
                 // and we use temporary variable to get the "array variable" address
                 AArrayList_Add(skeletonTimelineArr, skeletonTimeline);
 
-                for (int k = 0, frameIndex = 0; k < timelineArr->valueList->size; ++k, ++frameIndex)
+                for (int k = 0, frameIndex = 0; k < timelineArr->valueArr->length; ++k, ++frameIndex)
                 {
                     JsonObject* jsonTimeline = AJsonArray->GetObject(timelineArr,  k);
                     float       time         = AJsonObject->GetFloat(jsonTimeline, "time", 0.0f);
@@ -832,7 +899,7 @@ static inline void ReadAnimationSlots
     ArrayList(SkeletonTimeline*)* skeletonTimelineArr
 )
 {
-    for (int i = 0; i < jsonSlots->valueMap->elementList->size; ++i)
+    for (int i = 0; i < jsonSlots->pairArr->length; ++i)
     {
         const char* slotName  = AJsonObject->GetKey(jsonSlots, i);
         int         slotIndex = FindSlotIndex(skeletonData, slotName);
@@ -845,17 +912,17 @@ static inline void ReadAnimationSlots
         );
 
         JsonObject* jsonSlotTimeline = AJsonObject->GetObjectByIndex(jsonSlots, i);
-        for (int j = 0; j < jsonSlotTimeline->valueMap->elementList->size; ++j)
+        for (int j = 0; j < jsonSlotTimeline->pairArr->length; ++j)
         {
             const char* timelineType = AJsonObject->GetKey(jsonSlotTimeline, j);
             JsonArray*  timelineArr  = AJsonObject->GetArrayByIndex(jsonSlotTimeline, j);
 
             if (strcmp(timelineType, "color") == 0)
             {
-                SkeletonColorTimeline* colorTimeline = ASkeletonTimeline->CreateColor(timelineArr->valueList->size);
+                SkeletonColorTimeline* colorTimeline = ASkeletonTimeline->CreateColor(timelineArr->valueArr->length);
                 colorTimeline->slotIndex             = slotIndex;
 
-                for (int k = 0, frameIndex = 0; k < timelineArr->valueList->size; ++k, ++frameIndex)
+                for (int k = 0, frameIndex = 0; k < timelineArr->valueArr->length; ++k, ++frameIndex)
                 {
                     JsonObject* jsonTimeline = AJsonArray->GetObject(timelineArr,  k);
                     float       time         = AJsonObject->GetFloat (jsonTimeline, "time", 0.0);
@@ -890,11 +957,11 @@ static inline void ReadAnimationSlots
             {
                 SkeletonAttachmentTimeline* attachmentTimeline = ASkeletonTimeline->CreateAttachment
                                                                  (
-                                                                     timelineArr->valueList->size
+                                                                     timelineArr->valueArr->length
                                                                  );
                 attachmentTimeline->slotIndex                  = slotIndex;
 
-                for (int k = 0, frameIndex = 0; k < timelineArr->valueList->size; ++k, ++frameIndex)
+                for (int k = 0, frameIndex = 0; k < timelineArr->valueArr->length; ++k, ++frameIndex)
                 {
                     JsonObject* jsonTimeline = AJsonArray->GetObject (timelineArr,  k);
                     float       time         = AJsonObject->GetFloat (jsonTimeline, "time", 0.0f);
@@ -939,9 +1006,9 @@ static inline void ReadAnimationEvents
 )
 {
 
-    SkeletonEventTimeline* eventTimeline = ASkeletonTimeline->CreateEvent(jsonEvents->valueList->size);
+    SkeletonEventTimeline* eventTimeline = ASkeletonTimeline->CreateEvent(jsonEvents->valueArr->length);
 
-    for (int i = 0, frameIndex = 0; i < jsonEvents->valueList->size; ++i, ++frameIndex)
+    for (int i = 0, frameIndex = 0; i < jsonEvents->valueArr->length; ++i, ++frameIndex)
     {
         JsonObject*        eventObject = AJsonArray->GetObject(jsonEvents,  i);
         char*              eventName   = AJsonObject->GetString(eventObject, "name", NULL);
@@ -996,13 +1063,13 @@ static inline void ReadAnimationDrawOrders
 )
 {
 
-    SkeletonDrawOrderTimeline* drawOrderTimeline = ASkeletonTimeline->CreateDrawOrder(jsonDrawOrder->valueList->size);
+    SkeletonDrawOrderTimeline* drawOrderTimeline = ASkeletonTimeline->CreateDrawOrder(jsonDrawOrder->valueArr->length);
     int                        slotCount         = skeletonData->slotDataOrderArr->length;
 
     // collect slot index unchanged, but moved slot will push other move as whole
     int                        unchanged[slotCount];
 
-    for (int i = 0, frameIndex = 0; i < jsonDrawOrder->valueList->size; ++i, ++frameIndex)
+    for (int i = 0, frameIndex = 0; i < jsonDrawOrder->valueArr->length; ++i, ++frameIndex)
     {
         JsonObject* drawOrderObject = AJsonArray->GetObject(jsonDrawOrder,    i);
         float       time            = AJsonObject->GetFloat (drawOrderObject,  "time", 0.0f);
@@ -1023,7 +1090,7 @@ static inline void ReadAnimationDrawOrders
             int unchangedIndex = 0;
             int slotIndex;
 
-            for (int j = 0; j < offsets->valueList->size; ++j)
+            for (int j = 0; j < offsets->valueArr->length; ++j)
             {
                 JsonObject* offset       = AJsonArray->GetObject(offsets, j);
                 char*       slotName     = AJsonObject->GetString(offset,  "slot",   NULL);
@@ -1104,7 +1171,7 @@ static inline void ReadAnimationDeform
     ArrayList(SkeletonTimeline*)* skeletonTimelineArr
 )
 {
-    for (int i = 0; i < jsonDeform->valueMap->elementList->size; ++i)
+    for (int i = 0; i < jsonDeform->pairArr->length; ++i)
     {
         const char*       skinName = AJsonObject->GetKey(jsonDeform, i);
         SkeletonSkinData* skinData = AArrayStrMap_Get(skeletonData->skinDataMap, skinName, SkeletonSkinData*);
@@ -1112,7 +1179,7 @@ static inline void ReadAnimationDeform
         ALog_A(skinData != NULL, "ASkeletonData ReadAnimationDeform deform skin not found %s", skinName);
 
         JsonObject* jsonSlots = AJsonObject->GetObjectByIndex(jsonDeform, i);
-        for (int j = 0; j < jsonSlots->valueMap->elementList->size; ++j)
+        for (int j = 0; j < jsonSlots->pairArr->length; ++j)
         {
             const char* slotName  = AJsonObject->GetKey(jsonSlots, j);
             int         slotIndex = FindSlotIndex(skeletonData, slotName);
@@ -1125,12 +1192,17 @@ static inline void ReadAnimationDeform
             );
 
             JsonObject* jsonMeshes = AJsonObject->GetObjectByIndex(jsonSlots, j);
-            for (int k = 0; k < jsonMeshes->valueMap->elementList->size; ++k)
+            for (int k = 0; k < jsonMeshes->pairArr->length; ++k)
             {
                 JsonArray*              jsonMeshArr    = AJsonObject->GetArrayByIndex   (jsonMeshes, k);
                 const char*             meshName       = AJsonObject->GetKey            (jsonMeshes, k);
-                SkeletonDeformTimeline* deformTimeline = ASkeletonTimeline->CreateDeform(jsonMeshArr->valueList->size);
-                SkeletonAttachmentData* attachmentData = GetAttachmentDataBySkinData(skinData, slotName, meshName);
+                SkeletonDeformTimeline* deformTimeline = ASkeletonTimeline->CreateDeform(jsonMeshArr->valueArr->length);
+                SkeletonAttachmentData* attachmentData = GetAttachmentDataBySlotIndex
+                                                         (
+                                                             skinData,
+                                                             slotIndex,
+                                                             AAtom->Find(meshName)
+                                                         );
 
                 ALog_A
                 (
@@ -1158,6 +1230,7 @@ static inline void ReadAnimationDeform
 
                     case SkeletonAttachmentDataType_Mesh:
                         meshVertices = ((SkeletonMeshAttachmentData*) attachmentData->childPtr)->vertexArr;
+                        ((SkeletonMeshAttachmentData*) attachmentData->childPtr)->isDeformed = true;
                         break;
 
 
@@ -1166,7 +1239,7 @@ static inline void ReadAnimationDeform
                         break;
                 }
 
-                for (int l = 0, frameIndex = 0; l < jsonMeshArr->valueList->size; ++l, ++frameIndex)
+                for (int l = 0, frameIndex = 0; l < jsonMeshArr->valueArr->length; ++l, ++frameIndex)
                 {
                     JsonObject*   jsonMesh      = AJsonArray->GetObject(jsonMeshArr, l);
                     JsonArray*    jsonVertexArr = AJsonObject->GetArray(jsonMesh,    "vertices");
@@ -1182,7 +1255,7 @@ static inline void ReadAnimationDeform
                         // also, zeros at the end are not output
                         int    start      = AJsonObject->GetInt(jsonMesh, "offset", 0);
 
-                        for (int m = 0; m < jsonVertexArr->valueList->size; ++m, ++start)
+                        for (int m = 0; m < jsonVertexArr->valueArr->length; ++m, ++start)
                         {
                             // jsonVertices is x,y
                             // vertexData   is x,y,z
@@ -1231,18 +1304,19 @@ static inline void ReadAnimationData(JsonObject* root, SkeletonData* skeletonDat
     AArrayStrMap->InitWithCapacity
     (
         sizeof(SkeletonAnimationData*),
-        animationDataObject->valueMap->elementList->size,
+        animationDataObject->pairArr->length,
         animationDataMap
     );
 
-    for (int i = 0; i < animationDataObject->valueMap->elementList->size; ++i)
+    for (int i = 0; i < animationDataObject->pairArr->length; ++i)
     {
         const char*            animationName       = AJsonObject->GetKey(animationDataObject, i);
         int                    animationNameLength = (int) strlen(animationName) + 1;
         SkeletonAnimationData* animationData       = malloc(sizeof(SkeletonAnimationData) + animationNameLength);
 
-        animationData->duration = 0.0f;
-        animationData->name     = (char*) animationData + sizeof(SkeletonAnimationData);
+        animationData->duration       = 0.0f;
+        animationData->bakedAnimation = NULL;
+        animationData->name           = (char*) animationData + sizeof(SkeletonAnimationData);
         memcpy((void*) animationData->name, animationName, (size_t) animationNameLength);
 
         ArrayList(SkeletonTimeline*)* skeletonTimelineArr = animationData->timelineArr;
@@ -1294,7 +1368,7 @@ static inline void ReadEventData(JsonObject* root, SkeletonData* skeletonData)
     int size = 0;
     if (eventObject != NULL)
     {
-        size = eventObject->valueMap->elementList->size;
+        size = eventObject->pairArr->length;
     }
 
     AArrayStrMap->InitWithCapacity(sizeof(SkeletonEventData*), size, eventDataMap);
@@ -1303,7 +1377,7 @@ static inline void ReadEventData(JsonObject* root, SkeletonData* skeletonData)
     {
         JsonObject* eventValue = AJsonObject->GetObjectByIndex(eventObject, i);
 
-        if (eventValue->valueMap->elementList->size == 0)
+        if (eventValue->pairArr->length == 0)
         {
             continue;
         }
@@ -1344,11 +1418,8 @@ static inline void ReadSkeletonData(JsonObject* root, SkeletonData* skeletonData
 }
 
 
-static inline void Parse(SkeletonData* skeletonData, const char* jsonFilePath)
+static inline void Parse(SkeletonData* skeletonData, JsonObject* root)
 {
-    JsonValue*  value = AJson->ParseFile(jsonFilePath);
-    JsonObject* root  = value->jsonObject;
-
     // skeleton
     ReadSkeletonData(root, skeletonData);
 
@@ -1366,135 +1437,1102 @@ static inline void Parse(SkeletonData* skeletonData, const char* jsonFilePath)
 
     // animations
     ReadAnimationData(root, skeletonData);
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
 
-    // json
-    AJson->Destroy(value);
+/**
+ * Read the words of compiled skeleton file in order,
+ * every read is checked against the end of body and the strings against the string table.
+ */
+typedef struct
+{
+    char*    data;
+    int32_t* word;
+    int32_t* end;
+
+    /**
+     * The string table is between the header and body.
+     */
+    int      stringTableEnd;
+
+    /**
+     * Once broken the word is at end, so the reads give 0, NULL and empty name, and the counts give 0.
+     */
+    bool     isBroken;
 }
+BinaryReader;
 
 
-static inline void InitAtlas(SkeletonData* skeletonData, char* atlasPath)
+static inline void SetBroken(BinaryReader* reader, const char* reason)
 {
-    skeletonData->textureAtlas                 = ATextureAtlas->Get(atlasPath);
-    ArrayStrMap*              skinDataMap      = skeletonData->skinDataMap;
-    Array(SkeletonSlotData*)* slotDataOrderArr = skeletonData->slotDataOrderArr;
+    if (reader->isBroken == false)
+    {
+        ALog_E
+        (
+            "ASkeletonData ParseBinary broken file at byte %d, %s",
+            (int) ((char*) reader->word - reader->data),
+            reason
+        );
 
-    AArrayList->InitWithCapacity(sizeof(SkeletonAttachmentData*), 20, skeletonData->attachmentDataList);
+        reader->isBroken = true;
+        reader->word     = reader->end;
+    }
+}
 
-    int quadCounts[skeletonData->textureAtlas->textureList->size];
-    memset(quadCounts, 0, sizeof(int) * skeletonData->textureAtlas->textureList->size);
 
-    for (int i = 0; i < slotDataOrderArr->length; ++i)
+static inline int ReadInt(BinaryReader* reader)
+{
+    if (reader->word < reader->end)
     {
-        SkeletonSlotData* slotData   = AArray_Get(slotDataOrderArr, i, SkeletonSlotData*);
-        slotData->attachmentDataList = AArrayList->Create(sizeof(SkeletonAttachmentData*));
+        return *reader->word++;
+    }
 
-        // search all skin attachment
-        for (int j = 0; j < skinDataMap->elementList->size; ++j)
-        {
-            // char*          skinName          = AArrayStrMap->GetKey(skinDataMap, j);
-            SkeletonSkinData* skinData          = AArrayStrMap_GetAt(skinDataMap, j, SkeletonSkinData*);
-            ArrayStrMap*      slotAttachmentMap = skinData->slotAttachmentMap;
-            ArrayStrMap*      attachmentMap     = AArrayStrMap_Get(slotAttachmentMap, slotData->name, ArrayStrMap*);
+    SetBroken(reader, "read over the end");
+    return 0;
+}
 
-            if (attachmentMap == NULL)
-            {
-                continue;
-            }
 
-            for (int k = 0; k < attachmentMap->elementList->size; ++k)
-            {
-//              const char*             attachmentName = AArrayStrMap->GetKey(attachmentMap, k);
-                SkeletonAttachmentData* attachmentData = AArrayStrMap_GetAt(attachmentMap, k, SkeletonAttachmentData*);
+static inline float ReadFloat(BinaryReader* reader)
+{
+    float value = 0.0f;
 
-                if (attachmentData->type == SkeletonAttachmentDataType_BoundingBox)
-                {
-                    continue;
-                }
+    if (reader->word < reader->end)
+    {
+        memcpy(&value, reader->word++, sizeof(float));
+    }
+    else
+    {
+        SetBroken(reader, "read over the end");
+    }
 
-                // collect each skin attachmentData
-                AArrayList_Add(slotData->attachmentDataList,     attachmentData);
-                // collect all skin attachmentData
-                AArrayList_Add(skeletonData->attachmentDataList, attachmentData);
+    return value;
+}
 
-                TextureAtlasQuad* atlasQuad = ATextureAtlas_GetQuad(skeletonData->textureAtlas, attachmentData->name);
-                ALog_A
-                (
-                    atlasQuad != NULL,
-                    "ASkeletonData InitAtlas cannot find attachment in TextureAtlas by name = %s",
-                    attachmentData->name
-                );
 
-                switch (attachmentData->type)
-                {
-                    case SkeletonAttachmentDataType_Region:
-                    {
-                        SkeletonRegionAttachmentData* regionAttachmentData = attachmentData->childPtr;
-                        regionAttachmentData->meshIndex                    = atlasQuad->textureIndex;
-                        regionAttachmentData->quad                         = atlasQuad->quad;
-                        regionAttachmentData->subMeshIndex                 = quadCounts[atlasQuad->textureIndex]++;
-                        break;
-                    }
+/**
+ * Read the string offset, 0 is NULL.
+ */
+static inline const char* ReadString(BinaryReader* reader)
+{
+    int offset = ReadInt(reader);
 
-                    case SkeletonAttachmentDataType_SkinnedMesh:
-                    case SkeletonAttachmentDataType_Mesh:
-                    {
-                        SkeletonMeshAttachmentData* meshData;
+    if (offset == 0)
+    {
+        return NULL;
+    }
 
-                        if (attachmentData->type == SkeletonAttachmentDataType_SkinnedMesh)
-                        {
-                            meshData = ((SkeletonSkinnedMeshAttachmentData*) attachmentData->childPtr)
-                                       ->meshAttachmentData;
-                        }
-                        else
-                        {
-                            meshData = (SkeletonMeshAttachmentData*) attachmentData->childPtr;
-                        }
+    if
+    (
+        offset < (int) sizeof(SkeletonBinaryHeader) ||
+        offset >= reader->stringTableEnd            ||
+        memchr(reader->data + offset, '\0', (size_t) (reader->stringTableEnd - offset)) == NULL
+    )
+    {
+        SetBroken(reader, "string offset out of the string table");
+        return NULL;
+    }
 
-                        meshData->meshIndex    = atlasQuad->textureIndex;
-                        meshData->quad         = atlasQuad->quad;
-                        meshData->subMeshIndex = quadCounts[atlasQuad->textureIndex]++;
-                        break;
-                    }
-                        
-                    case SkeletonAttachmentDataType_BoundingBox:
-                        break;
-                }
-            }
-        }
+    return reader->data + offset;
+}
 
-        AArrayList->Shrink(slotData->attachmentDataList);
-        AArrayList->Shrink(skeletonData->attachmentDataList);
+
+/**
+ * Read the string that cannot be NULL.
+ */
+static inline const char* ReadName(BinaryReader* reader)
+{
+    const char* name = ReadString(reader);
+
+    if (name == NULL)
+    {
+        SetBroken(reader, "name is NULL");
+        return "";
     }
+
+    return name;
 }
 
 
-static SkeletonData* Get(const char* jsonFilePath)
+/**
+ * Read the count of items, each item takes at least wordsPerItem words after the count.
+ */
+static inline int ReadCount(BinaryReader* reader, int wordsPerItem)
 {
-    SkeletonData* skeletonData = AArrayStrMap_Get(skeletonDataMap, jsonFilePath, SkeletonData*);
+    int count = ReadInt(reader);
 
-    if (skeletonData == NULL)
+    if (count < 0 || count > (reader->end - reader->word) / wordsPerItem)
+    {
+        SetBroken(reader, "count out of the end");
+        return 0;
+    }
+
+    return count;
+}
+
+
+/**
+ * Check the index read from file is in [0, length).
+ */
+static inline bool CheckIndex(BinaryReader* reader, int index, int length)
+{
+    if (reader->isBroken)
     {
-        skeletonData = malloc(sizeof(SkeletonData));
+        return false;
+    }
 
-        char path[strlen(jsonFilePath) + sizeof(".atlas.json")];
+    if (index < 0 || index >= length)
+    {
+        SetBroken(reader, "index out of range");
+        return false;
+    }
 
-        sprintf(path, "%s.json",  jsonFilePath);
-        Parse(skeletonData, path);
+    return true;
+}
 
-        sprintf(path, "%s.atlas", jsonFilePath);
-        InitAtlas(skeletonData, path);
 
-        skeletonData->filePath = AArrayStrMap_GetKey
-                                 (
-                                     AArrayStrMap_TryPut(skeletonDataMap, jsonFilePath, skeletonData),
-                                     skeletonDataMap->valueTypeSize
-                                 );
+/**
+ * Read the block of wordCount words in place, return NULL if out of the end.
+ */
+static inline void* ReadBlock(BinaryReader* reader, int wordCount)
+{
+    if (wordCount < 0 || wordCount > reader->end - reader->word)
+    {
+        SetBroken(reader, "block out of the end");
+        return NULL;
     }
 
-//  Release(skeletonData);
-//  ALog_A(0, "Stop");
+    void* block   = reader->word;
+    reader->word += wordCount;
+    return block;
+}
 
-    return skeletonData;
+
+/**
+ * Read the block of wordCount words into the data of array, the length is cleared if out of the end.
+ */
+static inline void ReadArray(BinaryReader* reader, Array* array, int wordCount)
+{
+    array->data = ReadBlock(reader, wordCount);
+
+    if (array->data == NULL)
+    {
+        array->length = 0;
+    }
+}
+
+
+/**
+ * Scale and convert the x, y of each stride values to GL in place.
+ */
+static inline void ConvertVertices(float* vertices, int length, int stride)
+{
+    const float scale = ASkeletonData->scale;
+
+    for (int i = 0; i < length; i += stride)
+    {
+        vertices[i]     = AGLTool_ToGLWidth (vertices[i]     * scale);
+        vertices[i + 1] = AGLTool_ToGLHeight(vertices[i + 1] * scale);
+    }
+}
+
+
+static inline void ReadBinaryBoneData(BinaryReader* reader, SkeletonData* skeletonData)
+{
+    const float  scale       = ASkeletonData->scale;
+    int          boneCount   = ReadCount(reader, 1);
+    ArrayStrMap* boneDataMap = skeletonData->boneDataMap;
+
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonBoneData*), boneCount, boneDataMap);
+    skeletonData->boneDataOrderArr = AArray->Create(sizeof(SkeletonBoneData*), boneCount);
+
+    for (int i = 0; i < boneCount && reader->isBroken == false; ++i)
+    {
+        SkeletonBoneData* boneData  = malloc(sizeof(SkeletonBoneData));
+        boneData->name              = ReadName(reader);
+
+        // the parent is before child
+        int parentIndex             = ReadInt(reader);
+        boneData->parent            = parentIndex != -1 && CheckIndex(reader, parentIndex, i) ?
+                                      AArray_Get(skeletonData->boneDataOrderArr, parentIndex, SkeletonBoneData*) :
+                                      NULL;
+
+        boneData->length            = AGLTool_ToGLWidth (ReadFloat(reader) * scale);
+        boneData->x                 = AGLTool_ToGLWidth (ReadFloat(reader) * scale);
+        boneData->y                 = AGLTool_ToGLHeight(ReadFloat(reader) * scale);
+        boneData->rotationZ         = ReadFloat(reader);
+        boneData->scaleX            = ReadFloat(reader);
+        boneData->scaleY            = ReadFloat(reader);
+        boneData->isInheritScale    = ReadInt  (reader) != 0;
+        boneData->isInheritRotation = ReadInt  (reader) != 0;
+        boneData->index             = i;
+
+        AArrayStrMap_TryPut(boneDataMap, boneData->name, boneData);
+        AArray_Set(skeletonData->boneDataOrderArr, i, boneData, SkeletonBoneData*);
+    }
+}
+
+
+static inline void ReadBinarySlotData(BinaryReader* reader, SkeletonData* skeletonData)
+{
+    int          slotCount   = ReadCount(reader, 1);
+    ArrayStrMap* slotDataMap = skeletonData->slotDataMap;
+
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonSlotData*), slotCount, slotDataMap);
+    skeletonData->slotDataOrderArr = AArray->Create(sizeof(SkeletonSlotData*), slotCount);
+
+    for (int i = 0; i < slotCount && reader->isBroken == false; ++i)
+    {
+        SkeletonSlotData* slotData     = malloc(sizeof(SkeletonSlotData));
+        slotData->name                 = ReadName  (reader);
+        slotData->attachmentName       = ReadString(reader);
+        slotData->attachmentNameAtom   = AAtom_InternNullable(slotData->attachmentName);
+        slotData->attachmentDataList   = NULL;
+
+        int boneIndex                  = ReadInt(reader);
+        slotData->boneData             = CheckIndex(reader, boneIndex, skeletonData->boneDataOrderArr->length) ?
+                                         AArray_Get(skeletonData->boneDataOrderArr, boneIndex, SkeletonBoneData*) :
+                                         NULL;
+        slotData->color->r             = ReadFloat(reader);
+        slotData->color->g             = ReadFloat(reader);
+        slotData->color->b             = ReadFloat(reader);
+        slotData->color->a             = ReadFloat(reader);
+        slotData->isAdditiveBlending   = ReadInt  (reader) != 0;
+        slotData->index                = i;
+
+        AArrayStrMap_TryPut(slotDataMap, slotData->name, slotData);
+        AArray_Set(skeletonData->slotDataOrderArr, i, slotData, SkeletonSlotData*);
+    }
+}
+
+
+static inline void ReadBinaryEventData(BinaryReader* reader, SkeletonData* skeletonData)
+{
+    int eventCount = ReadCount(reader, 1);
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonEventData*), eventCount, skeletonData->eventDataMap);
+
+    for (int i = 0; i < eventCount && reader->isBroken == false; ++i)
+    {
+        SkeletonEventData* eventData = malloc(sizeof(SkeletonEventData));
+        eventData->name              = ReadName  (reader);
+        eventData->stringValue       = ReadString(reader);
+        eventData->intValue          = ReadInt   (reader);
+        eventData->floatValue        = ReadFloat (reader);
+
+        AArrayStrMap_TryPut(skeletonData->eventDataMap, eventData->name, eventData);
+    }
+}
+
+
+static inline SkeletonAttachmentData* ReadBinaryAttachmentData(BinaryReader* reader)
+{
+    const float             scale          = ASkeletonData->scale;
+    const char*             name           = ReadName(reader);
+    SkeletonAttachmentData* attachmentData = NULL;
+
+    switch (ReadInt(reader))
+    {
+        case SkeletonBinaryAttachment_Region:
+        {
+            attachmentData = CreateAttachmentData(0, SkeletonAttachmentDataType_Region);
+
+            SkeletonRegionAttachmentData* regionAttachmentData = attachmentData->childPtr;
+
+            regionAttachmentData->x         = AGLTool_ToGLWidth (ReadFloat(reader) * scale);
+            regionAttachmentData->y         = AGLTool_ToGLHeight(ReadFloat(reader) * scale);
+            regionAttachmentData->rotationZ = ReadFloat(reader);
+            regionAttachmentData->scaleX    = ReadFloat(reader);
+            regionAttachmentData->scaleY    = ReadFloat(reader);
+            regionAttachmentData->width     = AGLTool_ToGLWidth (ReadFloat(reader) * scale);
+            regionAttachmentData->height    = AGLTool_ToGLHeight(ReadFloat(reader) * scale);
+            break;
+        }
+
+        case SkeletonBinaryAttachment_BoundingBox:
+        {
+            attachmentData = CreateAttachmentData(0, SkeletonAttachmentDataType_BoundingBox);
+
+            SkeletonBoundingBoxAttachmentData* boundingBoxAttachmentData = attachmentData->childPtr;
+            Array(float)*                      vertexArr                 = boundingBoxAttachmentData->vertexArr;
+
+            vertexArr->length = ReadCount(reader, 1);
+            ReadArray(reader, vertexArr, vertexArr->length);
+
+            ConvertVertices(vertexArr->data, vertexArr->length, 2);
+            break;
+        }
+
+        case SkeletonBinaryAttachment_Mesh:
+        {
+            attachmentData = CreateAttachmentData(0, SkeletonAttachmentDataType_Mesh);
+
+            SkeletonMeshAttachmentData* meshAttachmentData = attachmentData->childPtr;
+
+            meshAttachmentData->isUVMappedInTexture = false;
+            meshAttachmentData->isDeformed          = false;
+            meshAttachmentData->width               = AGLTool_ToGLWidth (ReadFloat(reader) * scale);
+            meshAttachmentData->height              = AGLTool_ToGLHeight(ReadFloat(reader) * scale);
+            meshAttachmentData->vertexArr->length   = ReadCount(reader, 1);
+            meshAttachmentData->uvArr->length       = ReadCount(reader, 1);
+            meshAttachmentData->triangleArr->length = ReadCount(reader, 1);
+
+            ReadArray(reader, meshAttachmentData->vertexArr, meshAttachmentData->vertexArr->length);
+            ReadArray(reader, meshAttachmentData->uvArr,     meshAttachmentData->uvArr->length);
+            // the triangles are shorts padded to 4 bytes
+            ReadArray
+            (
+                reader,
+                meshAttachmentData->triangleArr,
+                (meshAttachmentData->triangleArr->length + 1) >> 1
+            );
+
+            ConvertVertices(meshAttachmentData->vertexArr->data, meshAttachmentData->vertexArr->length, 3);
+            break;
+        }
+
+        case SkeletonBinaryAttachment_SkinnedMesh:
+        {
+            attachmentData = CreateAttachmentData(0, SkeletonAttachmentDataType_SkinnedMesh);
+
+            SkeletonSkinnedMeshAttachmentData* skinnedMeshAttachmentData = attachmentData->childPtr;
+            SkeletonMeshAttachmentData*        meshAttachmentData        = skinnedMeshAttachmentData->meshAttachmentData;
+
+            meshAttachmentData->isUVMappedInTexture            = false;
+            meshAttachmentData->isDeformed                     = false;
+            meshAttachmentData->width                          = AGLTool_ToGLWidth (ReadFloat(reader) * scale);
+            meshAttachmentData->height                         = AGLTool_ToGLHeight(ReadFloat(reader) * scale);
+            meshAttachmentData->vertexArr->length              = ReadCount(reader, 1);
+            skinnedMeshAttachmentData->weightVertexArr->length = ReadCount(reader, 1);
+            skinnedMeshAttachmentData->boneArr->length         = ReadCount(reader, 1);
+            skinnedMeshAttachmentData->weightArr->length       = ReadCount(reader, 1);
+            meshAttachmentData->uvArr->length                  = ReadCount(reader, 1);
+            meshAttachmentData->triangleArr->length            = ReadCount(reader, 1);
+
+            ReadArray(reader, meshAttachmentData->vertexArr,              meshAttachmentData->vertexArr->length);
+            ReadArray
+            (
+                reader,
+                skinnedMeshAttachmentData->weightVertexArr,
+                skinnedMeshAttachmentData->weightVertexArr->length
+            );
+            ReadArray(reader, skinnedMeshAttachmentData->boneArr,         skinnedMeshAttachmentData->boneArr->length);
+            ReadArray(reader, skinnedMeshAttachmentData->weightArr,       skinnedMeshAttachmentData->weightArr->length);
+            ReadArray(reader, meshAttachmentData->uvArr,                  meshAttachmentData->uvArr->length);
+            // the triangles are shorts padded to 4 bytes
+            ReadArray
+            (
+                reader,
+                meshAttachmentData->triangleArr,
+                (meshAttachmentData->triangleArr->length + 1) >> 1
+            );
+
+            ConvertVertices
+            (
+                skinnedMeshAttachmentData->weightVertexArr->data,
+                skinnedMeshAttachmentData->weightVertexArr->length,
+                3
+            );
+            break;
+        }
+
+        default:
+            SetBroken(reader, "invalid attachment type");
+            return NULL;
+    }
+
+    attachmentData->name = name;
+
+    return attachmentData;
+}
+
+
+/**
+ * The attachmentDataList collects all SkeletonAttachmentData in file order for deform timeline.
+ */
+static inline void ReadBinarySkinData
+(
+    BinaryReader*                       reader,
+    SkeletonData*                       skeletonData,
+    ArrayList(SkeletonAttachmentData*)* attachmentDataList
+)
+{
+    int          skinCount   = ReadCount(reader, 1);
+    ArrayStrMap* skinDataMap = skeletonData->skinDataMap;
+
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonSkinData*), skinCount, skinDataMap);
+    skeletonData->skinDataDefault = NULL;
+
+    for (int i = 0; i < skinCount && reader->isBroken == false; ++i)
+    {
+        SkeletonSkinData* skinData = malloc(sizeof(SkeletonSkinData));
+        skinData->name             = ReadName (reader);
+        int skinSlotCount          = ReadCount(reader, 1);
+
+        skinData->slotAttachmentArr = AArray->Create(sizeof(ArrayIntMap*), skeletonData->slotDataOrderArr->length);
+        memset(skinData->slotAttachmentArr->data, 0, sizeof(ArrayIntMap*) * skinData->slotAttachmentArr->length);
+
+        for (int j = 0; j < skinSlotCount && reader->isBroken == false; ++j)
+        {
+            int slotIndex       = ReadInt  (reader);
+            int attachmentCount = ReadCount(reader, 1);
+
+            if (CheckIndex(reader, slotIndex, skeletonData->slotDataOrderArr->length) == false)
+            {
+                continue;
+            }
+
+            if (AArray_Get(skinData->slotAttachmentArr, slotIndex, ArrayIntMap*) != NULL)
+            {
+                SetBroken(reader, "duplicate skin slot");
+                continue;
+            }
+
+            ArrayIntMap* attachmentDataMap = AArrayIntMap->CreateWithCapacity
+                                             (
+                                                 sizeof(SkeletonAttachmentData*),
+                                                 attachmentCount
+                                             );
+
+            for (int k = 0; k < attachmentCount && reader->isBroken == false; ++k)
+            {
+                const char*             key            = ReadName(reader);
+                SkeletonAttachmentData* attachmentData = ReadBinaryAttachmentData(reader);
+
+                if (attachmentData == NULL)
+                {
+                    continue;
+                }
+
+                if (AArrayIntMap_TryPut(attachmentDataMap, AAtom->Intern(key), attachmentData) == NULL)
+                {
+                    free(attachmentData->childPtr);
+                    SetBroken(reader, "duplicate attachment name");
+                    continue;
+                }
+
+                AArrayList_Add(attachmentDataList, attachmentData);
+            }
+
+            AArray_Set(skinData->slotAttachmentArr, slotIndex, attachmentDataMap, ArrayIntMap*);
+        }
+
+        AArrayStrMap_TryPut(skinDataMap, skinData->name, skinData);
+
+        if (strcmp(skinData->name, "default") == 0)
+        {
+            skeletonData->skinDataDefault = skinData;
+        }
+    }
+}
+
+
+static inline void ReadBinaryCurves(BinaryReader* reader, SkeletonCurveTimeline* curveTimeline, int frameCount)
+{
+    for (int i = 0; i < frameCount; ++i)
+    {
+        int    type  = ReadInt(reader);
+        float* curve = ReadBlock(reader, ASkeletonBinary_CurveSize - 1);
+
+        if (curve == NULL)
+        {
+            return;
+        }
+
+        switch (type)
+        {
+            case SkeletonBinaryCurve_Linear:
+                ASkeletonTimeline->SetLinear(curveTimeline, i);
+                break;
+
+            case SkeletonBinaryCurve_Stepped:
+                ASkeletonTimeline->SetStepped(curveTimeline, i);
+                break;
+
+            case SkeletonBinaryCurve_Bezier:
+                ASkeletonTimeline->SetCurve(curveTimeline, i, curve[0], curve[1], curve[2], curve[3]);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+
+/**
+ * Copy the frames block of frameCount * valueCount floats into frameArr.
+ */
+static inline void ReadBinaryFrames(BinaryReader* reader, Array(float)* frameArr, int frameCount, int valueCount)
+{
+    float* frames = ReadBlock(reader, frameCount * valueCount);
+
+    if (frames != NULL)
+    {
+        memcpy(frameArr->data, frames, sizeof(float) * frameCount * valueCount);
+    }
+}
+
+
+static inline SkeletonTimeline* ReadBinaryTimeline
+(
+    BinaryReader*                       reader,
+    SkeletonData*                       skeletonData,
+    ArrayList(SkeletonAttachmentData*)* attachmentDataList
+)
+{
+    int type = ReadInt(reader);
+
+    switch (type)
+    {
+        case SkeletonBinaryTimeline_Rotate:
+        {
+            int boneIndex  = ReadInt  (reader);
+            int frameCount = ReadCount(reader, 2 + ASkeletonBinary_CurveSize);
+
+            if (CheckIndex(reader, boneIndex, skeletonData->boneDataOrderArr->length) == false)
+            {
+                return NULL;
+            }
+
+            SkeletonRotateTimeline* rotateTimeline = ASkeletonTimeline->CreateRotate(frameCount, boneIndex);
+
+            // each frame is time, angle
+            ReadBinaryFrames(reader, rotateTimeline->frameArr, frameCount, 2);
+            ReadBinaryCurves(reader, rotateTimeline->curveTimeline, frameCount);
+
+            return rotateTimeline->skeletonTimeline;
+        }
+
+        case SkeletonBinaryTimeline_Translate:
+        case SkeletonBinaryTimeline_Scale:
+        {
+            int                        boneIndex  = ReadInt  (reader);
+            int                        frameCount = ReadCount(reader, 3 + ASkeletonBinary_CurveSize);
+            SkeletonTranslateTimeline* translateTimeline;
+
+            if (CheckIndex(reader, boneIndex, skeletonData->boneDataOrderArr->length) == false)
+            {
+                return NULL;
+            }
+
+            if (type == SkeletonBinaryTimeline_Translate)
+            {
+                translateTimeline = ASkeletonTimeline->CreateTranslate(frameCount, boneIndex);
+            }
+            else
+            {
+                translateTimeline = ASkeletonTimeline->CreateScale(frameCount, boneIndex)->translateTimeline;
+            }
+
+            // each frame is time, x, y
+            ReadBinaryFrames(reader, translateTimeline->frameArr, frameCount, 3);
+            ReadBinaryCurves(reader, translateTimeline->curveTimeline, frameCount);
+
+            if (type == SkeletonBinaryTimeline_Translate)
+            {
+                float* frames = translateTimeline->frameArr->data;
+
+                for (int i = 0; i < translateTimeline->frameArr->length; i += 3)
+                {
+                    frames[i + 1] = AGLTool_ToGLWidth (frames[i + 1]) * ASkeletonData->scale;
+                    frames[i + 2] = AGLTool_ToGLHeight(frames[i + 2]) * ASkeletonData->scale;
+                }
+            }
+
+            return translateTimeline->skeletonTimeline;
+        }
+
+        case SkeletonBinaryTimeline_Color:
+        {
+            int slotIndex  = ReadInt  (reader);
+            int frameCount = ReadCount(reader, 5 + ASkeletonBinary_CurveSize);
+
+            if (CheckIndex(reader, slotIndex, skeletonData->slotDataOrderArr->length) == false)
+            {
+                return NULL;
+            }
+
+            SkeletonColorTimeline* colorTimeline = ASkeletonTimeline->CreateColor(frameCount);
+            colorTimeline->slotIndex             = slotIndex;
+
+            // each frame is time, r, g, b, a
+            ReadBinaryFrames(reader, colorTimeline->frameArr, frameCount, 5);
+            ReadBinaryCurves(reader, colorTimeline->curveTimeline, frameCount);
+
+            return colorTimeline->skeletonTimeline;
+        }
+
+        case SkeletonBinaryTimeline_Attachment:
+        {
+            // each frame is time and name
+            int    slotIndex  = ReadInt  (reader);
+            int    frameCount = ReadCount(reader, 2);
+            float* times      = ReadBlock(reader, frameCount);
+
+            if (CheckIndex(reader, slotIndex, skeletonData->slotDataOrderArr->length) == false)
+            {
+                return NULL;
+            }
+
+            SkeletonAttachmentTimeline* attachmentTimeline = ASkeletonTimeline->CreateAttachment(frameCount);
+            attachmentTimeline->slotIndex                  = slotIndex;
+
+            for (int i = 0; i < frameCount; ++i)
+            {
+                ASkeletonTimeline->SetAttachmentFrame(attachmentTimeline, i, times[i], ReadString(reader));
+            }
+
+            return attachmentTimeline->skeletonTimeline;
+        }
+
+        case SkeletonBinaryTimeline_Event:
+        {
+            // each frame is time, name, string, int, float
+            int                    frameCount    = ReadCount(reader, 5);
+            float*                 times         = ReadBlock(reader, frameCount);
+            SkeletonEventTimeline* eventTimeline = ASkeletonTimeline->CreateEvent(frameCount);
+
+            for (int i = 0; i < frameCount; ++i)
+            {
+                SkeletonEventData* eventData = malloc(sizeof(SkeletonEventData));
+                eventData->name              = ReadName  (reader);
+                eventData->stringValue       = ReadString(reader);
+                eventData->intValue          = ReadInt   (reader);
+                eventData->floatValue        = ReadFloat (reader);
+
+                ASkeletonTimeline->SetEventFrame(eventTimeline, i, times[i], eventData);
+            }
+
+            return eventTimeline->skeletonTimeline;
+        }
+
+        case SkeletonBinaryTimeline_DrawOrder:
+        {
+            // each frame is time and whether has draw order
+            int                        frameCount        = ReadCount(reader, 2);
+            int                        slotCount         = skeletonData->slotDataOrderArr->length;
+            float*                     times             = ReadBlock(reader, frameCount);
+            SkeletonDrawOrderTimeline* drawOrderTimeline = ASkeletonTimeline->CreateDrawOrder(frameCount);
+
+            for (int i = 0; i < frameCount; ++i)
+            {
+                Array(int)* drawOrderArr = NULL;
+
+                if (ReadInt(reader) != 0)
+                {
+                    int* drawOrder = ReadBlock(reader, slotCount);
+
+                    if (drawOrder != NULL)
+                    {
+                        drawOrderArr = AArray->Create(sizeof(int), slotCount);
+                        memcpy(drawOrderArr->data, drawOrder, sizeof(int) * slotCount);
+                    }
+                }
+
+                ASkeletonTimeline->SetDrawOrderFrame(drawOrderTimeline, i, times[i], drawOrderArr);
+            }
+
+            return drawOrderTimeline->skeletonTimeline;
+        }
+
+        case SkeletonBinaryTimeline_Deform:
+        {
+            // each frame is time, curve, start, count
+            int    slotIndex       = ReadInt  (reader);
+            int    attachmentIndex = ReadInt  (reader);
+            int    frameCount      = ReadCount(reader, 3 + ASkeletonBinary_CurveSize);
+            float* times           = ReadBlock(reader, frameCount);
+
+            if
+            (
+                CheckIndex(reader, slotIndex,       skeletonData->slotDataOrderArr->length) == false ||
+                CheckIndex(reader, attachmentIndex, attachmentDataList->size)               == false
+            )
+            {
+                return NULL;
+            }
+
+            SkeletonAttachmentData* attachmentData = AArrayList_Get
+                                                     (
+                                                         attachmentDataList,
+                                                         attachmentIndex,
+                                                         SkeletonAttachmentData*
+                                                     );
+
+            if
+            (
+                attachmentData->type != SkeletonAttachmentDataType_Mesh &&
+                attachmentData->type != SkeletonAttachmentDataType_SkinnedMesh
+            )
+            {
+                SetBroken(reader, "deform attachment is not mesh");
+                return NULL;
+            }
+
+            SkeletonDeformTimeline* deformTimeline = ASkeletonTimeline->CreateDeform(frameCount);
+            Array(float)*           meshVertices;
+
+            deformTimeline->slotIndex      = slotIndex;
+            deformTimeline->attachmentData = attachmentData;
+
+            if (attachmentData->type == SkeletonAttachmentDataType_Mesh)
+            {
+                meshVertices = ((SkeletonMeshAttachmentData*) attachmentData->childPtr)->vertexArr;
+                ((SkeletonMeshAttachmentData*) attachmentData->childPtr)->isDeformed = true;
+            }
+            else
+            {
+                meshVertices = ((SkeletonSkinnedMeshAttachmentData*) attachmentData->childPtr)->weightVertexArr;
+            }
+
+            ReadBinaryCurves(reader, deformTimeline->curveTimeline, frameCount);
+
+            for (int i = 0; i < frameCount; ++i)
+            {
+                int           start     = ReadInt  (reader);
+                int           count     = ReadCount(reader, 1);
+                float*        offsets   = ReadBlock(reader, count);
+                Array(float)* vertexArr = AArray->Create(sizeof(float), meshVertices->length);
+                float*        vertices  = vertexArr->data;
+
+                memcpy(vertices, meshVertices->data, sizeof(float) * meshVertices->length);
+
+                // the offsets must be in the vertices
+                if (count > 0)
+                {
+                    if (CheckIndex(reader, start, meshVertices->length))
+                    {
+                        int last = start + count - 1;
+
+                        if (CheckIndex(reader, (last >> 1) + last, meshVertices->length) == false)
+                        {
+                            count = 0;
+                        }
+                    }
+                    else
+                    {
+                        count = 0;
+                    }
+                }
+
+                // same as ReadAnimationDeform, the offsets x, y add to vertices x, y, z
+                for (int j = 0; j < count; ++j, ++start)
+                {
+                    vertices[(start >> 1) + start] += AGLTool_ToGLWidth(offsets[j] * ASkeletonData->scale);
+                }
+
+                ASkeletonTimeline->SetDeformFrame(deformTimeline, i, times[i], vertexArr);
+            }
+
+            return deformTimeline->skeletonTimeline;
+        }
+
+        default:
+            SetBroken(reader, "invalid timeline type");
+            return NULL;
+    }
+}
+
+
+static inline void ReadBinaryAnimationData
+(
+    BinaryReader*                       reader,
+    SkeletonData*                       skeletonData,
+    ArrayList(SkeletonAttachmentData*)* attachmentDataList
+)
+{
+    int          animationCount   = ReadCount(reader, 1);
+    ArrayStrMap* animationDataMap = skeletonData->animationDataMap;
+
+    AArrayStrMap->InitWithCapacity(sizeof(SkeletonAnimationData*), animationCount, animationDataMap);
+
+    for (int i = 0; i < animationCount && reader->isBroken == false; ++i)
+    {
+        SkeletonAnimationData* animationData = malloc(sizeof(SkeletonAnimationData));
+        animationData->name                  = ReadName (reader);
+        animationData->duration              = ReadFloat(reader);
+        animationData->bakedAnimation        = NULL;
+        int timelineCount                    = ReadCount(reader, 1);
+
+        AArrayList->InitWithCapacity(sizeof(SkeletonTimeline*), timelineCount, animationData->timelineArr);
+
+        for (int j = 0; j < timelineCount && reader->isBroken == false; ++j)
+        {
+            SkeletonTimeline* skeletonTimeline = ReadBinaryTimeline(reader, skeletonData, attachmentDataList);
+
+            if (skeletonTimeline != NULL)
+            {
+                AArrayList_Add(animationData->timelineArr, skeletonTimeline);
+            }
+        }
+
+        AArrayStrMap_TryPut(animationDataMap, animationData->name, animationData);
+    }
+}
+
+
+/**
+ * Parse the compiled skeleton file, the names and attachment arrays point into the data without copy.
+ * return false if the file is broken, and the parsed data needs ReleaseData.
+ */
+static inline bool ParseBinary(SkeletonData* skeletonData, char* data)
+{
+    SkeletonBinaryHeader* header = (SkeletonBinaryHeader*) data;
+    BinaryReader          reader[1];
+
+    reader->data           = data;
+    reader->word           = (int32_t*) (data + header->bodyOffset);
+    reader->end            = reader->word;
+    reader->stringTableEnd = (int) header->bodyOffset;
+    reader->isBroken       = false;
+
+    if
+    (
+        header->bodyOffset < sizeof(SkeletonBinaryHeader) ||
+        header->bodyOffset > header->length               ||
+        header->bodyOffset % sizeof(int32_t) != 0
+    )
+    {
+        SetBroken(reader, "invalid body offset");
+    }
+    else
+    {
+        reader->end += (header->length - header->bodyOffset) / sizeof(int32_t);
+    }
+
+    ArrayList(SkeletonAttachmentData*) attachmentDataList[1];
+    AArrayList->Init(sizeof(SkeletonAttachmentData*), attachmentDataList);
+
+    skeletonData->width  = AGLTool_ToGLWidth (ReadFloat(reader));
+    skeletonData->height = AGLTool_ToGLHeight(ReadFloat(reader));
+
+    ReadBinaryBoneData     (reader, skeletonData);
+    ReadBinarySlotData     (reader, skeletonData);
+    ReadBinaryEventData    (reader, skeletonData);
+    ReadBinarySkinData     (reader, skeletonData, attachmentDataList);
+    ReadBinaryAnimationData(reader, skeletonData, attachmentDataList);
+
+    if ((char*) reader->word != data + header->length)
+    {
+        SetBroken(reader, "read bytes not equal file length");
+    }
+
+    AArrayList->Release(attachmentDataList);
+
+    return reader->isBroken == false;
+}
+
+
+static inline void InitAtlas(SkeletonData* skeletonData, char* atlasPath)
+{
+    skeletonData->textureAtlas                 = ATextureAtlas->Get(atlasPath);
+    ArrayStrMap*              skinDataMap      = skeletonData->skinDataMap;
+    Array(SkeletonSlotData*)* slotDataOrderArr = skeletonData->slotDataOrderArr;
+
+    AArrayList->InitWithCapacity(sizeof(SkeletonAttachmentData*), 20, skeletonData->attachmentDataList);
+
+    int quadCounts[skeletonData->textureAtlas->textureList->size];
+    memset(quadCounts, 0, sizeof(int) * skeletonData->textureAtlas->textureList->size);
+
+    for (int i = 0; i < slotDataOrderArr->length; ++i)
+    {
+        SkeletonSlotData* slotData   = AArray_Get(slotDataOrderArr, i, SkeletonSlotData*);
+        slotData->attachmentDataList = AArrayList->Create(sizeof(SkeletonAttachmentData*));
+
+        // search all skin attachment
+        for (int j = 0; j < skinDataMap->elementList->size; ++j)
+        {
+            // char*          skinName      = AArrayStrMap->GetKey(skinDataMap, j);
+            SkeletonSkinData* skinData      = AArrayStrMap_GetAt(skinDataMap, j, SkeletonSkinData*);
+            ArrayIntMap*      attachmentMap = AArray_Get(skinData->slotAttachmentArr, i, ArrayIntMap*);
+
+            if (attachmentMap == NULL)
+            {
+                continue;
+            }
+
+            for (int k = 0; k < attachmentMap->elementList->size; ++k)
+            {
+                SkeletonAttachmentData* attachmentData = AArrayIntMap_GetAt(attachmentMap, k, SkeletonAttachmentData*);
+
+                if (attachmentData->type == SkeletonAttachmentDataType_BoundingBox)
+                {
+                    continue;
+                }
+
+                // collect each skin attachmentData
+                AArrayList_Add(slotData->attachmentDataList,     attachmentData);
+                // collect all skin attachmentData
+                AArrayList_Add(skeletonData->attachmentDataList, attachmentData);
+
+                TextureAtlasQuad* atlasQuad = ATextureAtlas_GetQuad(skeletonData->textureAtlas, attachmentData->name);
+                ALog_A
+                (
+                    atlasQuad != NULL,
+                    "ASkeletonData InitAtlas cannot find attachment in TextureAtlas by name = %s",
+                    attachmentData->name
+                );
+
+                switch (attachmentData->type)
+                {
+                    case SkeletonAttachmentDataType_Region:
+                    {
+                        SkeletonRegionAttachmentData* regionAttachmentData = attachmentData->childPtr;
+                        regionAttachmentData->meshIndex                    = atlasQuad->textureIndex;
+                        regionAttachmentData->quad                         = atlasQuad->quad;
+                        regionAttachmentData->subMeshIndex                 = quadCounts[atlasQuad->textureIndex]++;
+                        break;
+                    }
+
+                    case SkeletonAttachmentDataType_SkinnedMesh:
+                    case SkeletonAttachmentDataType_Mesh:
+                    {
+                        SkeletonMeshAttachmentData* meshData;
+
+                        if (attachmentData->type == SkeletonAttachmentDataType_SkinnedMesh)
+                        {
+                            meshData = ((SkeletonSkinnedMeshAttachmentData*) attachmentData->childPtr)
+                                       ->meshAttachmentData;
+                        }
+                        else
+                        {
+                            meshData = (SkeletonMeshAttachmentData*) attachmentData->childPtr;
+                        }
+
+                        meshData->meshIndex    = atlasQuad->textureIndex;
+                        meshData->quad         = atlasQuad->quad;
+                        meshData->subMeshIndex = quadCounts[atlasQuad->textureIndex]++;
+                        break;
+                    }
+                        
+                    case SkeletonAttachmentDataType_BoundingBox:
+                        break;
+                }
+            }
+        }
+
+        AArrayList->Shrink(slotData->attachmentDataList);
+        AArrayList->Shrink(skeletonData->attachmentDataList);
+    }
+}
+
+
+/**
+ * Init the atlas and meshList of parsed SkeletonData, and put it into cache.
+ */
+static inline void AddToCache(SkeletonData* skeletonData, const char* jsonFilePath, long bytes)
+{
+    char path[strlen(jsonFilePath) + sizeof(".atlas")];
+    sprintf(path, "%s.atlas", jsonFilePath);
+    InitAtlas(skeletonData, path);
+
+    // the shared meshes are created by first Skeleton
+    AArrayList->Init(sizeof(Mesh), skeletonData->meshList);
+
+    skeletonData->filePath = AHashStrMap_GetKey(AHashStrMap_TryPut(skeletonDataMap, jsonFilePath, skeletonData));
+
+    AResource->Add(ResourceClass_SkeletonData, bytes, Evict, skeletonData->resourceRef);
+}
+
+
+static SkeletonData* GetWithJson(const char* jsonFilePath, JsonValue* value)
+{
+    SkeletonData* skeletonData = AHashStrMap_Get(skeletonDataMap, jsonFilePath, SkeletonData*);
+
+    if (skeletonData == NULL)
+    {
+        skeletonData                = malloc(sizeof(SkeletonData));
+        skeletonData->mapping->data = NULL;
+        Parse(skeletonData, value->jsonObject);
+
+        // the parsed data is about the size of json tree
+        AddToCache(skeletonData, jsonFilePath, AJson->GetBytes(value));
+    }
+    else
+    {
+        AResource->Retain(skeletonData->resourceRef);
+    }
+
+    return skeletonData;
+}
+
+
+static SkeletonData* GetWithBinary(const char* jsonFilePath, FileMapping* mapping)
+{
+    SkeletonData* skeletonData = AHashStrMap_Get(skeletonDataMap, jsonFilePath, SkeletonData*);
+
+    if (skeletonData == NULL)
+    {
+        skeletonData           = malloc(sizeof(SkeletonData));
+        *skeletonData->mapping = *mapping;
+
+        if (ParseBinary(skeletonData, mapping->data))
+        {
+            // the parsed data is mostly in the mapped file
+            AddToCache(skeletonData, jsonFilePath, mapping->length);
+        }
+        else
+        {
+            ALog_E("ASkeletonData GetWithBinary failed to load broken file %s.json", jsonFilePath);
+
+            ReleaseData(skeletonData);
+            AFileTool->ReleaseMappedData(mapping);
+            free(skeletonData);
+            skeletonData = NULL;
+        }
+    }
+    else
+    {
+        AFileTool->ReleaseMappedData(mapping);
+        AResource->Retain(skeletonData->resourceRef);
+    }
+
+    mapping->data = NULL;
+
+    return skeletonData;
+}
+
+
+static SkeletonData* Get(const char* jsonFilePath)
+{
+    SkeletonData* skeletonData = AHashStrMap_Get(skeletonDataMap, jsonFilePath, SkeletonData*);
+
+    if (skeletonData == NULL)
+    {
+        char path[strlen(jsonFilePath) + sizeof(".json")];
+        sprintf(path, "%s.json", jsonFilePath);
+
+        FileMapping mapping[1];
+        AFileTool->CreateMappedDataFromResource(path, mapping);
+
+        if (ASkeletonBinary_IsValid(mapping->data, mapping->length))
+        {
+            skeletonData = GetWithBinary(jsonFilePath, mapping);
+        }
+        else
+        {
+            JsonValue* value = AJson->ParseMapping(mapping);
+            skeletonData     = GetWithJson(jsonFilePath, value);
+            AJson->Destroy(value);
+        }
+    }
+    else
+    {
+        AResource->Retain(skeletonData->resourceRef);
+    }
+
+//  Release(skeletonData);
+//  ALog_A(0, "Stop");
+
+    return skeletonData;
+}
+
+
+static SkeletonData* Find(const char* jsonFilePath)
+{
+    return AHashStrMap_Get(skeletonDataMap, jsonFilePath, SkeletonData*);
 }
 
 
@@ -1502,8 +2540,11 @@ struct ASkeletonData ASkeletonData[1] =
 {{
     1.0f,
     Get,
+    GetWithJson,
+    GetWithBinary,
+    Find,
     Release,
-    GetAttachmentDataBySkinData,
+    GetAttachmentDataBySlotIndex,
 }};
 
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-6-27
- * Update   : 2019-2-13
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -20,6 +20,9 @@
 
 #include <stdbool.h>
 #include "Engine/Toolkit/Utils/ArrayStrMap.h"
+#include "Engine/Toolkit/Utils/ArrayIntMap.h"
+#include "Engine/Toolkit/Utils/Json.h"
+#include "Engine/Toolkit/Platform/File.h"
 #include "Engine/Graphics/Draw/Color.h"
 #include "Engine/Graphics/OpenGL/Mesh.h"
 #include "Engine/Extension/TextureAtlas.h"
@@ -42,6 +45,11 @@ struct  SkeletonBoneData
     float             scaleY;
     bool              isInheritScale;
     bool              isInheritRotation;
+
+    /**
+     * The index in SkeletonData's boneDataOrderArr, also the index of SkeletonBone in Skeleton's boneArr.
+     */
+    int               index;
 };
 
 
@@ -52,6 +60,12 @@ typedef struct
 {
     const char*                         name;
     const char*                         attachmentName;
+
+    /**
+     * The atom of attachmentName, -1 if attachmentName is NULL.
+     */
+    int                                 attachmentNameAtom;
+
     bool                                isAdditiveBlending;
     SkeletonBoneData*                   boneData;
     Color                               color[1];
@@ -60,6 +74,11 @@ typedef struct
      * The skin's SkeletonAttachmentData may not exits.
      */
     ArrayList(SkeletonAttachmentData*)* attachmentDataList;
+
+    /**
+     * The index in SkeletonData's slotDataOrderArr, also the index of SkeletonSlot in Skeleton's slotArr.
+     */
+    int                                 index;
 }
 SkeletonSlotData;
 
@@ -77,6 +96,8 @@ typedef struct
 SkeletonEventData;
 
 
+typedef struct SkeletonBakedAnimation SkeletonBakedAnimation;
+
 /**
  * The skeleton animation data read from json file.
  */
@@ -85,6 +106,11 @@ typedef struct
     const char*                  name;
     float                        duration;
     ArrayList(SkeletonTimeline*) timelineArr[1];
+
+    /**
+     * The baked samples of timelineArr shared by all players, NULL until baked.
+     */
+    SkeletonBakedAnimation*      bakedAnimation;
 }
 SkeletonAnimationData;
 
@@ -95,15 +121,17 @@ SkeletonAnimationData;
 typedef struct
 {
     /**
-     * The slotAttachmentMap key is slotData name,        value is attachmentDataMap.
-     * the attachmentDataMap key is slot attachment name, value is SkeletonAttachmentData.
+     * The attachmentDataMap of each slot resolved at load time, the names are found by slotDataMap and AAtom.
+     *
+     * the index is slot index in SkeletonData's slotDataOrderArr,
+     * the value is attachmentDataMap or NULL if the skin has no attachment of the slot.
+     * the attachmentDataMap key is atom of slot attachment name, value is SkeletonAttachmentData.
      */
-    ArrayStrMap
+    Array
     (
-        slotName,
-        ArrayStrMap(attachmentName, SkeletonAttachmentData*)*
-    )
-    slotAttachmentMap[1];
+        ArrayIntMap(attachmentNameAtom, SkeletonAttachmentData*)*
+    )*
+    slotAttachmentArr;
 
     const char* name;
 }
@@ -221,6 +249,12 @@ typedef struct
      * Whether convert uv data to TextureAtlas.
      */
     bool                   isUVMappedInTexture;
+
+    /**
+     * Whether the vertices are changed by SkeletonDeformTimeline,
+     * then the SubMesh positions cannot be shared by Skeletons.
+     */
+    bool                   isDeformed;
 }
 SkeletonMeshAttachmentData;
 
@@ -306,6 +340,23 @@ typedef struct
      * All slot attachments.
      */
     ArrayList(SkeletonAttachmentData*)                    attachmentDataList[1];
+
+    /**
+     * The meshes that share children, uv and index data to the meshList of Skeletons,
+     * it is created by first Skeleton of this SkeletonData.
+     */
+    ArrayList(Mesh)                                       meshList[1];
+
+    /**
+     * The references of SkeletonData, and it references the textureAtlas.
+     */
+    ResourceRef                                           resourceRef[1];
+
+    /**
+     * The mapped data of compiled skeleton file that names and attachment arrays point into,
+     * the data is NULL if parsed from JSON.
+     */
+    FileMapping                                           mapping[1];
 }
 SkeletonData;
 
@@ -321,19 +372,51 @@ struct ASkeletonData
     float scale;
 
     /**
-     * Get SkeletonData by jsonFilePath, not found will create one.
+     * Get SkeletonData by jsonFilePath, not found or evicted will create one.
+     * the SkeletonData is referenced, and needs to Release after using.
+     * the "jsonFilePath.json" can be Spine JSON or the compiled skeleton file with same name,
+     * and the broken compiled skeleton file fails with error log and returns NULL.
      *
      * jsonFilePath:
      *     Android: assets
      *     IOS    : NSBundle
      */
     SkeletonData*           (*Get)                        (const char*          jsonFilePath);
+
+    /**
+     * Get SkeletonData by jsonFilePath, not found will create one from the value parsed from "jsonFilePath.json".
+     * the SkeletonData is referenced same as Get, and the value is not destroyed, and not used if SkeletonData found.
+     */
+    SkeletonData*           (*GetWithJson)                (const char*          jsonFilePath, JsonValue* value);
+
+    /**
+     * Get SkeletonData by jsonFilePath, not found will create one from the mapping of "jsonFilePath.json",
+     * which is compiled by the build tool SkeletonCompiler and checked by ASkeletonBinary_IsValid.
+     * the SkeletonData is referenced same as Get,
+     * and the mapping is held by created SkeletonData or released if SkeletonData found, then it is cleared.
+     * the reads are checked against the file length, if the file is broken returns NULL and releases the mapping.
+     */
+    SkeletonData*           (*GetWithBinary)              (const char*          jsonFilePath, FileMapping* mapping);
+
+    /**
+     * Find SkeletonData by jsonFilePath in cache, not found return NULL.
+     */
+    SkeletonData*           (*Find)                       (const char*          jsonFilePath);
+
+    /**
+     * Release the reference of SkeletonData, the unused one is kept in cache until evicted by AResource budget.
+     */
     void                    (*Release)                    (SkeletonData*        skeletonData);
-    SkeletonAttachmentData* (*GetAttachmentDataBySkinData)(
-                                                              SkeletonSkinData* skinData,
-                                                              const char*       slotName,
-                                                              const char*       attachmentName
-                                                          );
+
+    /**
+     * Get SkeletonAttachmentData by slot index in slotDataOrderArr and atom of slot attachment name,
+     * if not found return NULL.
+     */
+    SkeletonAttachmentData* (*GetAttachmentDataBySlotIndex)(
+                                                               SkeletonSkinData* skinData,
+                                                               int               slotIndex,
+                                                               int               attachmentNameAtom
+                                                           );
 };
 
 
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef SKELETON_SKINNING_H
+#define SKELETON_SKINNING_H
+
+
+/**
+ * The linear blend skinning kernel of skinned mesh, only depends on float arrays,
+ * so it can be benchmarked without the graphics, see Engine/Build/Tools/SkinningBenchmark.c.
+ */
+
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define SKELETON_SKINNING_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define SKELETON_SKINNING_NEON
+#endif
+
+
+/**
+ * The floats of bone affine: m0, m1, m4, m5, m12, m13 of bone modelMatrix,
+ * so x = m0 * vx + m4 * vy + m12, y = m1 * vx + m5 * vy + m13.
+ */
+#define SkeletonSkinning_AffineSize 6
+
+
+/**
+ * Linear blend skinning the weight vertices by bone affines, and write x, y into positions that stride is 3,
+ * the vector lanes are x and y of two weights, and the lanes of same vertex are added at last.
+ *
+ * bones         : each vertex is [boneCount, boneIndex ...], the boneIndex indexes affines.
+ * boneLength    : the length of bones.
+ * weights       : each vertex has boneCount weights.
+ * weightVertices: each vertex has boneCount [x, y, z].
+ */
+static inline void ASkeletonSkinning_SkinPositions
+(
+    const int*   bones,
+    int          boneLength,
+    const float* weights,
+    const float* weightVertices,
+    const float* affines,
+    float*       positions
+)
+{
+    for (int i = 0, w = 0, v = 0, p = 0; i < boneLength; p += 3)
+    {
+        int k = bones[i] + i + 1;
+
+        ++i;
+
+        #if defined(SKELETON_SKINNING_SSE2)
+
+        __m128 zero = _mm_setzero_ps();
+        __m128 sum  = zero;
+
+        for (; i + 1 < k; i += 2, w += 2, v += 6)
+        {
+            const __m64* affine0 = (const __m64*) (affines + bones[i]     * SkeletonSkinning_AffineSize);
+            const __m64* affine1 = (const __m64*) (affines + bones[i + 1] * SkeletonSkinning_AffineSize);
+
+            __m128       m0m1    = _mm_loadh_pi(_mm_loadl_pi(zero, affine0),     affine1);
+            __m128       m4m5    = _mm_loadh_pi(_mm_loadl_pi(zero, affine0 + 1), affine1 + 1);
+            __m128       m12m13  = _mm_loadh_pi(_mm_loadl_pi(zero, affine0 + 2), affine1 + 2);
+
+            // the two weight vertices are x0, y0, z0, x1, y1, z1
+            __m128       xyz0    = _mm_loadu_ps(weightVertices + v);
+            __m128       xyz1    = _mm_loadu_ps(weightVertices + v + 2);
+            __m128       w0w1    = _mm_loadl_pi(zero, (const __m64*) (weights + w));
+
+            __m128       x       = _mm_shuffle_ps(xyz0, xyz0, _MM_SHUFFLE(3, 3, 0, 0));
+            __m128       y       = _mm_shuffle_ps(xyz0, xyz1, _MM_SHUFFLE(2, 2, 1, 1));
+            __m128       weight  = _mm_unpacklo_ps(w0w1, w0w1);
+
+            sum = _mm_add_ps
+                  (
+                      sum,
+                      _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0m1, x), _mm_mul_ps(m4m5, y)), m12m13), weight)
+                  );
+        }
+
+        // add the weight of high lanes to low lanes
+        sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+
+        if (i < k)
+        {
+            const __m64* affine = (const __m64*) (affines + bones[i] * SkeletonSkinning_AffineSize);
+            __m128       m0m1   = _mm_loadl_pi(zero, affine);
+            __m128       m4m5   = _mm_loadl_pi(zero, affine + 1);
+            __m128       m12m13 = _mm_loadl_pi(zero, affine + 2);
+
+            sum = _mm_add_ps
+                  (
+                      sum,
+                      _mm_mul_ps
+                      (
+                          _mm_add_ps
+                          (
+                              _mm_add_ps
+                              (
+                                  _mm_mul_ps(m0m1, _mm_set1_ps(weightVertices[v])),
+                                  _mm_mul_ps(m4m5, _mm_set1_ps(weightVertices[v + 1]))
+                              ),
+                              m12m13
+                          ),
+                          _mm_set1_ps(weights[w])
+                      )
+                  );
+
+            ++i;
+            ++w;
+            v += 3;
+        }
+
+        _mm_storel_pi((__m64*) (positions + p), sum);
+
+        #elif defined(SKELETON_SKINNING_NEON)
+
+        float32x4_t sum4 = vdupq_n_f32(0.0f);
+
+        for (; i + 1 < k; i += 2, w += 2, v += 6)
+        {
+            const float* affine0 = affines + bones[i]     * SkeletonSkinning_AffineSize;
+            const float* affine1 = affines + bones[i + 1] * SkeletonSkinning_AffineSize;
+
+            float32x4_t  m0m1    = vcombine_f32(vld1_f32(affine0),     vld1_f32(affine1));
+            float32x4_t  m4m5    = vcombine_f32(vld1_f32(affine0 + 2), vld1_f32(affine1 + 2));
+            float32x4_t  m12m13  = vcombine_f32(vld1_f32(affine0 + 4), vld1_f32(affine1 + 4));
+            float32x4_t  x       = vcombine_f32(vdup_n_f32(weightVertices[v]),     vdup_n_f32(weightVertices[v + 3]));
+            float32x4_t  y       = vcombine_f32(vdup_n_f32(weightVertices[v + 1]), vdup_n_f32(weightVertices[v + 4]));
+            float32x4_t  weight  = vcombine_f32(vdup_n_f32(weights[w]),            vdup_n_f32(weights[w + 1]));
+
+            sum4 = vmlaq_f32(sum4, vmlaq_f32(vmlaq_f32(m12m13, m0m1, x), m4m5, y), weight);
+        }
+
+        // add the weight of high lanes to low lanes
+        float32x2_t sum = vadd_f32(vget_low_f32(sum4), vget_high_f32(sum4));
+
+        if (i < k)
+        {
+            const float* affine = affines + bones[i] * SkeletonSkinning_AffineSize;
+
+            sum = vmla_n_f32
+                  (
+                      sum,
+                      vmla_n_f32
+                      (
+                          vmla_n_f32(vld1_f32(affine + 4), vld1_f32(affine), weightVertices[v]),
+                          vld1_f32(affine + 2),
+                          weightVertices[v + 1]
+                      ),
+                      weights[w]
+                  );
+
+            ++i;
+            ++w;
+            v += 3;
+        }
+
+        vst1_f32(positions + p, sum);
+
+        #else
+
+        float wx = 0.0f;
+        float wy = 0.0f;
+
+        for (; i < k; ++i, ++w, v += 3)
+        {
+            const float* affine = affines + bones[i] * SkeletonSkinning_AffineSize;
+            float        weight = weights[w];
+
+            wx += (affine[0] * weightVertices[v] + affine[2] * weightVertices[v + 1] + affine[4]) * weight;
+            wy += (affine[1] * weightVertices[v] + affine[3] * weightVertices[v + 1] + affine[5]) * weight;
+        }
+
+        positions[p]     = wx;
+        positions[p + 1] = wy;
+
+        #endif
+    }
+}
+
+
+#endif
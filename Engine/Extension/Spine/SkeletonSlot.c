@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-7-7
- * Update   : 2019-2-12
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -17,6 +17,28 @@
 #include <string.h>
 #include "Engine/Graphics/OpenGL/SubMesh.h"
 #include "Engine/Extension/Spine/SkeletonSlot.h"
+#include "Engine/Extension/Spine/SkeletonSkinning.h"
+#include "Engine/Toolkit/Utils/Arena.h"
+
+
+/**
+ * Gather the 2x3 affine of all bones modelMatrix into compact outAffines.
+ */
+static inline void GatherBoneAffines(Skeleton* skeleton, float* outAffines)
+{
+    for (int i = 0; i < skeleton->boneArr->length; ++i)
+    {
+        Matrix4* matrix = AArray_GetPtr(skeleton->boneArr, i, SkeletonBone)->drawable->modelMatrix;
+        float*   affine = outAffines + i * SkeletonSkinning_AffineSize;
+
+        affine[0]       = matrix->m0;
+        affine[1]       = matrix->m1;
+        affine[2]       = matrix->m4;
+        affine[3]       = matrix->m5;
+        affine[4]       = matrix->m12;
+        affine[5]       = matrix->m13;
+    }
+}
 
 
 static inline void SetAttachmentToBone(SkeletonSlot* slot)
@@ -98,41 +120,28 @@ static inline void SetAttachmentToBone(SkeletonSlot* slot)
                                                                              SubMesh*
                                                                            );
 
-            float* positions      = subMesh->positionArr->data;
-            int*   bones          = skinnedMeshAttachmentData->boneArr->data;
-            float* weights        = skinnedMeshAttachmentData->weightArr->data;
-            float* weightVertices = skinnedMeshAttachmentData->weightVertexArr->data;
-
-            for (int i = 0, w = 0, v = 0, p = 0; i < skinnedMeshAttachmentData->boneArr->length; p += 3)
-            {
-                float wx = 0.0f;
-                float wy = 0.0f;
-                int   k  = bones[i] + i + 1;
-                
-                ++i;
-
-                for (; i < k; ++i, ++w, v += 3)
-                {
-                    int           boneIndex = bones[i];
-                    SkeletonBone* bone      = AArray_GetPtr(slot->skeleton->boneArr, boneIndex, SkeletonBone);
-                    float         weight    = weights[w];
-                    Vector2       v2[1];
-
-                    AMatrix->MultiplyMV2
-                    (
-                        bone->drawable->modelMatrix,
-                        weightVertices[v],
-                        weightVertices[v + 1],
-                        v2
-                    );
-
-                    wx += v2->x * weight;
-                    wy += v2->y * weight;
-                }
-
-                positions[p]     = wx;
-                positions[p + 1] = wy;
-            }
+            Arena*    arena    = AArena->scratchArena;
+            ArenaMark mark     = AArena->GetMark(arena);
+            float*    affines  = AArena_AllocArr
+                                 (
+                                     arena,
+                                     float,
+                                     slot->skeleton->boneArr->length * SkeletonSkinning_AffineSize
+                                 );
+
+            GatherBoneAffines(slot->skeleton, affines);
+
+            ASkeletonSkinning_SkinPositions
+            (
+                skinnedMeshAttachmentData->boneArr->data,
+                skinnedMeshAttachmentData->boneArr->length,
+                skinnedMeshAttachmentData->weightArr->data,
+                skinnedMeshAttachmentData->weightVertexArr->data,
+                affines,
+                subMesh->positionArr->data
+            );
+
+            AArena->Rollback(arena, mark);
 
             drawable = subMesh->drawable;
             // we compute final world coordinate, so no parent
@@ -200,7 +209,7 @@ static void Init(SkeletonSlotData* slotData, Skeleton* skeleton, SkeletonSlot* o
     outSlot->slotData       = slotData;
     outSlot->skeleton       = skeleton;
     outSlot->attachmentData = NULL;
-    outSlot->bone           = AArrayStrMap_Get(skeleton->boneMap, slotData->boneData->name, SkeletonBone*);
+    outSlot->bone           = AArray_GetPtr(skeleton->boneArr, slotData->boneData->index, SkeletonBone);
 
     SetToSetupPose(outSlot);
 }
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-7-3
- * Update   : 2019-2-2
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -20,6 +20,8 @@
 #include "Engine/Graphics/OpenGL/SubMesh.h"
 #include "Engine/Extension/Spine/SkeletonTimeline.h"
 #include "Engine/Toolkit/Platform/Log.h"
+#include "Engine/Toolkit/Utils/Atom.h"
+#include "Engine/Toolkit/Utils/Arena.h"
 
 
 /**
@@ -249,41 +251,41 @@ static void SetRotateFrame(SkeletonRotateTimeline* rotateTimeline, int frameInde
 }
 
 
-static void RotateApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+/**
+ * Wrap the angle amount in [-180, 180].
+ */
+static inline float WrapAngle(float amount)
 {
-    SkeletonRotateTimeline* rotateTimeline = skeletonTimeline->childPtr;
+    while (amount > 180)
+    {
+        amount -= 360;
+    }
+
+    while (amount < -180)
+    {
+        amount += 360;
+    }
+
+    return amount;
+}
 
+
+static inline bool GetRotateValue(SkeletonRotateTimeline* rotateTimeline, float time, float* outAngle)
+{
     float* frames      = rotateTimeline->frameArr->data;
     int    frameLength = rotateTimeline->frameArr->length;
 
     if (time < frames[0])
     {
         // time is before first frame
-        return;
+        return false;
     }
 
-    SkeletonBone*     bone     = AArray_GetPtr(skeleton->boneArr, rotateTimeline->boneIndex, SkeletonBone);
-    SkeletonBoneData* boneData = bone->boneData;
-    Drawable*         drawable = bone->drawable;
-
     if (time >= frames[frameLength - RotateFrame_Times])
     {
         // time is after last frame
-
-        float amount = boneData->rotationZ + frames[frameLength - 1] - drawable->rotationZ;
-
-        while (amount > 180)
-        {
-            amount -= 360;
-        }
-
-        while (amount < -180)
-        {
-            amount += 360;
-        }
-
-        ADrawable_SetRotationZ(drawable, drawable->rotationZ + amount * mixPercent);
-        return;
+        *outAngle = frames[frameLength - 1];
+        return true;
     }
 
     // interpolate between the last frame and the current frame
@@ -296,31 +298,33 @@ static void RotateApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton,
                               rotateTimeline->curveTimeline, (frameIndex >> 1) - 1,
                               1.0f - (time - frameTime) / (frames[frameIndex - RotateFrame_Times] - frameTime)
                           );
-    float amount         = frames[frameIndex + RotateFrame_Value] - lastFrameValue;
+    float amount         = WrapAngle(frames[frameIndex + RotateFrame_Value] - lastFrameValue);
 
-    while (amount > 180)
-    {
-        amount -= 360;
-    }
+    *outAngle            = lastFrameValue + amount * percent;
 
-    while (amount < -180)
-    {
-        amount += 360;
-    }
+    return true;
+}
 
-    amount = boneData->rotationZ + (lastFrameValue + amount * percent) - drawable->rotationZ;
 
-    while (amount > 180)
-    {
-        amount -= 360;
-    }
+static inline void ApplyRotateValue(SkeletonRotateTimeline* rotateTimeline, Skeleton* skeleton, float angle, float mixPercent)
+{
+    SkeletonBone* bone     = AArray_GetPtr(skeleton->boneArr, rotateTimeline->boneIndex, SkeletonBone);
+    Drawable*     drawable = bone->drawable;
+    float         amount   = WrapAngle(bone->boneData->rotationZ + angle - drawable->rotationZ);
 
-    while (amount < -180)
+    ADrawable_SetRotationZ(drawable, drawable->rotationZ + amount * mixPercent);
+}
+
+
+static void RotateApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+{
+    SkeletonRotateTimeline* rotateTimeline = skeletonTimeline->childPtr;
+    float                   angle;
+
+    if (GetRotateValue(rotateTimeline, time, &angle))
     {
-        amount += 360;
+        ApplyRotateValue(rotateTimeline, skeleton, angle, mixPercent);
     }
-
-    ADrawable_SetRotationZ(drawable, drawable->rotationZ + amount * mixPercent);
 }
 
 
@@ -343,6 +347,7 @@ static SkeletonRotateTimeline* CreateRotate(int frameCount, int boneIndex)
     rotateTimeline->skeletonTimeline->Apply    = RotateApply;
     rotateTimeline->skeletonTimeline->Release  = RotateRelease;
     rotateTimeline->skeletonTimeline->childPtr = rotateTimeline;
+    rotateTimeline->skeletonTimeline->type     = SkeletonTimelineType_Rotate;
 
     rotateTimeline->frameArr                   = AArray->Create(sizeof(float), frameCount * RotateFrame_Times);
     rotateTimeline->boneIndex                  = boneIndex;
@@ -372,35 +377,26 @@ static void SetTranslateFrame(SkeletonTranslateTimeline* translateTimeline, int
 }
 
 
-static void TranslateApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+/**
+ * The outValues are x and y of Translate or Scale timeline.
+ */
+static inline bool GetTranslateValues(SkeletonTranslateTimeline* translateTimeline, float time, float* outValues)
 {
-    SkeletonTranslateTimeline* translateTimeline = skeletonTimeline->childPtr;
-    float*                     frames            = translateTimeline->frameArr->data;
+    float* frames = translateTimeline->frameArr->data;
 
     if (time < frames[0])
     {
-        return; // time is before first frame
+        return false; // time is before first frame
     }
 
-    int               frameLength = translateTimeline->frameArr->length;
-    SkeletonBone*     bone        = AArray_GetPtr(skeleton->boneArr, translateTimeline->boneIndex, SkeletonBone);
-    SkeletonBoneData* boneData    = bone->boneData;
-    Drawable*         drawable    = bone->drawable;
+    int frameLength = translateTimeline->frameArr->length;
 
     if (time >= frames[frameLength - TranslateFrame_Times])
     {
         // time is after last frame
-        // each frame value is relative boneData x or y
-        ADrawable_SetPosition2
-        (
-            drawable,
-            drawable->positionX +
-            (boneData->x + frames[frameLength - TranslateFrame_Y] - drawable->positionX) * mixPercent,
-            drawable->positionY +
-            (boneData->y + frames[frameLength - TranslateFrame_X] - drawable->positionY) * mixPercent
-        );
-
-        return;
+        outValues[0] = frames[frameLength - TranslateFrame_Y];
+        outValues[1] = frames[frameLength - TranslateFrame_X];
+        return true;
     }
 
     // interpolate between the last frame and the current frame.
@@ -414,27 +410,47 @@ static void TranslateApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleto
                             1.0f - (time - frameTime) / (frames[frameIndex - TranslateFrame_Times] - frameTime)
                         );
 
+    outValues[0]      = lastFrameX + (frames[frameIndex + TranslateFrame_X] - lastFrameX) * percent;
+    outValues[1]      = lastFrameY + (frames[frameIndex + TranslateFrame_Y] - lastFrameY) * percent;
+
+    return true;
+}
+
+
+static inline void ApplyTranslateValues
+(
+    SkeletonTranslateTimeline* translateTimeline,
+    Skeleton*                  skeleton,
+    const float*               values,
+    float                      mixPercent
+)
+{
+    SkeletonBone*     bone     = AArray_GetPtr(skeleton->boneArr, translateTimeline->boneIndex, SkeletonBone);
+    SkeletonBoneData* boneData = bone->boneData;
+    Drawable*         drawable = bone->drawable;
+
+    // each frame value is relative boneData x or y
     ADrawable_SetPosition2
     (
         drawable,
-        
-        drawable->positionX +
-        (
-            boneData->x + lastFrameX +
-            (frames[frameIndex + TranslateFrame_X] - lastFrameX) * percent - drawable->positionX
-        )
-        * mixPercent,
-
-        drawable->positionY +
-        (
-            boneData->y + lastFrameY +
-            (frames[frameIndex + TranslateFrame_Y] - lastFrameY) * percent - drawable->positionY
-        )
-        * mixPercent
+        drawable->positionX + (boneData->x + values[0] - drawable->positionX) * mixPercent,
+        drawable->positionY + (boneData->y + values[1] - drawable->positionY) * mixPercent
     );
 }
 
 
+static void TranslateApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+{
+    SkeletonTranslateTimeline* translateTimeline = skeletonTimeline->childPtr;
+    float                      values[2];
+
+    if (GetTranslateValues(translateTimeline, time, values))
+    {
+        ApplyTranslateValues(translateTimeline, skeleton, values, mixPercent);
+    }
+}
+
+
 static void TranslateRelease(SkeletonTimeline* skeletonTimeline)
 {
     SkeletonTranslateTimeline* translateTimeline = skeletonTimeline->childPtr;
@@ -452,6 +468,7 @@ static inline void TranslateTimelineInit(SkeletonTranslateTimeline* translateTim
     translateTimeline->skeletonTimeline->Apply    = TranslateApply;
     translateTimeline->skeletonTimeline->Release  = TranslateRelease;
     translateTimeline->skeletonTimeline->childPtr = translateTimeline;
+    translateTimeline->skeletonTimeline->type     = SkeletonTimelineType_Translate;
 
     translateTimeline->frameArr                   = AArray->Create(sizeof(float), frameCount * TranslateFrame_Times);
     translateTimeline->boneIndex                  = boneIndex;
@@ -470,69 +487,39 @@ static SkeletonTranslateTimeline* CreateTranslate(int frameCount, int boneIndex)
 //----------------------------------------------------------------------------------------------------------------------
 
 
-static void ScaleApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+static inline void ApplyScaleValues
+(
+    SkeletonTranslateTimeline* translateTimeline,
+    Skeleton*                  skeleton,
+    const float*               values,
+    float                      mixPercent
+)
 {
-    SkeletonScaleTimeline*     scaleTimeline     = skeletonTimeline->childPtr;
-    SkeletonTranslateTimeline* translateTimeline = scaleTimeline->translateTimeline;
+    SkeletonBone*     bone     = AArray_GetPtr(skeleton->boneArr, translateTimeline->boneIndex, SkeletonBone);
+    SkeletonBoneData* boneData = bone->boneData;
+    Drawable*         drawable = bone->drawable;
 
-    float* frames = translateTimeline->frameArr->data;
+    // each frame scale value is relative 1.0 not boneData scale
+    // so we use boneData scale - 1.0f
+    ADrawable_SetScale2
+    (
+        drawable,
+        drawable->scaleX + (boneData->scaleX - 1.0f + values[0] - drawable->scaleX) * mixPercent,
+        drawable->scaleY + (boneData->scaleY - 1.0f + values[1] - drawable->scaleY) * mixPercent
+    );
+}
 
-    if (time < frames[0])
-    {
-        return; // time is before first frame
-    }
 
-    int               frameLength = translateTimeline->frameArr->length;
-    SkeletonBone*     bone        = AArray_GetPtr(skeleton->boneArr, translateTimeline->boneIndex, SkeletonBone);
-    SkeletonBoneData* boneData    = bone->boneData;
-    Drawable*         drawable    = bone->drawable;
+static void ScaleApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+{
+    SkeletonScaleTimeline*     scaleTimeline     = skeletonTimeline->childPtr;
+    SkeletonTranslateTimeline* translateTimeline = scaleTimeline->translateTimeline;
+    float                      values[2];
 
-    if (time >= frames[frameLength - TranslateFrame_Times])
+    if (GetTranslateValues(translateTimeline, time, values))
     {
-        // time is after last frame
-        // each frame scale value is relative 1.0 not boneData scale
-        // so we use boneData scale - 1.0f
-        ADrawable_SetScale2
-        (
-            drawable,
-
-            drawable->scaleX +
-            (boneData->scaleX - 1.0f + frames[frameLength - TranslateFrame_Y] - drawable->scaleX) * mixPercent,
-
-            drawable->scaleY +
-            (boneData->scaleY - 1.0f + frames[frameLength - TranslateFrame_X] - drawable->scaleY) * mixPercent
-        );
-
-        return;
+        ApplyScaleValues(translateTimeline, skeleton, values, mixPercent);
     }
-
-    // interpolate between the last frame and the current frame.
-    int   frameIndex = BinarySearchByStep(frames, frameLength, time, TranslateFrame_Times);
-    float lastFrameX = frames[frameIndex - TranslateFrame_Y];
-    float lastFrameY = frames[frameIndex - TranslateFrame_X];
-    float frameTime  = frames[frameIndex];
-
-    float percent    = 1.0f - (time - frameTime) / (frames[frameIndex - TranslateFrame_Times] - frameTime);
-    percent          = GetCurvePercent(translateTimeline->curveTimeline, frameIndex / TranslateFrame_Times - 1, percent);
-
-    ADrawable_SetScale2
-    (
-        drawable,
-
-        drawable->scaleX +
-        (
-            boneData->scaleX - 1.0f + lastFrameX +
-            (frames[frameIndex + TranslateFrame_X] - lastFrameX) * percent - drawable->scaleX
-        )
-        * mixPercent,
-
-        drawable->scaleY +
-        (
-            boneData->scaleY - 1.0f + lastFrameY +
-            (frames[frameIndex + TranslateFrame_Y] - lastFrameY) * percent - drawable->scaleY
-        )
-        * mixPercent
-    );
 }
 
 
@@ -552,6 +539,7 @@ static SkeletonScaleTimeline* CreateScale(int frameCount, int boneIndex)
     scaleTimeline->translateTimeline->skeletonTimeline->Apply    = ScaleApply;
     scaleTimeline->translateTimeline->skeletonTimeline->Release  = ScaleRelease;
     scaleTimeline->translateTimeline->skeletonTimeline->childPtr = scaleTimeline;
+    scaleTimeline->translateTimeline->skeletonTimeline->type     = SkeletonTimelineType_Scale;
 
     return scaleTimeline;
 }
@@ -582,16 +570,64 @@ static void SetColorFrame(SkeletonColorTimeline* colorTimeline, int frameIndex,
 }
 
 
-static void ColorApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+static inline bool GetColorValues(SkeletonColorTimeline* colorTimeline, float time, float* outValues)
 {
-    SkeletonColorTimeline* colorTimeline = skeletonTimeline->childPtr;
-    float*                 frames        = colorTimeline->frameArr->data;
+    float* frames = colorTimeline->frameArr->data;
 
     if (time < frames[0])
     {
-        return; // time is before first frame
+        return false; // time is before first frame
+    }
+
+    int frameLength = colorTimeline->frameArr->length;
+
+    if (time >= frames[frameLength - ColorFrame_Times])
+    {
+        // time is after last frame.
+        outValues[0] = frames[frameLength - ColorFrame_A];
+        outValues[1] = frames[frameLength - ColorFrame_B];
+        outValues[2] = frames[frameLength - ColorFrame_G];
+        outValues[3] = frames[frameLength - ColorFrame_R];
+
+        return true;
     }
 
+    // interpolate between the last frame and the current frame.
+    int   frameIndex = BinarySearchByStep(frames, frameLength, time, ColorFrame_Times);
+    float frameTime  = frames[frameIndex];
+    float r          = frames[frameIndex - ColorFrame_A];
+    float g          = frames[frameIndex - ColorFrame_B];
+    float b          = frames[frameIndex - ColorFrame_G];
+    float a          = frames[frameIndex - ColorFrame_R];
+
+    float percent    = GetCurvePercent
+                       (
+                           colorTimeline->curveTimeline,
+                           frameIndex / ColorFrame_Times - 1,
+                           1.0f - (time - frameTime) / (frames[frameIndex - ColorFrame_Times] - frameTime)
+                       );
+
+    outValues[0]     = r + (frames[frameIndex + ColorFrame_R] - r) * percent;
+    outValues[1]     = g + (frames[frameIndex + ColorFrame_G] - g) * percent;
+    outValues[2]     = b + (frames[frameIndex + ColorFrame_B] - b) * percent;
+    outValues[3]     = a + (frames[frameIndex + ColorFrame_A] - a) * percent;
+
+    return true;
+}
+
+
+/**
+ * The values are r, g, b, a.
+ */
+static inline void ApplyColorValues
+(
+    SkeletonColorTimeline* colorTimeline,
+    Skeleton*              skeleton,
+    float                  time,
+    const float*           values,
+    float                  mixPercent
+)
+{
     SkeletonSlot* slot = AArray_GetPtr(skeleton->slotArr, colorTimeline->slotIndex, SkeletonSlot);
 
     if (slot->attachmentData == NULL)
@@ -599,53 +635,27 @@ static void ColorApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, f
         return;
     }
 
-    int    frameLength = colorTimeline->frameArr->length;
-    Color* color       = slot->color;
+    if (time >= AArray_Get(colorTimeline->frameArr, colorTimeline->frameArr->length - ColorFrame_Times, float))
+    {
+        // the last frame color is not mixed
+        mixPercent = 1.0f;
+    }
 
-    if (time >= frames[frameLength - ColorFrame_Times])
+    Color* color = slot->color;
+
+    if (mixPercent < 1.0f)
     {
-        // time is after last frame.
-        color->r = frames[frameLength - ColorFrame_A];
-        color->g = frames[frameLength - ColorFrame_B];
-        color->b = frames[frameLength - ColorFrame_G];
-        color->a = frames[frameLength - ColorFrame_R];
+        color->r = (values[0] - color->r) * mixPercent;
+        color->g = (values[1] - color->g) * mixPercent;
+        color->b = (values[2] - color->b) * mixPercent;
+        color->a = (values[3] - color->a) * mixPercent;
     }
     else
     {
-        // interpolate between the last frame and the current frame.
-        int   frameIndex = BinarySearchByStep(frames, frameLength, time, ColorFrame_Times);
-        float frameTime  = frames[frameIndex];
-        float r          = frames[frameIndex - ColorFrame_A];
-        float g          = frames[frameIndex - ColorFrame_B];
-        float b          = frames[frameIndex - ColorFrame_G];
-        float a          = frames[frameIndex - ColorFrame_R];
-
-        float percent    = GetCurvePercent
-                           (
-                               colorTimeline->curveTimeline,
-                               frameIndex / ColorFrame_Times - 1,
-                               1.0f - (time - frameTime) / (frames[frameIndex - ColorFrame_Times] - frameTime)
-                           );
-
-        r               += (frames[frameIndex + ColorFrame_R] - r) * percent;
-        g               += (frames[frameIndex + ColorFrame_G] - g) * percent;
-        b               += (frames[frameIndex + ColorFrame_B] - b) * percent;
-        a               += (frames[frameIndex + ColorFrame_A] - a) * percent;
-
-        if (mixPercent < 1.0f)
-        {
-            color->r = (r - color->r) * mixPercent;
-            color->g = (g - color->g) * mixPercent;
-            color->b = (b - color->b) * mixPercent;
-            color->a = (a - color->a) * mixPercent;
-        }
-        else
-        {
-            color->r = r;
-            color->g = g;
-            color->b = b;
-            color->a = a;
-        }
+        color->r = values[0];
+        color->g = values[1];
+        color->b = values[2];
+        color->a = values[3];
     }
 
     SubMesh* subMesh = ASkeleton->GetAttachmentSubMesh(skeleton, slot->attachmentData);
@@ -657,6 +667,18 @@ static void ColorApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, f
 }
 
 
+static void ColorApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+{
+    SkeletonColorTimeline* colorTimeline = skeletonTimeline->childPtr;
+    float                  values[4];
+
+    if (GetColorValues(colorTimeline, time, values))
+    {
+        ApplyColorValues(colorTimeline, skeleton, time, values, mixPercent);
+    }
+}
+
+
 static void ColorRelease(SkeletonTimeline* skeletonTimeline)
 {
     SkeletonColorTimeline* colorTimeline = skeletonTimeline->childPtr;
@@ -676,6 +698,7 @@ static SkeletonColorTimeline* CreateColor(int frameCount)
     colorTimeline->skeletonTimeline->Apply    = ColorApply;
     colorTimeline->skeletonTimeline->Release  = ColorRelease;
     colorTimeline->skeletonTimeline->childPtr = colorTimeline;
+    colorTimeline->skeletonTimeline->type     = SkeletonTimelineType_Color;
     colorTimeline->frameArr                   = AArray->Create(sizeof(float), frameCount * ColorFrame_Times);
 
     return colorTimeline;
@@ -693,37 +716,77 @@ static void SetAttachmentFrame
     const char*                 attachmentName
 )
 {
-    char* copyName = malloc(strlen(attachmentName) + 1);
-    strcpy(copyName, attachmentName);
+    // resolve name to atom at load time, so the apply no need to compare strings
+    int attachmentNameAtom = AAtom_InternNullable(attachmentName);
 
-    AArray_Set(attachmentTimeline->frameArr,          frameIndex, time,     float);
-    AArray_Set(attachmentTimeline->attachmentNameArr, frameIndex, copyName, const char*);
+    AArray_Set(attachmentTimeline->frameArr,              frameIndex, time,               float);
+    AArray_Set(attachmentTimeline->attachmentNameAtomArr, frameIndex, attachmentNameAtom, int);
 }
 
 
-static void AttachmentApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+/**
+ * Get the key frame index of time in frames that each group only has time, -1 if time is before first frame.
+ */
+static inline int GetStepFrameIndex(Array(float)* frameArr, float time)
 {
-    SkeletonAttachmentTimeline* attachmentTimeline = skeletonTimeline->childPtr;
-    float*                      frames             = attachmentTimeline->frameArr->data;
+    float* frames      = frameArr->data;
+    int    frameLength = frameArr->length;
 
-    // time is before first frame
     if (time < frames[0])
     {
-        attachmentTimeline->preFrameIndex = -1;
-        return;
+        // time is before first frame
+        return -1;
     }
 
-    int frameLength = attachmentTimeline->frameArr->length;
-    int frameIndex;
-
     if (time >= frames[frameLength - 1])
     {
         // time is after last frame
-        frameIndex = frameLength - 1;
+        return frameLength - 1;
     }
-    else
+
+    return BinarySearch(frames, frameLength, time) - 1;
+}
+
+
+static inline void ApplyAttachmentFrame(SkeletonAttachmentTimeline* attachmentTimeline, Skeleton* skeleton, int frameIndex)
+{
+    SkeletonSlot*           slot               = AArray_GetPtr
+                                                 (
+                                                     skeleton->slotArr,
+                                                     attachmentTimeline->slotIndex,
+                                                     SkeletonSlot
+                                                 );
+    int                     attachmentNameAtom = AArray_Get
+                                                 (
+                                                     attachmentTimeline->attachmentNameAtomArr,
+                                                     frameIndex,
+                                                     int
+                                                 );
+    SkeletonAttachmentData* attachmentData     = NULL;
+
+    if (attachmentNameAtom != -1)
     {
-        frameIndex = BinarySearch(frames, frameLength, time) - 1;
+        attachmentData = ASkeleton->GetAttachmentDataBySlotIndex
+                         (
+                             slot->skeleton,
+                             attachmentTimeline->slotIndex,
+                             attachmentNameAtom
+                         );
+    }
+
+    ASkeletonSlot->SetAttachmentData(slot, attachmentData);
+}
+
+
+static void AttachmentApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+{
+    SkeletonAttachmentTimeline* attachmentTimeline = skeletonTimeline->childPtr;
+    int                         frameIndex         = GetStepFrameIndex(attachmentTimeline->frameArr, time);
+
+    if (frameIndex == -1)
+    {
+        attachmentTimeline->preFrameIndex = -1;
+        return;
     }
 
     if (attachmentTimeline->preFrameIndex == frameIndex)
@@ -735,26 +798,7 @@ static void AttachmentApply(SkeletonTimeline* skeletonTimeline, Skeleton* skelet
         attachmentTimeline->preFrameIndex = frameIndex;
     }
 
-    SkeletonSlot*           slot           = AArray_GetPtr
-                                             (
-                                                 skeleton->slotArr,
-                                                 attachmentTimeline->slotIndex,
-                                                 SkeletonSlot
-                                             );
-    const char*             attachmentName = AArray_Get
-                                             (
-                                                 attachmentTimeline->attachmentNameArr,
-                                                 frameIndex,
-                                                 const char*
-                                             );
-    SkeletonAttachmentData* attachmentData = ASkeleton->GetAttachmentData
-                                             (
-                                                 slot->skeleton,
-                                                 slot->slotData->name,
-                                                 attachmentName
-                                             );
-
-    ASkeletonSlot->SetAttachmentData(slot, attachmentData);
+    ApplyAttachmentFrame(attachmentTimeline, skeleton, frameIndex);
 }
 
 
@@ -762,16 +806,11 @@ static void AttachmentRelease(SkeletonTimeline* skeletonTimeline )
 {
     SkeletonAttachmentTimeline* attachmentTimeline = skeletonTimeline->childPtr;
 
-    for (int i = 0; i < attachmentTimeline->attachmentNameArr->length; ++i)
-    {
-        free(AArray_Get(attachmentTimeline->attachmentNameArr, i, char*));
-    }
-
     free(attachmentTimeline->frameArr);
     attachmentTimeline->frameArr = NULL;
 
-    free(attachmentTimeline->attachmentNameArr);
-    attachmentTimeline->attachmentNameArr = NULL;
+    free(attachmentTimeline->attachmentNameAtomArr);
+    attachmentTimeline->attachmentNameAtomArr = NULL;
 }
 
 
@@ -782,9 +821,10 @@ static SkeletonAttachmentTimeline* CreateAttachment(int frameCount)
     attachmentTimeline->skeletonTimeline->Apply    = AttachmentApply;
     attachmentTimeline->skeletonTimeline->Release  = AttachmentRelease;
     attachmentTimeline->skeletonTimeline->childPtr = attachmentTimeline;
+    attachmentTimeline->skeletonTimeline->type     = SkeletonTimelineType_Attachment;
 
-    attachmentTimeline->frameArr                   = AArray->Create(sizeof(float),  frameCount);
-    attachmentTimeline->attachmentNameArr          = AArray->Create(sizeof(char*), frameCount);
+    attachmentTimeline->frameArr                   = AArray->Create(sizeof(float), frameCount);
+    attachmentTimeline->attachmentNameAtomArr      = AArray->Create(sizeof(int),   frameCount);
     attachmentTimeline->preFrameIndex              = -1;
 
 
@@ -875,6 +915,7 @@ static SkeletonEventTimeline* CreateEvent(int frameCount)
     eventTimeline->skeletonTimeline->Apply    = EventApply;
     eventTimeline->skeletonTimeline->Release  = EventRelease;
     eventTimeline->skeletonTimeline->childPtr = eventTimeline;
+    eventTimeline->skeletonTimeline->type     = SkeletonTimelineType_Event;
 
     eventTimeline->frameArr                   = AArray->Create(sizeof(float), frameCount);
     eventTimeline->eventArr                   = AArray->Create(sizeof(SkeletonEventData*), frameCount);
@@ -917,45 +958,11 @@ static void DrawOrderRelease(SkeletonTimeline* skeletonTimeline)
 }
 
 
-static void DrawOrderApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+static inline void ApplyDrawOrderFrame(SkeletonDrawOrderTimeline* drawOrderTimeline, Skeleton* skeleton, int frameIndex)
 {
-    SkeletonDrawOrderTimeline* drawOrderTimeline = skeletonTimeline->childPtr;
-
-    float* frames = drawOrderTimeline->frameArr->data;
-
-    // time is before first frame.
-    if (time < frames[0])
-    {
-        drawOrderTimeline->preFrameIndex = -1;
-        return;
-    }
-
-    int frameLength = drawOrderTimeline->frameArr->length;
-    int frameIndex;
-
-    if (time >= frames[frameLength - 1])
-    {
-        // time is after last frame.
-        frameIndex = frameLength - 1;
-    }
-    else
-    {
-        frameIndex = BinarySearch(frames, frameLength, time) - 1;
-    }
-
-    if (drawOrderTimeline->preFrameIndex == frameIndex)
-    {
-        return;
-    }
-    else
-    {
-        drawOrderTimeline->preFrameIndex = frameIndex;
-    }
-
-    ArrayList* meshList = skeleton->meshList;
-    int        subMeshIndexCount[meshList->size];
-
-    memset(subMeshIndexCount, 0, meshList->size * sizeof(int));
+    ArrayList* meshList          = skeleton->meshList;
+    ArenaMark  mark              = AArena->GetMark(AArena->frameArena);
+    int*       subMeshIndexCount = AArena->AllocZero(AArena->frameArena, meshList->size * (int) sizeof(int));
 
     Array(int)*    drawOrderArr = AArray_Get(drawOrderTimeline->drawOrderArr, frameIndex, Array(int)*);
     SkeletonSlot*  slots        = skeleton->slotArr->data;
@@ -1009,6 +1016,8 @@ static void DrawOrderApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleto
         }
     }
 
+    AArena->Rollback(AArena->frameArena, mark);
+
     for (int i = 0; i < meshList->size; ++i)
     {
         AMesh->ReorderAllChildren(AArrayList_GetPtr(meshList, i, Mesh));
@@ -1016,6 +1025,30 @@ static void DrawOrderApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleto
 }
 
 
+static void DrawOrderApply(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent)
+{
+    SkeletonDrawOrderTimeline* drawOrderTimeline = skeletonTimeline->childPtr;
+    int                        frameIndex        = GetStepFrameIndex(drawOrderTimeline->frameArr, time);
+
+    if (frameIndex == -1)
+    {
+        drawOrderTimeline->preFrameIndex = -1;
+        return;
+    }
+
+    if (drawOrderTimeline->preFrameIndex == frameIndex)
+    {
+        return;
+    }
+    else
+    {
+        drawOrderTimeline->preFrameIndex = frameIndex;
+    }
+
+    ApplyDrawOrderFrame(drawOrderTimeline, skeleton, frameIndex);
+}
+
+
 static SkeletonDrawOrderTimeline* CreateDrawOrder(int frameCount)
 {
     SkeletonDrawOrderTimeline* drawOrderTimeline  = malloc(sizeof(SkeletonDrawOrderTimeline));
@@ -1023,6 +1056,7 @@ static SkeletonDrawOrderTimeline* CreateDrawOrder(int frameCount)
     drawOrderTimeline->skeletonTimeline->Release  = DrawOrderRelease;
     drawOrderTimeline->skeletonTimeline->Apply    = DrawOrderApply;
     drawOrderTimeline->skeletonTimeline->childPtr = drawOrderTimeline;
+    drawOrderTimeline->skeletonTimeline->type     = SkeletonTimelineType_DrawOrder;
 
     drawOrderTimeline->frameArr                   = AArray->Create(sizeof(float),        frameCount);
     drawOrderTimeline->drawOrderArr               = AArray->Create(sizeof(Array(int)*), frameCount);
@@ -1211,6 +1245,7 @@ static SkeletonDeformTimeline* CreateDeform(int frameCount)
     deformTimeline->skeletonTimeline->Release  = DeformRelease;
     deformTimeline->skeletonTimeline->Apply    = DeformApply;
     deformTimeline->skeletonTimeline->childPtr = deformTimeline;
+    deformTimeline->skeletonTimeline->type     = SkeletonTimelineType_Deform;
 
     deformTimeline->frameArr                   = AArray->Create(sizeof(float),         frameCount);
     deformTimeline->vertexArr                  = AArray->Create(sizeof(Array(float)*), frameCount);
@@ -1219,6 +1254,128 @@ static SkeletonDeformTimeline* CreateDeform(int frameCount)
 }
 
 
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static bool GetCurveValues(SkeletonTimeline* skeletonTimeline, float time, float* outValues)
+{
+    switch (skeletonTimeline->type)
+    {
+        case SkeletonTimelineType_Rotate:
+            return GetRotateValue(skeletonTimeline->childPtr, time, outValues);
+
+        case SkeletonTimelineType_Translate:
+        case SkeletonTimelineType_Scale:
+            // the scale timeline is same as translate timeline
+            return GetTranslateValues(skeletonTimeline->childPtr, time, outValues);
+
+        case SkeletonTimelineType_Color:
+            return GetColorValues(skeletonTimeline->childPtr, time, outValues);
+
+        default:
+            ALog_A(false, "ASkeletonTimeline GetCurveValues not support timeline type = %d", skeletonTimeline->type);
+            return false;
+    }
+}
+
+
+static void ApplyCurveValues
+(
+    SkeletonTimeline* skeletonTimeline,
+    Skeleton*         skeleton,
+    float             time,
+    const float*      values,
+    float             mixPercent
+)
+{
+    switch (skeletonTimeline->type)
+    {
+        case SkeletonTimelineType_Rotate:
+            ApplyRotateValue(skeletonTimeline->childPtr, skeleton, values[0], mixPercent);
+            break;
+
+        case SkeletonTimelineType_Translate:
+            ApplyTranslateValues(skeletonTimeline->childPtr, skeleton, values, mixPercent);
+            break;
+
+        case SkeletonTimelineType_Scale:
+            ApplyScaleValues(skeletonTimeline->childPtr, skeleton, values, mixPercent);
+            break;
+
+        case SkeletonTimelineType_Color:
+            ApplyColorValues(skeletonTimeline->childPtr, skeleton, time, values, mixPercent);
+            break;
+
+        default:
+            ALog_A(false, "ASkeletonTimeline ApplyCurveValues not support timeline type = %d", skeletonTimeline->type);
+            break;
+    }
+}
+
+
+static float GetFirstFrameTime(SkeletonTimeline* skeletonTimeline)
+{
+    switch (skeletonTimeline->type)
+    {
+        case SkeletonTimelineType_Rotate:
+            return AArray_Get(((SkeletonRotateTimeline*)     skeletonTimeline->childPtr)->frameArr, 0, float);
+
+        case SkeletonTimelineType_Translate:
+        case SkeletonTimelineType_Scale:
+            return AArray_Get(((SkeletonTranslateTimeline*)  skeletonTimeline->childPtr)->frameArr, 0, float);
+
+        case SkeletonTimelineType_Color:
+            return AArray_Get(((SkeletonColorTimeline*)      skeletonTimeline->childPtr)->frameArr, 0, float);
+
+        case SkeletonTimelineType_Attachment:
+            return AArray_Get(((SkeletonAttachmentTimeline*) skeletonTimeline->childPtr)->frameArr, 0, float);
+
+        case SkeletonTimelineType_DrawOrder:
+            return AArray_Get(((SkeletonDrawOrderTimeline*)  skeletonTimeline->childPtr)->frameArr, 0, float);
+
+        default:
+            ALog_A(false, "ASkeletonTimeline GetFirstFrameTime not support timeline type = %d", skeletonTimeline->type);
+            return 0.0f;
+    }
+}
+
+
+static int GetFrameIndex(SkeletonTimeline* skeletonTimeline, float time)
+{
+    switch (skeletonTimeline->type)
+    {
+        case SkeletonTimelineType_Attachment:
+            return GetStepFrameIndex(((SkeletonAttachmentTimeline*) skeletonTimeline->childPtr)->frameArr, time);
+
+        case SkeletonTimelineType_DrawOrder:
+            return GetStepFrameIndex(((SkeletonDrawOrderTimeline*)  skeletonTimeline->childPtr)->frameArr, time);
+
+        default:
+            ALog_A(false, "ASkeletonTimeline GetFrameIndex not support timeline type = %d", skeletonTimeline->type);
+            return -1;
+    }
+}
+
+
+static void ApplyFrame(SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, int frameIndex)
+{
+    switch (skeletonTimeline->type)
+    {
+        case SkeletonTimelineType_Attachment:
+            ApplyAttachmentFrame(skeletonTimeline->childPtr, skeleton, frameIndex);
+            break;
+
+        case SkeletonTimelineType_DrawOrder:
+            ApplyDrawOrderFrame(skeletonTimeline->childPtr, skeleton, frameIndex);
+            break;
+
+        default:
+            ALog_A(false, "ASkeletonTimeline ApplyFrame not support timeline type = %d", skeletonTimeline->type);
+            break;
+    }
+}
+
+
 struct ASkeletonTimeline ASkeletonTimeline[1] =
 {{
     CreateRotate,
@@ -1241,4 +1398,10 @@ struct ASkeletonTimeline ASkeletonTimeline[1] =
     SetEventFrame,
     SetDrawOrderFrame,
     SetDeformFrame,
+
+    GetCurveValues,
+    ApplyCurveValues,
+    GetFirstFrameTime,
+    GetFrameIndex,
+    ApplyFrame,
 }};
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-7-3
- * Update   : 2019-2-1
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -40,6 +40,23 @@ typedef struct
 SkeletonCurveTimeline;
 
 
+/**
+ * The subclass type of SkeletonTimeline.
+ */
+typedef enum
+{
+    SkeletonTimelineType_Rotate,
+    SkeletonTimelineType_Translate,
+    SkeletonTimelineType_Scale,
+    SkeletonTimelineType_Color,
+    SkeletonTimelineType_Attachment,
+    SkeletonTimelineType_Event,
+    SkeletonTimelineType_DrawOrder,
+    SkeletonTimelineType_Deform,
+}
+SkeletonTimelineType;
+
+
 typedef struct SkeletonTimeline SkeletonTimeline;
 
 /**
@@ -53,17 +70,22 @@ struct SkeletonTimeline
      * the mixPercent is percent to set the effect, range in [0, 1].
      * the time is seconds
      */
-    void  (*Apply)  (SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent);
+    void                 (*Apply)  (SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, float time, float mixPercent);
 
     /**
      * Release member memory space.
      */
-    void  (*Release)(SkeletonTimeline* skeletonTimeline);
+    void                 (*Release)(SkeletonTimeline* skeletonTimeline);
 
     /**
      * Subclass pointer which inheritance SkeletonTimeline.
      */
-    void* childPtr;
+    void*                childPtr;
+
+    /**
+     * The subclass type of childPtr.
+     */
+    SkeletonTimelineType type;
 };
 
 
@@ -150,14 +172,18 @@ typedef struct
     /**
      * Each group has time, as [time...].
      */
-    Array(float)*       frameArr;
-    Array(const char*)* attachmentNameArr;
+    Array(float)* frameArr;
+
+    /**
+     * Each frame attachment name atom, -1 means no attachment.
+     */
+    Array(int)*   attachmentNameAtomArr;
 
     /**
      * Index in SkeletonData's slotDataOrderArr.
      */
-    int                 slotIndex;
-    int                 preFrameIndex;
+    int           slotIndex;
+    int           preFrameIndex;
 }
 SkeletonAttachmentTimeline;
 
@@ -306,6 +332,42 @@ struct ASkeletonTimeline
                                   float                       time,
                                   Array(float)*               vertexArr
                               );
+
+    /**
+     * Get the values of Rotate, Translate, Scale or Color timeline at time, without applying to skeleton.
+     * the values are relative to setup pose same as the key frames,
+     * 1 value of Rotate, 2 values of Translate and Scale, 4 values of Color.
+     *
+     * return false if time is before first frame.
+     */
+    bool  (*GetCurveValues)    (SkeletonTimeline* skeletonTimeline, float time, float* outValues);
+
+    /**
+     * Apply the values that got by GetCurveValues to skeleton, same as the Apply of timeline at time.
+     */
+    void  (*ApplyCurveValues)  (
+                                   SkeletonTimeline*           skeletonTimeline,
+                                   Skeleton*                   skeleton,
+                                   float                       time,
+                                   const float*                values,
+                                   float                       mixPercent
+                               );
+
+    /**
+     * Get the time of first key frame of Rotate, Translate, Scale, Color, Attachment or DrawOrder timeline.
+     */
+    float (*GetFirstFrameTime) (SkeletonTimeline* skeletonTimeline);
+
+    /**
+     * Get the key frame index of Attachment or DrawOrder timeline at time, -1 if time is before first frame.
+     */
+    int   (*GetFrameIndex)     (SkeletonTimeline* skeletonTimeline, float time);
+
+    /**
+     * Apply the key frame of Attachment or DrawOrder timeline to skeleton,
+     * same as the Apply of timeline but without searching time and checking the previous frame.
+     */
+    void  (*ApplyFrame)        (SkeletonTimeline* skeletonTimeline, Skeleton* skeleton, int frameIndex);
 };
 
 
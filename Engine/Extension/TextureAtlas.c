@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-7-22
- * Update   : 2019-1-31
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -24,9 +24,26 @@
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Graphics/OpenGL/GLTool.h"
 #include "Engine/Toolkit/Utils/FileTool.h"
+#include "Engine/Toolkit/HeaderUtils/Struct.h"
 
 
-static ArrayStrMap(filePath, TextureAtlas*) textureAtlasMap[1] = AArrayStrMap_Init(TextureAtlas*, 20);
+static HashStrMap(filePath, TextureAtlas*) textureAtlasMap[1] = AHashStrMap_Init(TextureAtlas*, 20);
+
+
+/**
+ * Make the texture path of image name line, which is relative to the dir of atlas filePath.
+ * the length of outPath must be GetDirLength(filePath) + line length + 1.
+ */
+static inline void MakeTexturePath(const char* filePath, const char* buffer, ArrayRange* line, char* outPath)
+{
+    int fileDirLen = AFileTool->GetDirLength(filePath);
+    int nameLen    = line->end - line->start;
+
+    memcpy(outPath,              filePath,             (size_t) fileDirLen);
+    memcpy(outPath + fileDirLen, buffer + line->start, (size_t) nameLen);
+
+    outPath[fileDirLen + nameLen] = '\0';
+}
 
 
 #define ReadFind(str)                                          \
@@ -37,13 +54,14 @@ static ArrayStrMap(filePath, TextureAtlas*) textureAtlasMap[1] = AArrayStrMap_In
 
 static void Init(const char* filePath, TextureAtlas* outTextureAtlas)
 {
-    AArrayStrMap->InitWithCapacity(sizeof(TextureAtlasQuad), 20, outTextureAtlas->quadMap);
-    AArrayList  ->InitWithCapacity(sizeof(Texture*),         5,  outTextureAtlas->textureList);
+    AHashStrMap->InitWithCapacity(sizeof(TextureAtlasQuad), 20, outTextureAtlas->quadMap);
+    AArrayList ->InitWithCapacity(sizeof(Texture*),         5,  outTextureAtlas->textureList);
 
-    long  size;
-    char* buffer = AFileTool->CreateDataFromResource(filePath, &size);
+    // the lines are made to strings in place, on the private copy-on-write pages of mapping
+    FileMapping mapping[1];
+    char*       buffer  = AFileTool->CreateMappedDataFromResource(filePath, mapping);
 
-    ArrayRange range[1] = {0, (int) size - 1};
+    ArrayRange range[1] = {0, (int) mapping->length - 1};
     ArrayRange line [1];
 
     ABufferReader->ReadLine(buffer, range, line);
@@ -53,17 +71,8 @@ static void Init(const char* filePath, TextureAtlas* outTextureAtlas)
         // read image name
         ABufferReader->ReadLine(buffer, range, line);
 
-        int  fileDirLen = AFileTool->GetDirLength(filePath);
-        int  pathLen   = fileDirLen + (line->end - line->start);
-        char path[pathLen + 1];
-
-        path[pathLen]  = '\0';
-        
-        if (fileDirLen != 0)
-        {
-            memcpy(path, filePath, (size_t) fileDirLen);
-            memcpy(path + fileDirLen, buffer + line->start, (size_t) (pathLen - fileDirLen));
-        }
+        char path[AFileTool->GetDirLength(filePath) + (line->end - line->start) + 1];
+        MakeTexturePath(filePath, buffer, line, path);
 
         Texture* texture = ATexture->Get(path);
         AArrayList_Add(outTextureAtlas->textureList, texture);
@@ -131,53 +140,123 @@ static void Init(const char* filePath, TextureAtlas* outTextureAtlas)
             atlasQuad->quad->offsetTextureY = AGLTool_ToGLHeight(y);
             atlasQuad->atlas                = outTextureAtlas;
 
-            AArrayStrMap->TryPut(outTextureAtlas->quadMap, textureQuadName, atlasQuad);
+            AHashStrMap->TryPut(outTextureAtlas->quadMap, textureQuadName, atlasQuad);
         }
     }
 
     AArrayList->Shrink(outTextureAtlas->quadMap->elementList);
     AArrayList->Shrink(outTextureAtlas->textureList);
-    free(buffer);
+    AFileTool->ReleaseMappedData(mapping);
 }
 
 
 #undef ReadFind
 
 
-static void Release(TextureAtlas* textureAtlas)
+static void Evict(ResourceRef* ref)
 {
-    AArrayStrMap->Release(textureAtlas->quadMap);
-    AArrayList  ->Release(textureAtlas->textureList);
+    TextureAtlas* textureAtlas = AStruct_GetParentWithName(ref, TextureAtlas, resourceRef);
 
-    bool isRemoved = AArrayStrMap->TryRemove(textureAtlasMap, textureAtlas->filePath);
-    ALog_A(isRemoved, "ATextureAtlas release not found %s", textureAtlas->filePath);
+    for (int i = 0; i < textureAtlas->textureList->size; ++i)
+    {
+        ATexture->Release(AArrayList_Get(textureAtlas->textureList, i, Texture*));
+    }
+
+    AHashStrMap->Release(textureAtlas->quadMap);
+    AArrayList ->Release(textureAtlas->textureList);
+
+    bool isRemoved = AHashStrMap->TryRemove(textureAtlasMap, textureAtlas->filePath);
+    ALog_A(isRemoved, "ATextureAtlas evict not found %s", textureAtlas->filePath);
 
     free(textureAtlas);
 }
 
 
+static void Release(TextureAtlas* textureAtlas)
+{
+    AResource->Release(textureAtlas->resourceRef);
+}
+
+
+/**
+ * The memory bytes of TextureAtlas, not include the textures that have their own references.
+ */
+static inline long GetBytes(TextureAtlas* textureAtlas)
+{
+    HashStrMap* quadMap = textureAtlas->quadMap;
+
+    return (long) sizeof(TextureAtlas)                                                             +
+           (long) quadMap->elementList->elementArr->length * quadMap->elementList->elementTypeSize +
+           (long) quadMap->bucketArr->length               * (long) sizeof(HashStrMapBucket)       +
+           (long) quadMap->keyBlockList->size              * quadMap->keyBlockLength               +
+           (long) textureAtlas->textureList->size          * (long) sizeof(Texture*);
+}
+
+
 static TextureAtlas* Get(const char* filePath)
 {
-    TextureAtlas* textureAtlas = AArrayStrMap_Get(textureAtlasMap, filePath, TextureAtlas*);
+    TextureAtlas* textureAtlas = AHashStrMap_Get(textureAtlasMap, filePath, TextureAtlas*);
 
     if (textureAtlas == NULL)
     {
         textureAtlas           = malloc(sizeof(TextureAtlas));
-        textureAtlas->filePath = AArrayStrMap_GetKey
-                                 (
-                                    AArrayStrMap_TryPut(textureAtlasMap, filePath, textureAtlas),
-                                    textureAtlasMap->valueTypeSize
-                                 );
+        textureAtlas->filePath = AHashStrMap_GetKey(AHashStrMap_TryPut(textureAtlasMap, filePath, textureAtlas));
 
         Init(filePath, textureAtlas);
+        AResource->Add(ResourceClass_TextureAtlas, GetBytes(textureAtlas), Evict, textureAtlas->resourceRef);
+    }
+    else
+    {
+        AResource->Retain(textureAtlas->resourceRef);
     }
 
     return textureAtlas;
 }
 
 
+static TextureAtlas* Find(const char* filePath)
+{
+    return AHashStrMap_Get(textureAtlasMap, filePath, TextureAtlas*);
+}
+
+
+static void GetTexturePaths(const char* filePath, ArrayList(char*)* outPathList)
+{
+    FileMapping mapping[1];
+    char*       buffer      = AFileTool->CreateMappedDataFromResource(filePath, mapping);
+
+    ArrayRange  range[1]    = {0, (int) mapping->length - 1};
+    ArrayRange  line [1];
+
+    // the image name line follows the empty line, same as Init
+    bool        isImageLine = true;
+
+    while (range->start < range->end)
+    {
+        ABufferReader->ReadLine(buffer, range, line);
+
+        if (line->start == line->end)
+        {
+            isImageLine = true;
+        }
+        else if (isImageLine)
+        {
+            char* path = malloc((size_t) (AFileTool->GetDirLength(filePath) + (line->end - line->start) + 1));
+            MakeTexturePath(filePath, buffer, line, path);
+            AArrayList_Add(outPathList, path);
+
+            isImageLine = false;
+        }
+    }
+
+    AFileTool->ReleaseMappedData(mapping);
+}
+
+
 struct ATextureAtlas ATextureAtlas[1] =
 {{
     Get,
     Release,
+    Find,
+    GetTexturePaths,
 }};
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-7-22
- * Update   : 2019-1-31
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -19,7 +19,8 @@
 
 
 #include "Engine/Graphics/Draw/Quad.h"
-#include "Engine/Toolkit/Utils/ArrayStrMap.h"
+#include "Engine/Toolkit/Utils/HashStrMap.h"
+#include "Engine/Toolkit/Utils/Resource.h"
 
 
 /**
@@ -30,17 +31,22 @@ typedef struct
     /**
      * Texture atlas quad info from file.
      */
-    ArrayStrMap(quadName, TextureAtlasQuad) quadMap[1];
+    HashStrMap(quadName, TextureAtlasQuad) quadMap[1];
 
     /**
      * Textures in atlas.
      */
-    ArrayList  (Texture*)                   textureList[1];
+    ArrayList (Texture*)                   textureList[1];
 
     /**
      * Be key identify TextureAtlas.
      */
-    const char*                             filePath;
+    const char*                            filePath;
+
+    /**
+     * The references of TextureAtlas, and it references all textures.
+     */
+    ResourceRef                            resourceRef[1];
 }
 TextureAtlas;
 
@@ -74,14 +80,30 @@ TextureAtlasQuad;
 struct ATextureAtlas
 {
     /**
-     * Get TextureAtlas by TextureAtlas.
+     * Get TextureAtlas by filePath, not found or evicted will create one.
+     * the TextureAtlas is referenced, and needs to Release after using.
      *
      * filePath:
      *     Android: assets
      *     IOS    : NSBundle
      */
-    TextureAtlas* (*Get)    (const char*   filePath);
-    void          (*Release)(TextureAtlas* textureAtlas);
+    TextureAtlas* (*Get)            (const char*   filePath);
+
+    /**
+     * Release the reference of TextureAtlas, the unused one is kept in cache until evicted by AResource budget.
+     */
+    void          (*Release)        (TextureAtlas* textureAtlas);
+
+    /**
+     * Find TextureAtlas by filePath in cache, not found return NULL.
+     */
+    TextureAtlas* (*Find)           (const char*   filePath);
+
+    /**
+     * Read the texture file paths of atlas file without loading textures, and add them into outPathList.
+     * each path is malloc and needs to be freed, and it can be called in any thread.
+     */
+    void          (*GetTexturePaths)(const char*   filePath, ArrayList(char*)* outPathList);
 };
 
 
@@ -93,7 +115,7 @@ extern struct ATextureAtlas ATextureAtlas[1];
  */
 static inline TextureAtlasQuad* ATextureAtlas_GetQuad(TextureAtlas* atlas, const char* quadName)
 {
-    return AArrayStrMap_GetPtr(atlas->quadMap, quadName, TextureAtlasQuad);
+    return AHashStrMap_GetPtr(atlas->quadMap, quadName, TextureAtlasQuad);
 }
 
 
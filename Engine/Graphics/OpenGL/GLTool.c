@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2012-12-22
- * Update   : 2019-1-23
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -167,23 +167,47 @@ static GLuint LoadProgram(const char* vertexSourceStr, const char* fragmentSourc
 
 GLuint LoadProgramFromFile(const char* vertexShaderFilePath, const char* fragmentShaderFilePath)
 {
-    char* vertexShader   = AFileTool->CreateStringFromResource(vertexShaderFilePath);
-    char* fragmentShader = AFileTool->CreateStringFromResource(fragmentShaderFilePath);
-    GLuint program       = LoadProgram(vertexShader, fragmentShader);
+    Arena*    arena          = AArena->scratchArena;
+    ArenaMark mark           = AArena->GetMark(arena);
+    char*     vertexShader   = AFileTool->CreateStringFromResourceWithArena(vertexShaderFilePath,   arena);
+    char*     fragmentShader = AFileTool->CreateStringFromResourceWithArena(fragmentShaderFilePath, arena);
+    GLuint    program        = LoadProgram(vertexShader, fragmentShader);
 
-    free((void*) vertexShader);
-    free((void*) fragmentShader);
+    AArena->Rollback(arena, mark);
 
     return program;
 }
 
 
-static void LoadTexture(const char* textureFilePath, Texture* outTexture)
+static void LoadTextureWithImage(Image* image, Texture* outTexture)
 {
      GLuint textureID;
-
-     // use tightly packed data
-     // glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+     GLenum format;
+     GLenum type;
+
+     switch (image->format)
+     {
+         case ImageFormat_RGB565:
+             format = GL_RGB;
+             type   = GL_UNSIGNED_SHORT_5_6_5;
+             break;
+
+         case ImageFormat_RGBA4444:
+             format = GL_RGBA;
+             type   = GL_UNSIGNED_SHORT_4_4_4_4;
+             break;
+
+         default:
+             format = GL_RGBA;
+             type   = GL_UNSIGNED_BYTE;
+             break;
+     }
+
+     // the rows of 2 bytes pixel may not be 4 bytes aligned
+     if (AImage_GetPixelBytes(image->format) == 2)
+     {
+         glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+     }
 
      // generate a outTexture object
      glGenTextures(1, &textureID);
@@ -194,47 +218,85 @@ static void LoadTexture(const char* textureFilePath, Texture* outTexture)
      outTexture->id = textureID;
 
      // set filtering
-     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, image->levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,  image->levelCount - 1);
 
      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,     GL_CLAMP_TO_EDGE);
      glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,     GL_CLAMP_TO_EDGE);
 
-     float width;
-     float height;
-
-     void* pixels = AImage->CreatePixelDataFromPNG(textureFilePath, &width, &height);
-     ALog_A(pixels != NULL, "AGLTool LoadTexture failed, no pixels data found");
-
-     // load the data into the bound outTexture
-     glTexImage2D
-     (
-         GL_TEXTURE_2D,
-         0,
-         GL_RGBA,
-         (GLsizei) width,
-         (GLsizei) height, 
-         0,
-         GL_RGBA,
-         GL_UNSIGNED_BYTE,
-         pixels
-     );
-
-     outTexture->width  = AGLTool_ToGLWidth (width);
-     outTexture->height = AGLTool_ToGLHeight(height);
-
-     free(pixels);
+     char* pixels = image->pixels;
+
+     // load the data of each level into the bound outTexture
+     for (int level = 0; level < image->levelCount; ++level)
+     {
+         int width  = image->width  >> level;
+         int height = image->height >> level;
+
+         glTexImage2D
+         (
+             GL_TEXTURE_2D,
+             level,
+             format,
+             width  > 0 ? width  : 1,
+             height > 0 ? height : 1,
+             0,
+             format,
+             type,
+             pixels
+         );
+
+         pixels += AImage_GetLevelBytes(image->format, image->width, image->height, level);
+     }
+
+     if (AImage_GetPixelBytes(image->format) == 2)
+     {
+         glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+     }
+
+     outTexture->width  = AGLTool_ToGLWidth ((float) image->width);
+     outTexture->height = AGLTool_ToGLHeight((float) image->height);
+}
+
+
+static void LoadTextureWithPixels(void* pixels, float width, float height, Texture* outTexture)
+{
+     Image image[1];
+
+     image->pixels          = pixels;
+     image->width           = (int) width;
+     image->height          = (int) height;
+     image->format          = ImageFormat_RGBA8888;
+     image->levelCount      = 1;
+     image->isPremultiplied = false;
+     image->mapping->data   = NULL;
+
+     LoadTextureWithImage(image, outTexture);
+}
+
+
+static void LoadTexture(const char* textureFilePath, Texture* outTexture)
+{
+     Image image[1];
+
+     bool isInit = AImage->Init(textureFilePath, image);
+     ALog_A(isInit, "AGLTool LoadTexture failed, no pixels data found in %s", textureFilePath);
+
+     LoadTextureWithImage(image, outTexture);
+     AImage->Release(image);
 }
 
 
 struct AGLTool AGLTool[1] =
 {{
-    .SetSize             = SetSize,
+    .SetSize               = SetSize,
 
-    .LoadShader          = LoadShader,
-    .LoadProgram         = LoadProgram,
+    .LoadShader            = LoadShader,
+    .LoadProgram           = LoadProgram,
 
-    .LoadProgramFromFile = LoadProgramFromFile,
-    .LoadTexture         = LoadTexture,
+    .LoadProgramFromFile   = LoadProgramFromFile,
+    .LoadTexture           = LoadTexture,
+    .LoadTextureWithPixels = LoadTextureWithPixels,
+    .LoadTextureWithImage  = LoadTextureWithImage,
 }};
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2012-12-22
- * Update   : 2019-1-23
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include "Engine/Graphics/OpenGL/Platform/gl3.h"
 #include "Engine/Graphics/OpenGL/Texture.h"
+#include "Engine/Graphics/Utils/Image.h"
 #include "Engine/Toolkit/HeaderUtils/Define.h"
 
 
@@ -72,12 +73,12 @@ struct AGLTool
      *
      * if success return shader id else 0.
      */
-    GLuint (*LoadShader)         (GLenum shaderType, const char* shaderSourceStr);
+    GLuint (*LoadShader)           (GLenum shaderType, const char* shaderSourceStr);
 
     /**
      * Load vertex and fragment shader, and create program object, link program object.
      */
-    GLuint (*LoadProgram)        (const char* vertexSourceStr, const char* fragmentSourceStr);
+    GLuint (*LoadProgram)          (const char* vertexSourceStr, const char* fragmentSourceStr);
 
     /**
      * Create a program object from shader file path.
@@ -86,16 +87,26 @@ struct AGLTool
      *     Android: assets
      *     IOS    : NSBundle
      */
-    GLuint (*LoadProgramFromFile)(const char* vertexShaderFilePath, const char* fragmentShaderFilePath);
+    GLuint (*LoadProgramFromFile)  (const char* vertexShaderFilePath, const char* fragmentShaderFilePath);
 
     /**
-     * Load texture from textureFilePath.
+     * Load texture from textureFilePath, which is PNG or pre-decoded texture file.
      * 
      * textureFilePath:
      *     Android: assets
      *     IOS    : NSBundle
      */
-    void (*LoadTexture)          (const char* textureFilePath, Texture* outTexture);
+    void   (*LoadTexture)          (const char* textureFilePath, Texture* outTexture);
+
+    /**
+     * Load texture from the RGBA pixels decoded by AImage, the pixels are not freed.
+     */
+    void   (*LoadTextureWithPixels)(void* pixels, float width, float height, Texture* outTexture);
+
+    /**
+     * Load texture from the pixels and mip levels of Image, the Image is not released.
+     */
+    void   (*LoadTextureWithImage) (Image* image, Texture* outTexture);
 };
 
 
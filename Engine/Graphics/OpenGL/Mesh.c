@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-8-5
- * Update   : 2019-1-23
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -20,6 +20,42 @@
 #include "Engine/Graphics/OpenGL/Shader/ShaderMesh.h"
 #include "Engine/Toolkit/HeaderUtils/Struct.h"
 #include "Engine/Graphics/Graphics.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * Whether the indexArr is the sharedMesh indexArr.
+ */
+static inline bool IsSharedIndex(Mesh* mesh)
+{
+    return mesh->sharedMesh != NULL && mesh->indexArr == mesh->sharedMesh->indexArr;
+}
+
+
+/**
+ * Copy the shared index data and buffer, because the children order of this Mesh is changed.
+ */
+static inline void CopySharedIndex(Mesh* mesh)
+{
+    mesh->indexArr = AArray->Create(sizeof(short), mesh->indexDataLength);
+
+    if (AGraphics->isUseVBO)
+    {
+        glGenBuffers(1, mesh->vboIDs + Mesh_BufferIndex);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboIDs[Mesh_BufferIndex]);
+        // the data will be updated by VBOSubData
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh->indexDataSize, NULL, GL_STATIC_DRAW);
+
+        if (AGraphics->isUseVAO)
+        {
+            glBindVertexArray(mesh->vaoID);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboIDs[Mesh_BufferIndex]);
+            glBindVertexArray(0);
+        }
+
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+}
 
 
 static void ReorderAllChildren(Mesh* mesh)
@@ -28,6 +64,11 @@ static void ReorderAllChildren(Mesh* mesh)
     // SubMesh keep original indexDataOffset
     int        indexDataOffset = 0;
 
+    if (IsSharedIndex(mesh))
+    {
+        CopySharedIndex(mesh);
+    }
+
     for (int i = 0; i < children->size; ++i)
     {
         SubMesh* subMesh = AArrayList_Get(children, i, SubMesh*);
@@ -211,16 +252,36 @@ static inline void BindVBO(Mesh* mesh)
         0
     );
 
-    // load the texture coordinate
-    glVertexAttribPointer
-    (
-        (GLuint) AShaderMesh->attribTexcoord,
-        Mesh_VertexUVNum,
-        GL_FLOAT,
-        false,
-        Mesh_VertexUVStride,
-        (GLvoid*) (intptr_t) mesh->uvDataOffset
-    );
+    if (mesh->sharedMesh == NULL)
+    {
+        // load the texture coordinate
+        glVertexAttribPointer
+        (
+            (GLuint) AShaderMesh->attribTexcoord,
+            Mesh_VertexUVNum,
+            GL_FLOAT,
+            false,
+            Mesh_VertexUVStride,
+            (GLvoid*) (intptr_t) mesh->uvDataOffset
+        );
+    }
+    else
+    {
+        // load the texture coordinate from the buffer of sharedMesh
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->sharedMesh->vboIDs[Mesh_BufferVertex]);
+
+        glVertexAttribPointer
+        (
+            (GLuint) AShaderMesh->attribTexcoord,
+            Mesh_VertexUVNum,
+            GL_FLOAT,
+            false,
+            Mesh_VertexUVStride,
+            (GLvoid*) (intptr_t) mesh->sharedMesh->uvDataOffset
+        );
+
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboIDs[Mesh_BufferVertex]);
+    }
 
     // load the opacity
     glVertexAttribPointer
@@ -258,7 +319,7 @@ static void Render(Drawable* drawable)
     SubMesh* fromChild;
     SubMesh* toChild;
 
-    if (mesh->drawRangeQueue->elementList->size == 0)
+    if (mesh->drawRangeQueue->size == 0)
     {
         fromChild = AArrayList_Get(mesh->childList, mesh->fromIndex, SubMesh*);
         toChild   = AArrayList_Get(mesh->childList, mesh->toIndex,   SubMesh*);
@@ -377,6 +438,9 @@ static void Render(Drawable* drawable)
     }
     else
     {
+        // the uv data is in sharedMesh if has
+        Mesh* uvMesh = mesh->sharedMesh != NULL ? mesh->sharedMesh : mesh;
+
         // load the position
         glVertexAttribPointer
         (
@@ -396,7 +460,7 @@ static void Render(Drawable* drawable)
             GL_FLOAT,
             false,
             Mesh_VertexUVStride,
-            (char*) mesh->vertexArr->data + mesh->uvDataOffset
+            (char*) uvMesh->vertexArr->data + uvMesh->uvDataOffset
         );
 
         // load the opacity
@@ -452,6 +516,7 @@ static void Init(Texture* texture, Mesh* outMesh)
 {
     Quad quad[1];
     AQuad->Init(texture->width, texture->height, quad);
+    ATexture->Retain(texture);
 
     Drawable* drawable                 = outMesh->drawable;
     ADrawable->Init(drawable);
@@ -471,6 +536,7 @@ static void Init(Texture* texture, Mesh* outMesh)
     outMesh->vaoID                     = 0;
     outMesh->vertexArr                 = NULL;
     outMesh->indexArr                  = NULL;
+    outMesh->sharedMesh                = NULL;
 
     ResetData(outMesh);
 
@@ -490,7 +556,16 @@ static inline void InitBuffer(Mesh* mesh)
                                   mesh->opacityDataLength  +
                                   mesh->rgbDataLength
                               );
-    mesh->indexArr          = AArray->Create(sizeof(short), mesh->indexDataLength);
+
+    if (mesh->sharedMesh == NULL)
+    {
+        mesh->indexArr      = AArray->Create(sizeof(short), mesh->indexDataLength);
+    }
+    else
+    {
+        // the index data is shared until ReorderAllChildren
+        mesh->indexArr      = mesh->sharedMesh->indexArr;
+    }
 
     mesh->vertexDataSize    = mesh->vertexArr->length       * sizeof(float);
     mesh->indexDataSize     = mesh->indexArr->length        * sizeof(short);
@@ -503,13 +578,18 @@ static inline void InitBuffer(Mesh* mesh)
     {
         SubMesh* subMesh = AArrayList_Get(mesh->childList, i, SubMesh*);
 
-        memcpy
-        (
-            (char*)  mesh->indexArr->data + subMesh->indexDataOffset,
-            subMesh->indexArr->data,
-            (size_t) subMesh->indexDataSize
-        );
-        
+        if (mesh->sharedMesh == NULL)
+        {
+            memcpy
+            (
+                (char*)  mesh->indexArr->data + subMesh->indexDataOffset,
+                subMesh->indexArr->data,
+                (size_t) subMesh->indexDataSize
+            );
+
+            memcpy(uvData + subMesh->uvDataOffset, subMesh->uvArr->data, (size_t) subMesh->uvDataSize);
+        }
+
         memcpy
         (
           (char*)  mesh->vertexArr->data  + subMesh->positionDataOffset,
@@ -517,8 +597,6 @@ static inline void InitBuffer(Mesh* mesh)
           (size_t) subMesh->positionDataSize
         );
 
-        memcpy(uvData + subMesh->uvDataOffset, subMesh->uvArr->data, (size_t) subMesh->uvDataSize);
-
         // make drawable rgb and opacity update to buffer
         ADrawable_AddState(subMesh->drawable, DrawableState_Draw);
     }
@@ -546,6 +624,8 @@ static Mesh* Create(Texture* texture)
 
 static inline SubMesh* AddChild(Mesh* mesh, SubMesh* subMesh)
 {
+    ALog_A(mesh->sharedMesh == NULL, "AMesh AddChild cannot add child into the Mesh that has sharedMesh");
+
     for (int i = 0; i < subMesh->indexArr->length; ++i)
     {
         // each child index add before children vertex count
@@ -587,6 +667,13 @@ static SubMesh* AddChildWithQuad(Mesh* mesh, Quad* quad)
 
 static inline void ReleaseBuffer(Mesh* mesh)
 {
+    if (IsSharedIndex(mesh))
+    {
+        // the index data and buffer are owned by sharedMesh
+        mesh->indexArr                 = NULL;
+        mesh->vboIDs[Mesh_BufferIndex] = 0;
+    }
+
     free(mesh->vertexArr);
     free(mesh->indexArr);
 
@@ -608,8 +695,38 @@ static inline void ReleaseBuffer(Mesh* mesh)
 }
 
 
+static inline void InitVAO(Mesh* mesh)
+{
+    if (mesh->vaoID == 0)
+    {
+        glGenVertexArrays(1, &mesh->vaoID);
+    }
+
+    glBindVertexArray(mesh->vaoID);
+
+    // with vao has own state
+
+    // load the vertex data
+    glBindBuffer(GL_ARRAY_BUFFER,         mesh->vboIDs[Mesh_BufferVertex]);
+    // load the vertex index
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboIDs[Mesh_BufferIndex]);
+
+    glEnableVertexAttribArray((GLuint) AShaderMesh->attribPosition);
+    glEnableVertexAttribArray((GLuint) AShaderMesh->attribTexcoord);
+    glEnableVertexAttribArray((GLuint) AShaderMesh->attribOpacity);
+    glEnableVertexAttribArray((GLuint) AShaderMesh->attribRGB);
+
+    BindVBO(mesh);
+
+    // go back to normal state
+    glBindVertexArray(0);
+}
+
+
 static void GenerateBuffer(Mesh* mesh)
 {
+    ALog_A(mesh->sharedMesh == NULL, "AMesh GenerateBuffer the Mesh that has sharedMesh is generated by InitWithShared");
+
     free(mesh->vertexArr);
     free(mesh->indexArr);
 
@@ -648,30 +765,195 @@ static void GenerateBuffer(Mesh* mesh)
 
         if (AGraphics->isUseVAO)
         {
-            if (mesh->vaoID == 0)
-            {
-                glGenVertexArrays(1, &mesh->vaoID);
-            }
+            InitVAO(mesh);
+        }
+    }
+}
 
-            glBindVertexArray(mesh->vaoID);
 
-            // with vao has own state
+static void GenerateSharedBuffer(Mesh* mesh)
+{
+    free(mesh->vertexArr);
+    free(mesh->indexArr);
 
-            // load the vertex data
-            glBindBuffer(GL_ARRAY_BUFFER,         mesh->vboIDs[Mesh_BufferVertex]);
-            // load the vertex index
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboIDs[Mesh_BufferIndex]);
+    // data model: [all uv data]
+    mesh->vertexArr      = AArray->Create(sizeof(float), mesh->uvDataLength);
+    mesh->indexArr       = AArray->Create(sizeof(short), mesh->indexDataLength);
 
-            glEnableVertexAttribArray((GLuint) AShaderMesh->attribPosition);
-            glEnableVertexAttribArray((GLuint) AShaderMesh->attribTexcoord);
-            glEnableVertexAttribArray((GLuint) AShaderMesh->attribOpacity);
-            glEnableVertexAttribArray((GLuint) AShaderMesh->attribRGB);
+    mesh->vertexDataSize = mesh->vertexArr->length * sizeof(float);
+    mesh->indexDataSize  = mesh->indexArr->length  * sizeof(short);
+    mesh->uvDataOffset   = 0;
 
-            BindVBO(mesh);
+    for (int i = 0; i < mesh->childList->size; ++i)
+    {
+        SubMesh* subMesh = AArrayList_Get(mesh->childList, i, SubMesh*);
 
-            // go back to normal state
-            glBindVertexArray(0);
+        memcpy
+        (
+            (char*)  mesh->indexArr->data + subMesh->indexDataOffset,
+            subMesh->indexArr->data,
+            (size_t) subMesh->indexDataSize
+        );
+
+        memcpy
+        (
+            (char*)  mesh->vertexArr->data + subMesh->uvDataOffset,
+            subMesh->uvArr->data,
+            (size_t) subMesh->uvDataSize
+        );
+    }
+
+    if (AGraphics->isUseVBO)
+    {
+        if (mesh->vboIDs[Mesh_BufferVertex] == 0)
+        {
+            glGenBuffers(Mesh_BufferNum, mesh->vboIDs);
+        }
+
+        // uv
+        glBindBuffer(GL_ARRAY_BUFFER, mesh->vboIDs[Mesh_BufferVertex]);
+        glBufferData
+        (
+            GL_ARRAY_BUFFER,
+            mesh->vertexDataSize,
+            mesh->vertexArr->data,
+            GL_STATIC_DRAW
+        );
+
+        // index
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->vboIDs[Mesh_BufferIndex]);
+        glBufferData
+        (
+            GL_ELEMENT_ARRAY_BUFFER,
+            mesh->indexDataSize,
+            mesh->indexArr->data,
+            GL_STATIC_DRAW
+        );
+
+        glBindBuffer(GL_ARRAY_BUFFER,         0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+}
+
+
+static void InitWithShared(Mesh* sharedMesh, Mesh* outMesh)
+{
+    ALog_A
+    (
+        sharedMesh->sharedMesh == NULL && sharedMesh->indexArr != NULL,
+        "AMesh InitWithShared the sharedMesh must be generated by GenerateSharedBuffer"
+    );
+
+    InitWithCapacity(sharedMesh->texture, sharedMesh->childList->size, outMesh);
+
+    for (int i = 0; i < sharedMesh->childList->size; ++i)
+    {
+        SubMesh* subMesh = ASubMesh->CreateWithShared(outMesh, AArrayList_Get(sharedMesh->childList, i, SubMesh*));
+        AArrayList_Add(outMesh->childList, subMesh);
+    }
+
+    outMesh->sharedMesh         = sharedMesh;
+    outMesh->vertexCount        = sharedMesh->vertexCount;
+    outMesh->positionDataLength = sharedMesh->positionDataLength;
+    outMesh->opacityDataLength  = sharedMesh->opacityDataLength;
+    outMesh->rgbDataLength      = sharedMesh->rgbDataLength;
+    outMesh->indexDataLength    = sharedMesh->indexDataLength;
+
+    InitBuffer(outMesh);
+
+    if (AGraphics->isUseVBO)
+    {
+        outMesh->vboIDs[Mesh_BufferIndex] = sharedMesh->vboIDs[Mesh_BufferIndex];
+        glGenBuffers(1, outMesh->vboIDs + Mesh_BufferVertex);
+
+        // position, opacity and rgb
+        glBindBuffer(GL_ARRAY_BUFFER, outMesh->vboIDs[Mesh_BufferVertex]);
+        glBufferData
+        (
+            GL_ARRAY_BUFFER,
+            outMesh->vertexDataSize,
+            outMesh->vertexArr->data,
+            GL_DYNAMIC_DRAW
+        );
+
+        if (AGraphics->isUseVAO)
+        {
+            InitVAO(outMesh);
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+}
+
+
+static void Clone(Mesh* mesh, Mesh* outMesh)
+{
+    ALog_A(mesh->sharedMesh != NULL, "AMesh Clone the mesh must be inited by InitWithShared");
+
+    // the drawable, texture, sharedMesh, data sizes and offsets are same as mesh
+    *outMesh = *mesh;
+    ATexture->Retain(outMesh->texture);
+
+    AArrayQueue->Init            (sizeof(int),        outMesh->drawRangeQueue);
+    AArrayList ->InitWithCapacity(sizeof(SubMesh*),   mesh->childList->size, outMesh->childList);
+    AArrayList ->Init            (sizeof(VBOSubData), outMesh->vboSubDataList);
+    outMesh->vboSubDataList->increase = mesh->vboSubDataList->increase;
+
+    for (int i = 0; i < mesh->childList->size; ++i)
+    {
+        SubMesh* child   = AArrayList_Get(mesh->childList, i, SubMesh*);
+        SubMesh* subMesh = ASubMesh->CreateWithShared(outMesh, child);
+
+        // keep the transform, color and visible state that already in vertex data
+        *subMesh->drawable = *child->drawable;
+        AArrayList_Add(outMesh->childList, subMesh);
+    }
+
+    outMesh->vertexArr = AArray->Create(sizeof(float), mesh->vertexArr->length);
+    memcpy(outMesh->vertexArr->data, mesh->vertexArr->data, (size_t) mesh->vertexDataSize);
+
+    if (IsSharedIndex(mesh) == false)
+    {
+        // the children order of mesh is changed
+        outMesh->indexArr = AArray->Create(sizeof(short), mesh->indexArr->length);
+        memcpy(outMesh->indexArr->data, mesh->indexArr->data, (size_t) mesh->indexDataSize);
+    }
+
+    if (AGraphics->isUseVBO)
+    {
+        outMesh->vaoID = 0;
+        glGenBuffers(1, outMesh->vboIDs + Mesh_BufferVertex);
+
+        // position, opacity and rgb
+        glBindBuffer(GL_ARRAY_BUFFER, outMesh->vboIDs[Mesh_BufferVertex]);
+        glBufferData
+        (
+            GL_ARRAY_BUFFER,
+            outMesh->vertexDataSize,
+            outMesh->vertexArr->data,
+            GL_DYNAMIC_DRAW
+        );
+
+        if (IsSharedIndex(mesh) == false)
+        {
+            glGenBuffers(1, outMesh->vboIDs + Mesh_BufferIndex);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, outMesh->vboIDs[Mesh_BufferIndex]);
+            glBufferData
+            (
+                GL_ELEMENT_ARRAY_BUFFER,
+                outMesh->indexDataSize,
+                outMesh->indexArr->data,
+                GL_STATIC_DRAW
+            );
+        }
+
+        if (AGraphics->isUseVAO)
+        {
+            InitVAO(outMesh);
         }
+
+        glBindBuffer(GL_ARRAY_BUFFER,         0);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     }
 }
 
@@ -679,6 +961,7 @@ static void GenerateBuffer(Mesh* mesh)
 static void Release(Mesh* mesh)
 {
     ReleaseBuffer(mesh);
+    ATexture->Release(mesh->texture);
 
     for (int i = 0; i < mesh->childList->size; ++i)
     {
@@ -708,19 +991,27 @@ static void Clear(Mesh* mesh)
 
 static Mesh* CreateWithFile(const char* resourceFilePath)
 {
-    return Create(ATexture->Get(resourceFilePath));
+    Texture* texture = ATexture->Get(resourceFilePath);
+    Mesh*    mesh    = Create(texture);
+    ATexture->Release(texture);
+
+    return mesh;
 }
 
 
 static void InitWithFile(const char* resourceFilePath, Mesh* outMesh)
 {
-    Init(ATexture->Get(resourceFilePath), outMesh);
+    Texture* texture = ATexture->Get(resourceFilePath);
+    Init(texture, outMesh);
+    ATexture->Release(texture);
 }
 
 
 static void InitWithFileAndCapacity(const char* resourceFilePath, int capacity, Mesh* outMesh)
 {
-    InitWithCapacity(ATexture->Get(resourceFilePath), capacity, outMesh);
+    Texture* texture = ATexture->Get(resourceFilePath);
+    InitWithCapacity(texture, capacity, outMesh);
+    ATexture->Release(texture);
 }
 
 
@@ -729,6 +1020,8 @@ struct AMesh AMesh[1] =
     Create,
     Init,
     InitWithCapacity,
+    InitWithShared,
+    Clone,
 
     CreateWithFile,
     InitWithFile,
@@ -741,5 +1034,6 @@ struct AMesh AMesh[1] =
     AddChildWithQuad,
     ReorderAllChildren,
     GenerateBuffer,
+    GenerateSharedBuffer,
     Render,
 }};
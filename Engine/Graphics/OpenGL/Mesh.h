@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-8-5
- * Update   : 2019-1-22
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -105,14 +105,23 @@ struct Mesh
     /**
      * All vertices data from children SubMesh.
      * data model: [all position data | all uv data | all opacity data | all rgb data]
+     *
+     * if has sharedMesh, no uv data that in sharedMesh vertexArr.
      */
     Array(float)*         vertexArr;
 
     /**
      * All vertices data from children SubMesh.
+     * if has sharedMesh, it is the sharedMesh indexArr until ReorderAllChildren copies it.
      */
     Array(short)*         indexArr;
 
+    /**
+     * The Mesh that shares children, uv and index data and buffers to this Mesh, default NULL.
+     * it is set by InitWithShared, and must be released after this Mesh.
+     */
+    Mesh*                 sharedMesh;
+
     /**
      * If use VBO is the generated VBO ids else 0.
      */
@@ -194,6 +203,23 @@ struct AMesh
     void      (*Init)              (Texture* texture, Mesh* outMesh);
     void      (*InitWithCapacity)  (Texture* texture, int capacity, Mesh* outMesh);
 
+    /**
+     * Init Mesh that has the children created by ASubMesh->CreateWithShared from sharedMesh,
+     * and only owns the position, opacity and rgb data, so the Mesh instances can share the static data.
+     * the buffer is generated, and cannot add child or GenerateBuffer.
+     *
+     * sharedMesh: must be generated by GenerateSharedBuffer.
+     */
+    void      (*InitWithShared)    (Mesh* sharedMesh, Mesh* outMesh);
+
+    /**
+     * Init outMesh by copying the vertex data, index order and children state of mesh,
+     * the drawable parent of children is same as mesh's children.
+     *
+     * mesh: must be inited by InitWithShared.
+     */
+    void      (*Clone)             (Mesh* mesh, Mesh* outMesh);
+
     /*
      Create or Init Mesh by resourceFilePath.
 
@@ -247,6 +273,12 @@ struct AMesh
      */
     void      (*GenerateBuffer)    (Mesh* mesh);
 
+    /**
+     * Same as GenerateBuffer, but only generate uv and index data and buffers,
+     * which are used by the Meshes that InitWithShared this Mesh, and this Mesh cannot be drawn.
+     */
+    void      (*GenerateSharedBuffer)(Mesh* mesh);
+
     /**
      * The implementation of Drawable's render function for render Mesh.
      */
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-4-20
- * Update   : 2019-1-19
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -133,6 +133,8 @@ static void Release(Sprite* sprite)
     free(sprite->vertexArr);
     free(sprite->indexArr);
 
+    ATexture->Release(sprite->texture);
+
     sprite->indexArr  = NULL;
     sprite->vertexArr = NULL;
     sprite->texture   = NULL;
@@ -161,6 +163,7 @@ static inline void InitSprite(Sprite* sprite, Texture* texture, Array(Quad)* qua
     ADrawable_AddState(drawable, DrawableState_IsUpdateMVPMatrix);
 
     AQuad->GetMaxSize(quadArr, &drawable->width, &drawable->height);
+    ATexture->Retain(texture);
 
     sprite->texture                     = texture;
     sprite->uvWidth                     = AGLTool_ToUVWidth(drawable->width,  texture->width);
@@ -444,13 +447,19 @@ static void InitWithQuadArray(Texture* texture, Array(Quad)* quadArr, Sprite* ou
 
 static Sprite* CreateWithFile(const char* resourceFilePath)
 {
-    return Create(ATexture->Get(resourceFilePath));
+    Texture* texture = ATexture->Get(resourceFilePath);
+    Sprite*  sprite  = Create(texture);
+    ATexture->Release(texture);
+
+    return sprite;
 }
 
 
 static void InitWithFile(const char* resourceFilePath, Sprite* outSprite)
 {
-    Init(ATexture->Get(resourceFilePath), outSprite);
+    Texture* texture = ATexture->Get(resourceFilePath);
+    Init(texture, outSprite);
+    ATexture->Release(texture);
 }
 
 
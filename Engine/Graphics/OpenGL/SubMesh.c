@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-8-7
- * Update   : 2019-1-19
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -35,6 +35,7 @@ static inline void InitSubMesh(Mesh* parent, SubMesh* subMesh, float width, floa
     subMesh->indexDataOffset    = 0;
     subMesh->opacityDataOffset  = 0;
     subMesh->rgbDataOffset      = 0;
+    subMesh->isDynamicPosition  = false;
 
     subMesh->vertexCount        = subMesh->positionArr->length / Mesh_VertexPositionNum;
     subMesh->vertexDataSize     = subMesh->vertexCount         * sizeof(float);
@@ -116,6 +117,30 @@ static SubMesh* CreateWithData(Mesh* parent, Array(float)* positionArr, Array(fl
 }
 
 
+static SubMesh* CreateWithShared(Mesh* parent, SubMesh* sharedSubMesh)
+{
+    int      positionDataSize = sharedSubMesh->isDynamicPosition ? sharedSubMesh->positionDataSize : 0;
+    SubMesh* subMesh          = malloc(sizeof(SubMesh) + positionDataSize);
+
+    // the data arrays and offsets are same as sharedSubMesh
+    *subMesh                  = *sharedSubMesh;
+
+    ADrawable->Init(subMesh->drawable);
+
+    subMesh->parent           = parent;
+    subMesh->drawable->width  = sharedSubMesh->drawable->width;
+    subMesh->drawable->height = sharedSubMesh->drawable->height;
+
+    if (sharedSubMesh->isDynamicPosition)
+    {
+        subMesh->positionArr->data = (char*) subMesh + sizeof(SubMesh);
+        memcpy(subMesh->positionArr->data, sharedSubMesh->positionArr->data, (size_t) positionDataSize);
+    }
+
+    return subMesh;
+}
+
+
 static void SetUVWithQuad(SubMesh* subMesh, Quad* quad)
 {
     subMesh->drawable->width  = quad->width;
@@ -126,7 +151,8 @@ static void SetUVWithQuad(SubMesh* subMesh, Quad* quad)
 
     Mesh* mesh = subMesh->parent;
 
-    ALog_A(mesh != NULL, "ASubMesh SetUVWithQuad subMesh must has parent");
+    ALog_A(mesh != NULL,             "ASubMesh SetUVWithQuad subMesh must has parent");
+    ALog_A(mesh->sharedMesh == NULL, "ASubMesh SetUVWithQuad cannot change the uv shared from sharedMesh");
 
     memcpy
     (
@@ -175,7 +201,9 @@ static SubMesh* CreateWithQuad(Mesh* parent, Quad* quad)
 static inline void DeformApplyPositionUV(SubMesh *subMesh)
 {
     Mesh* mesh = subMesh->parent;
-    
+
+    ALog_A(mesh->sharedMesh == NULL, "ASubMesh Deform cannot change the uv shared from sharedMesh");
+
     memcpy
     (
         (char*)  mesh->vertexArr->data + subMesh->positionDataOffset,
@@ -210,7 +238,13 @@ static inline void DeformApplyPositionUV(SubMesh *subMesh)
 static inline void DeformApplyPosition(SubMesh *subMesh)
 {
     Mesh* mesh = subMesh->parent;
-    
+
+    ALog_A
+    (
+        mesh->sharedMesh == NULL || subMesh->isDynamicPosition,
+        "ASubMesh Deform cannot change the positions shared from sharedMesh"
+    );
+
     memcpy
     (
         (char*)  mesh->vertexArr->data + subMesh->positionDataOffset,
@@ -232,7 +266,9 @@ static inline void DeformApplyPosition(SubMesh *subMesh)
 static inline void DeformApplyUV(SubMesh* subMesh)
 {
     Mesh* mesh = subMesh->parent;
-    
+
+    ALog_A(mesh->sharedMesh == NULL, "ASubMesh Deform cannot change the uv shared from sharedMesh");
+
     memcpy
     (
         (char*)  mesh->vertexArr->data + mesh->uvDataOffset + subMesh->uvDataOffset,
@@ -426,6 +462,7 @@ struct ASubMesh ASubMesh[1] =
 {{
     CreateWithData,
     CreateWithQuad,
+    CreateWithShared,
     SetUVWithQuad,
     Deform,
     DeformByIndex,
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-8-7
- * Update   : 2019-1-19
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -60,6 +60,12 @@ struct SubMesh
      */
     float         uvHeight;
 
+    /**
+     * If true, the SubMesh created by CreateWithShared copies positionArr instead of sharing it,
+     * because the positions will be changed such as skinned or deformed, default false.
+     */
+    bool          isDynamicPosition;
+
 //----------------------------------------------------------------------------------------------------------------------
 
     Array(float*) positionArr[1];
@@ -141,6 +147,14 @@ struct ASubMesh
      */
     SubMesh* (*CreateWithQuad)(Mesh* parent, Quad* quad);
 
+    /**
+     * The positionArr (unless isDynamicPosition), uvArr and indexArr refer to the data of sharedSubMesh,
+     * and the data offsets in parent Mesh are same as sharedSubMesh.
+     *
+     * important: the shared uv cannot be changed, and the shared positions cannot be deformed.
+     */
+    SubMesh* (*CreateWithShared)(Mesh* parent, SubMesh* sharedSubMesh);
+
     /**
      * Set uv data with quad that in parent texture.
      */
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-1-2
- * Update   : 2019-1-19
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -17,47 +17,103 @@
 #include <stdlib.h>
 #include "Engine/Graphics/OpenGL/Texture.h"
 #include "Engine/Graphics/OpenGL/GLTool.h"
-#include "Engine/Toolkit/Utils/ArrayStrMap.h"
+#include "Engine/Graphics/Utils/Image.h"
+#include "Engine/Toolkit/HeaderUtils/Struct.h"
+#include "Engine/Toolkit/Utils/HashStrMap.h"
 #include "Engine/Toolkit/Platform/Log.h"
 
 
-static ArrayStrMap(filePath, Texture*) textureCacheMap[1] = AArrayStrMap_Init(Texture*, 25);
+static HashStrMap(filePath, Texture*) textureCacheMap[1] = AHashStrMap_Init(Texture*, 25);
 
 
-static Texture* Get(const char* resourceFilePath)
+static void Evict(ResourceRef* ref)
+{
+    Texture* texture = AStruct_GetParentWithName(ref, Texture, resourceRef);
+    glDeleteTextures(1, (GLuint[1]) {texture->id});
+
+    bool isRemoved = AHashStrMap->TryRemove(textureCacheMap, texture->filePath);
+    ALog_A(isRemoved, "ATexture Evict not found %s in textureCacheMap", texture->filePath);
+
+    free(texture);
+}
+
+
+static Texture* GetWithImage(const char* resourceFilePath, Image* image)
 {
-    Texture* texture = AArrayStrMap_Get(textureCacheMap, resourceFilePath, Texture*);
+    Texture* texture = AHashStrMap_Get(textureCacheMap, resourceFilePath, Texture*);
 
     if (texture == NULL)
     {
         texture = malloc(sizeof(Texture));
-        AGLTool->LoadTexture(resourceFilePath, texture);
+        AGLTool->LoadTextureWithImage(image, texture);
 
-        texture->filePath = AArrayStrMap_GetKey
-                           (
-                               AArrayStrMap_TryPut(textureCacheMap, resourceFilePath, texture),
-                               textureCacheMap->valueTypeSize
-                           );
+        texture->filePath = AHashStrMap_GetKey(AHashStrMap_TryPut(textureCacheMap, resourceFilePath, texture));
+        AResource->Add(ResourceClass_Texture, AImage_GetBytes(image), Evict, texture->resourceRef);
+    }
+    else
+    {
+        AResource->Retain(texture->resourceRef);
     }
 
     return texture;
 }
 
 
-static void Destroy(Texture* texture)
+static Texture* Get(const char* resourceFilePath)
 {
-    glDeleteTextures(1, (GLuint[1]) {texture->id});
+    Texture* texture = AHashStrMap_Get(textureCacheMap, resourceFilePath, Texture*);
+
+    if (texture == NULL)
+    {
+        Image image[1];
 
-    bool isRemoved = AArrayStrMap->TryRemove(textureCacheMap, texture->filePath);
-    ALog_A(isRemoved, "ATexture Destroy not found %s in textureCacheMap", texture->filePath);
+        bool isInit = AImage->Init(resourceFilePath, image);
+        ALog_A(isInit, "ATexture Get failed, no pixels data found in %s", resourceFilePath);
 
-    free(texture);
+        texture = GetWithImage(resourceFilePath, image);
+        AImage->Release(image);
+    }
+    else
+    {
+        AResource->Retain(texture->resourceRef);
+    }
+
+    return texture;
+}
+
+
+static Texture* Find(const char* resourceFilePath)
+{
+    return AHashStrMap_Get(textureCacheMap, resourceFilePath, Texture*);
+}
+
+
+static void Retain(Texture* texture)
+{
+    AResource->Retain(texture->resourceRef);
+}
+
+
+static void Release(Texture* texture)
+{
+    AResource->Release(texture->resourceRef);
+}
+
+
+static void Destroy(Texture* texture)
+{
+    AResource->Remove(texture->resourceRef);
+    Evict(texture->resourceRef);
 }
 
 
 struct ATexture ATexture[1] =
 {{
     Get,
+    GetWithImage,
+    Retain,
+    Release,
+    Find,
     Destroy,
 }};
 
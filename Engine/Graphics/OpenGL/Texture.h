@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2012-12-29
- * Update   : 2019-1-19
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -20,6 +20,8 @@
 
 #include "Engine/Graphics/OpenGL/Platform/gl3.h"
 #include "Engine/Toolkit/HeaderUtils/Define.h"
+#include "Engine/Toolkit/Utils/Resource.h"
+#include "Engine/Graphics/Utils/Image.h"
 
 
 typedef struct
@@ -40,9 +42,14 @@ typedef struct
     float   height;
 
     /**
-     * All texture cache in ArrayStrMap by filePath.
+     * All texture cache in HashStrMap by filePath.
      */
     const char* filePath;
+
+    /**
+     * The references of texture, the bytes are the RGBA pixels in GPU.
+     */
+    ResourceRef resourceRef[1];
 }
 Texture;
 
@@ -53,20 +60,42 @@ Texture;
 struct ATexture
 {
     /**
-     * Get Texture by resourceFilePath, not found will create one.
+     * Get Texture by resourceFilePath, not found or evicted will create one.
+     * the Texture is referenced, and needs to Release after using.
      *
      * resourceFilePath:
      *     Android: assets
      *     IOS    : NSBundle
      */
-    Texture*  (*Get)    (const char* resourceFilePath);
+    Texture*  (*Get)          (const char* resourceFilePath);
+
+    /**
+     * Get Texture by resourceFilePath, not found will create one with the Image inited by AImage.
+     * the Texture is referenced same as Get, and the Image is not released, and not used if Texture found.
+     */
+    Texture*  (*GetWithImage) (const char* resourceFilePath, Image* image);
+
+    /**
+     * Reference the Texture that got by other user.
+     */
+    void      (*Retain)       (Texture* texture);
+
+    /**
+     * Release the reference of Texture, the unused Texture is kept in cache until evicted by AResource budget.
+     */
+    void      (*Release)      (Texture* texture);
+
+    /**
+     * Find Texture by resourceFilePath in cache, not found return NULL.
+     */
+    Texture*  (*Find)         (const char* resourceFilePath);
 
     /**
-     * Destroy texture memory both in GPU and CPU, and removed from cache.
+     * Destroy texture memory both in GPU and CPU, and removed from cache, whatever the references.
      *
      * important: after Destroy the texture will be invalidated.
      */
-    void      (*Destroy)(Texture* texture);
+    void      (*Destroy)      (Texture* texture);
 };
 
 
@@ -9,46 +9,127 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-08-30
- * Update   : 2019-1-19
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
 
 #include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
 #include <setjmp.h>
 
 #include "Engine/Graphics/Utils/Image.h"
-#include "Engine/Toolkit/Platform/File.h"
+#include "Engine/Toolkit/Utils/FileTool.h"
+#include "Engine/Toolkit/Utils/Pack.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/ThirdParty/PNG/Include/Android/png.h"
 
 
+/**
+ * The bytes of file head that distinguish PNG and pre-decoded texture file.
+ */
+#define AImage_HeadLength 8
+
+
+/**
+ * The image file data that PNG or pre-decoded texture reads from.
+ */
+typedef struct
+{
+    /**
+     * The file data in memory, used when stream asset is NULL.
+     */
+    png_bytep   data;
+    size_t      length;
+    size_t      offset;
+    FileMapping mapping[1];
+
+    /**
+     * The stream of compressed file in pack, the asset is NULL when read from data.
+     */
+    PackStream  stream [1];
+}
+ImageSource;
+
+
+/**
+ * Read length bytes from source, return false if no enough data.
+ */
+static bool ReadSource(ImageSource* source, png_bytep data, size_t length)
+{
+    if (source->stream->asset != NULL)
+    {
+        // the compressed PNG is decompressed block by block while decoding
+        return APack->ReadStream(source->stream, data, length) == (int) length;
+    }
+
+    if (length > source->length - source->offset)
+    {
+        return false;
+    }
+
+    memcpy(data, source->data + source->offset, length);
+    source->offset += length;
+
+    return true;
+}
+
+
 /**
  * Callback for libpng read data.
  */
 static void ReadPNGData(png_structp pngPtr, png_bytep data, png_size_t length)
 {
-    AFile->Read(png_get_io_ptr(pngPtr), data, length);
+    if (ReadSource(png_get_io_ptr(pngPtr), data, length) == false)
+    {
+        png_error(pngPtr, "AImage ReadPNGData out of PNG data");
+    }
 }
 
 
-static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidth, float* outHeight)
+static void InitSource(const char* resourceFilePath, ImageSource* outSource)
 {
-    void* pixelData = NULL;
-    File* file       = NULL;
+    const PackAsset* asset = APack->Find(resourceFilePath);
 
-    do
+    if (asset != NULL && asset->blockEnds != NULL)
+    {
+        APack->InitStream(asset, outSource->stream);
+        outSource->data = NULL;
+    }
+    else
     {
-        file = AFile->Open(resourceFilePath);
+        outSource->stream->asset = NULL;
+        outSource->data          = AFileTool->CreateMappedDataFromResource(resourceFilePath, outSource->mapping);
+        outSource->length        = (size_t) outSource->mapping->length;
+        outSource->offset        = 0;
+    }
+}
 
-        unsigned char head[8];
-        AFile->Read(file, head, 8);
-        if (png_sig_cmp(head, 0, 8))
-        {
-            ALog_E("AImage CreatePixelDataFromPNG file is not PNG, %s", resourceFilePath);
-            break;
-        }
 
+static void ReleaseSource(ImageSource* source)
+{
+    if (source->stream->asset != NULL)
+    {
+        APack->ReleaseStream(source->stream);
+    }
+    else
+    {
+        AFileTool->ReleaseMappedData(source->mapping);
+    }
+}
+
+
+/**
+ * Decode the PNG of source that the 8 bytes signature has been read.
+ */
+static void* DecodePNG(ImageSource* source, const char* resourceFilePath, float* outWidth, float* outHeight)
+{
+    // volatile keeps the value assigned after setjmp when png_error longjmps back
+    void* volatile pixelData = NULL;
+
+    do
+    {
         // create and initialize the png_struct with the desired error handler
         // functions.  If you want to use the default stderr and longjump method,
         // you can supply NULL for the last three parameters.  We also supply the
@@ -57,7 +138,7 @@ static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidt
         png_structp pngPtr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
         if (!pngPtr)
         {
-            ALog_E("AImage CreatePixelDataFromPNG png_create_read_struct error, %s", resourceFilePath);
+            ALog_E("AImage DecodePNG png_create_read_struct error, %s", resourceFilePath);
             break;
         }
 
@@ -66,7 +147,7 @@ static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidt
         if (infoPtr == NULL)
         {
             png_destroy_read_struct(&pngPtr, NULL, NULL);
-            ALog_E("AImage CreatePixelDataFromPNG png_create_info_struct infoPtr error, %s", resourceFilePath);
+            ALog_E("AImage DecodePNG png_create_info_struct infoPtr error, %s", resourceFilePath);
             break;
         }
 
@@ -74,7 +155,7 @@ static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidt
         if (endInfo == NULL)
         {
             png_destroy_read_struct(&pngPtr, &infoPtr, NULL);
-            ALog_E("AImage CreatePixelDataFromPNG png_create_info_struct endInfo error, %s", resourceFilePath);
+            ALog_E("AImage DecodePNG png_create_info_struct endInfo error, %s", resourceFilePath);
             break;
         }
 
@@ -83,16 +164,20 @@ static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidt
         // set up your own error handlers in the png_create_read_struct() earlier.
         if (setjmp(png_jmpbuf(pngPtr)))
         {
+          // free the pixel data of the PNG that failed in reading rows
+          png_free(pngPtr, pixelData);
+          pixelData = NULL;
+
           // free all of the memory associated with the png_ptr and info_ptr
           png_destroy_read_struct(&pngPtr, &infoPtr, &endInfo);
-          ALog_E("AImage CreatePixelDataFromPNG during setjmp error, %s", resourceFilePath);
+          ALog_E("AImage DecodePNG during setjmp error, %s", resourceFilePath);
           break;
         }
 
         // if you are using replacement read functions, instead of calling
         // png_init_io() here you would call:
         // where user_io_ptr is a structure you want available to the callbacks
-        png_set_read_fn(pngPtr, file, ReadPNGData);
+        png_set_read_fn(pngPtr, source, ReadPNGData);
 
         // if we have already read some of the signature
         png_set_sig_bytes(pngPtr, 8);
@@ -155,7 +240,7 @@ static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidt
         if (pixelData == NULL)
         {
             png_destroy_read_struct(&pngPtr, &infoPtr, &endInfo);
-            ALog_E("AImage CreatePixelDataFromPNG malloc PNG pixel data error, %s", resourceFilePath);
+            ALog_E("AImage DecodePNG malloc PNG pixel data error, %s", resourceFilePath);
             break;
         }
 
@@ -181,14 +266,165 @@ static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidt
     }
     while (false);
 
-    AFile->Close(file);
+    return pixelData;
+}
+
+
+static void* CreatePixelDataFromPNG(const char* resourceFilePath, float* outWidth, float* outHeight)
+{
+    void*         pixelData = NULL;
+    ImageSource   source[1];
+    unsigned char head  [AImage_HeadLength];
+
+    InitSource(resourceFilePath, source);
+
+    if (ReadSource(source, head, AImage_HeadLength) == false || png_sig_cmp(head, 0, AImage_HeadLength))
+    {
+        ALog_E("AImage CreatePixelDataFromPNG file is not PNG, %s", resourceFilePath);
+    }
+    else
+    {
+        pixelData = DecodePNG(source, resourceFilePath, outWidth, outHeight);
+    }
+
+    ReleaseSource(source);
 
     return pixelData;
 }
 
 
+/**
+ * Init Image by the pre-decoded texture file of source that the head has been read.
+ * the source is owned by outImage or released, return false if the file is invalid.
+ */
+static bool InitTexture(ImageSource* source, const char* resourceFilePath, unsigned char* head, Image* outImage)
+{
+    if (source->stream->asset != NULL)
+    {
+        // the compressed texture file in pack is read into malloc buffer
+        long  length = source->stream->asset->length;
+        char* data   = malloc((size_t) length);
+
+        memcpy(data, head, AImage_HeadLength);
+
+        if (APack->ReadStream(source->stream, data + AImage_HeadLength, (size_t) (length - AImage_HeadLength))
+            != length - AImage_HeadLength)
+        {
+            ALog_E("AImage Init read texture file error, %s", resourceFilePath);
+            APack->ReleaseStream(source->stream);
+            free(data);
+            return false;
+        }
+
+        APack->ReleaseStream(source->stream);
+
+        outImage->mapping->data       = data;
+        outImage->mapping->length     = length;
+        outImage->mapping->mapAddress = NULL;
+        outImage->mapping->mapLength  = 0;
+    }
+    else
+    {
+        // the pixels point into the mapped data without copy
+        *outImage->mapping = *source->mapping;
+    }
+
+    ImageTextureHeader* header = outImage->mapping->data;
+
+    if (outImage->mapping->length < (long) sizeof(ImageTextureHeader))
+    {
+        ALog_E("AImage Init texture file has no header, %s", resourceFilePath);
+        AFileTool->ReleaseMappedData(outImage->mapping);
+        return false;
+    }
+
+    outImage->pixels          = header + 1;
+    outImage->width           = (int) header->width;
+    outImage->height          = (int) header->height;
+    outImage->format          = (ImageFormat) header->format;
+    outImage->levelCount      = header->levelCount;
+    outImage->isPremultiplied = (header->flags & ImageFlag_Premultiplied) != 0;
+
+    if
+    (
+        header->version           != AImage_TextureVersion ||
+        header->format            >  ImageFormat_RGBA4444  ||
+        header->levelCount        == 0                     ||
+        outImage->mapping->length <  (long) sizeof(ImageTextureHeader) + AImage_GetBytes(outImage)
+    )
+    {
+        ALog_E("AImage Init texture file is invalid, %s", resourceFilePath);
+        AFileTool->ReleaseMappedData(outImage->mapping);
+        return false;
+    }
+
+    return true;
+}
+
+
+static bool Init(const char* resourceFilePath, Image* outImage)
+{
+    ImageSource   source[1];
+    unsigned char head  [AImage_HeadLength];
+
+    InitSource(resourceFilePath, source);
+
+    if (ReadSource(source, head, AImage_HeadLength))
+    {
+        if (memcmp(head, AImage_TextureMagic, 4) == 0)
+        {
+            return InitTexture(source, resourceFilePath, head, outImage);
+        }
+
+        if (png_sig_cmp(head, 0, AImage_HeadLength) == 0)
+        {
+            float width;
+            float height;
+
+            outImage->pixels = DecodePNG(source, resourceFilePath, &width, &height);
+
+            if (outImage->pixels != NULL)
+            {
+                outImage->width           = (int) width;
+                outImage->height          = (int) height;
+                outImage->format          = ImageFormat_RGBA8888;
+                outImage->levelCount      = 1;
+                outImage->isPremultiplied = false;
+                outImage->mapping->data   = NULL;
+            }
+
+            ReleaseSource(source);
+
+            return outImage->pixels != NULL;
+        }
+    }
+
+    ALog_E("AImage Init file is neither PNG nor texture file, %s", resourceFilePath);
+    ReleaseSource(source);
+
+    return false;
+}
+
+
+static void Release(Image* image)
+{
+    if (image->mapping->data != NULL)
+    {
+        AFileTool->ReleaseMappedData(image->mapping);
+    }
+    else
+    {
+        free(image->pixels);
+    }
+
+    image->pixels = NULL;
+}
+
+
 struct AImage AImage[1] =
 {{
     CreatePixelDataFromPNG,
+    Init,
+    Release,
 }};
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-08-30
- * Update   : 2019-1-19
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -18,7 +18,112 @@
 #define IMAGE_H
 
 
+#include <stdint.h>
+#include <stdbool.h>
 #include "Engine/Toolkit/HeaderUtils/Define.h"
+#include "Engine/Toolkit/Platform/File.h"
+
+
+/**
+ * The pixel format of Image.
+ */
+typedef enum
+{
+    /**
+     * 4 bytes per pixel, the PNG is always decoded into this format.
+     */
+    ImageFormat_RGBA8888,
+
+    /**
+     * 2 bytes per pixel, no alpha.
+     */
+    ImageFormat_RGB565,
+
+    /**
+     * 2 bytes per pixel.
+     */
+    ImageFormat_RGBA4444,
+}
+ImageFormat;
+
+
+/**
+ * The header of pre-decoded texture file, which is made by the build tool TextureConverter.
+ * the pixels of levels follow the header, level 0 first, and each level is padded to 4 bytes.
+ * all numbers are little endian.
+ */
+typedef struct
+{
+    /**
+     * Always AImage_TextureMagic.
+     */
+    char     magic[4];
+
+    /**
+     * Always AImage_TextureVersion.
+     */
+    uint8_t  version;
+
+    /**
+     * The ImageFormat.
+     */
+    uint8_t  format;
+
+    /**
+     * The count of mip levels, 1 means no mipmap.
+     */
+    uint8_t  levelCount;
+
+    /**
+     * The ImageFlag bits.
+     */
+    uint8_t  flags;
+
+    uint32_t width;
+    uint32_t height;
+}
+ImageTextureHeader;
+
+
+/**
+ * The flags of pre-decoded texture file.
+ */
+typedef enum
+{
+    /**
+     * The RGB is multiplied by alpha, it needs glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA).
+     */
+    ImageFlag_Premultiplied = 1,
+}
+ImageFlag;
+
+
+/**
+ * The pixels of texture ready for uploading to GPU.
+ */
+typedef struct
+{
+    /**
+     * The pixels of all levels, level 0 first, and each level is padded to 4 bytes.
+     */
+    void*       pixels;
+    int         width;
+    int         height;
+    ImageFormat format;
+    int         levelCount;
+    bool        isPremultiplied;
+
+    /**
+     * The pre-decoded texture file data that pixels point into,
+     * the data is NULL when pixels are decoded from PNG.
+     */
+    FileMapping mapping[1];
+}
+Image;
+
+
+#define AImage_TextureMagic   "MTEX"
+#define AImage_TextureVersion 1
 
 
 struct AImage
@@ -32,10 +137,75 @@ struct AImage
      *     IOS    : NSBundle
      */
      void* (*CreatePixelDataFromPNG)(const char* resourceFilePath, float* outWidth, float* outHeight);
+
+    /**
+     * Init Image from resourceFilePath, after using the Image must be released.
+     * if the file is pre-decoded texture file, the pixels are mapped without decoding,
+     * else the file is decoded as PNG into ImageFormat_RGBA8888.
+     *
+     * return false when error happened.
+     *
+     * resourceFilePath:
+     *     Android: assets
+     *     IOS    : NSBundle
+     */
+     bool  (*Init)                  (const char* resourceFilePath, Image* outImage);
+
+    /**
+     * Release the mapped or decoded pixels of Image.
+     */
+     void  (*Release)               (Image* image);
 };
 
 
 extern struct AImage AImage[1];
 
 
+/**
+ * Get the bytes of one pixel in format.
+ */
+static inline int AImage_GetPixelBytes(ImageFormat format)
+{
+    return format == ImageFormat_RGBA8888 ? 4 : 2;
+}
+
+
+/**
+ * Get the padded bytes of level pixels, the width and height are of level 0.
+ */
+static inline int AImage_GetLevelBytes(ImageFormat format, int width, int height, int level)
+{
+    int levelWidth  = width  >> level;
+    int levelHeight = height >> level;
+
+    if (levelWidth == 0)
+    {
+        levelWidth = 1;
+    }
+
+    if (levelHeight == 0)
+    {
+        levelHeight = 1;
+    }
+
+    return (levelWidth * levelHeight * AImage_GetPixelBytes(format) + 3) & ~3;
+}
+
+
+/**
+ * Get the bytes of all level pixels of Image.
+ */
+static inline long AImage_GetBytes(Image* image)
+{
+    long bytes = 0;
+
+    for (int i = 0; i < image->levelCount; ++i)
+    {
+        bytes += AImage_GetLevelBytes(image->format, image->width, image->height, i);
+    }
+
+    return bytes;
+}
+
+
 #endif
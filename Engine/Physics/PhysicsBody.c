@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2014-6-3
- * Update   : 2019-1-18
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -46,6 +46,7 @@ static inline PhysicsBody* CreateBody(Array(float)* vertexArr, PhysicsShape shap
     body->shape          = shape;
     body->state          = PhysicsBodyState_OutsideWorld;
     body->collisionGroup = 0;
+    body->worldHandle    = 0;
     body->OnCollision    = NULL;
 
     return body;
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2014-6-3
- * Update   : 2019-1-18
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -21,6 +21,7 @@
 #include "Engine/Toolkit/Math/Matrix.h"
 #include "Engine/Toolkit/HeaderUtils/Bitwise.h"
 #include "Engine/Toolkit/Utils/Array.h"
+#include "Engine/Toolkit/Utils/SlotMap.h"
 #include "Engine/Toolkit/HeaderUtils/UserData.h"
 
 
@@ -100,6 +101,11 @@ struct  PhysicsBody
      */
     Array(float)     transformedVertexArr[1];
 
+    /**
+     * The handle of body in PhysicsWorld.
+     */
+    SlotMapHandle    worldHandle;
+
     /**
      * When body collision callback.
      */
@@ -9,31 +9,31 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2014-5-30
- * Update   : 2019-1-18
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
 
 #include "Engine/Physics/PhysicsWorld.h"
-#include "Engine/Toolkit/Utils/ArrayIntSet.h"
+#include "Engine/Toolkit/Utils/SlotMap.h"
 #include "Engine/Physics/PhysicsCollision.h"
 
 
-static ArrayIntSet(PhysicsBody*) bodyInWorldSet[1] = AArrayIntSet_Init(PhysicsBody*, 20);
+static SlotMap(PhysicsBody*) bodyInWorldMap[1] = ASlotMap_Init(PhysicsBody*, 20);
 
 
 static void Update(float deltaSeconds)
 {
-    for (int i = 0; i < bodyInWorldSet->elementList->size; ++i)
+    for (int i = 0; i < bodyInWorldMap->elementList->size; ++i)
     {
-        PhysicsBody* body = AArrayList_Get(bodyInWorldSet->elementList, i, PhysicsBody*);
+        PhysicsBody* body = ASlotMap_GetAt(bodyInWorldMap, i, PhysicsBody*);
 
         if (body->state != PhysicsBodyState_Freeze)
         {
             // test collision
-            for (int fromIndex = i + 1; fromIndex < bodyInWorldSet->elementList->size; ++fromIndex)
+            for (int fromIndex = i + 1; fromIndex < bodyInWorldMap->elementList->size; ++fromIndex)
             {
-                PhysicsBody* otherBody = AArrayList_Get(bodyInWorldSet->elementList, fromIndex, PhysicsBody*);
+                PhysicsBody* otherBody = ASlotMap_GetAt(bodyInWorldMap, fromIndex, PhysicsBody*);
 
                 if
                 (
@@ -69,7 +69,7 @@ static void Update(float deltaSeconds)
 static PhysicsBody* AddBody(PhysicsShape shape, Array(float)* vertexArr)
 {
     PhysicsBody* body = APhysicsBody->Create(shape, vertexArr);
-    AArrayIntSet->TryAdd(bodyInWorldSet, (intptr_t) body);
+    body->worldHandle = ASlotMap_Add(bodyInWorldMap, body);
 
     return body;
 }
@@ -77,7 +77,7 @@ static PhysicsBody* AddBody(PhysicsShape shape, Array(float)* vertexArr)
 
 static void DestroyBody(PhysicsBody* body)
 {
-    AArrayIntSet->TryRemove(bodyInWorldSet, (intptr_t) body);
+    ASlotMap->TryRemove(bodyInWorldMap, body->worldHandle);
     free(body);
 }
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-8-29
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
  
@@ -23,6 +23,8 @@
 
 
 #include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include <android/native_activity.h>
 #include "Engine/Toolkit/Platform/File.h"
 #include "Engine/Toolkit/Platform/Log.h"
@@ -41,7 +43,13 @@ static File* Open(const char* resourceFilePath)
 static int OpenFileDescriptor(const char* resourceFilePath, long* outStart, long* outLength)
 {
     AAsset* asset = AAssetManager_open(nativeActivity->assetManager, resourceFilePath, AASSET_MODE_UNKNOWN);
-    int     fd    = AAsset_openFileDescriptor(asset, (off_t*) outStart, (off_t*) outLength);
+
+    if (asset == NULL)
+    {
+        return -1;
+    }
+
+    int fd = AAsset_openFileDescriptor(asset, (off_t*) outStart, (off_t*) outLength);
     AAsset_close(asset);
 
     return fd;
@@ -90,6 +98,71 @@ static const char* GetInternalDataPath(int* outPathLength)
 }
 
 
+static bool Map(const char* resourceFilePath, FileMapping* outMapping)
+{
+    AAsset* asset = AAssetManager_open(nativeActivity->assetManager, resourceFilePath, AASSET_MODE_UNKNOWN);
+
+    if (asset == NULL)
+    {
+        ALog_E("AFile Map failed, cannot open asset = %s", resourceFilePath);
+        return false;
+    }
+
+    off_t start;
+    off_t length;
+    int   fd = AAsset_openFileDescriptor(asset, &start, &length);
+
+    AAsset_close(asset);
+
+    // the asset is compressed in apk
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    // the mmap offset must be aligned by page size
+    off_t pageSize     = (off_t) sysconf(_SC_PAGESIZE);
+    off_t alignedStart = start & ~(pageSize - 1);
+    void* address      = mmap
+                         (
+                             NULL,
+                             (size_t) (length + start - alignedStart),
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE,
+                             fd,
+                             alignedStart
+                         );
+
+    // the mapping keeps its own reference of file
+    close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        ALog_E("AFile Map failed, mmap error asset = %s", resourceFilePath);
+        return false;
+    }
+
+    outMapping->data       = (char*) address + (start - alignedStart);
+    outMapping->length     = (long) length;
+    outMapping->mapAddress = address;
+    outMapping->mapLength  = (size_t) (length + start - alignedStart);
+
+    return true;
+}
+
+
+static void Unmap(FileMapping* mapping)
+{
+    if (mapping->mapAddress != NULL)
+    {
+        munmap(mapping->mapAddress, mapping->mapLength);
+
+        mapping->data       = NULL;
+        mapping->mapAddress = NULL;
+    }
+}
+
+
 struct AFile AFile[1] =
 {{
     Open,
@@ -99,6 +172,8 @@ struct AFile AFile[1] =
     Read,
     Seek,
     GetInternalDataPath,
+    Map,
+    Unmap,
 }};
 
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-08-27
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -19,6 +19,7 @@
 
 
 #include <stddef.h>
+#include <stdbool.h>
 #include "Engine/Toolkit/HeaderUtils/Define.h"
 
 
@@ -30,6 +31,36 @@
  */
 typedef struct File File;
 
+
+/**
+ * The memory view of file data mapped by AFile->Map.
+ */
+typedef struct
+{
+    /**
+     * The file data in mapped memory.
+     */
+    void*  data;
+
+    /**
+     * The length of file data.
+     */
+    long   length;
+
+    /**
+     * The page aligned address of mapped memory, the data is inside it.
+     * NULL means the data is not mapped.
+     */
+    void*  mapAddress;
+
+    /**
+     * The length of mapped memory.
+     */
+    size_t mapLength;
+}
+FileMapping;
+
+
 /**
  * Resource File access API.
  */
@@ -91,6 +122,26 @@ struct AFile
      *     IOS    : document data directory
      */
     const char* (*GetInternalDataPath)(int* outPathLength);
+
+    /**
+     * Map the file data from platform resource directory into memory,
+     * the data is read from page cache on demand without copy.
+     *
+     * the mapping is private copy-on-write,
+     * so the data can be modified in place and the modifications never write back to file.
+     *
+     * resourceFilePath:
+     *     Android: assets
+     *     IOS    : NSBundle
+     *
+     * return false if the file cannot be mapped (for example, if the file is compressed).
+     */
+    bool        (*Map)                (const char* resourceFilePath, FileMapping* outMapping);
+
+    /**
+     * Unmap the memory of mapping, and after Unmap the mapping data will be invalidated.
+     */
+    void        (*Unmap)              (FileMapping* mapping);
 };
 
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-8-29
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -24,6 +24,10 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <Foundation/Foundation.h>
 
 #include "Engine/Toolkit/Platform/File.h"
@@ -42,13 +46,17 @@ static File* Open(const char* resourceFilePath)
 
 static int OpenFileDescriptor(const char* relativeFilePath, long* outStart, long* outLength)
 {
-    FILE* file = (FILE*) Open(relativeFilePath);
-    int   fd   = fileno(file);
+    NSString* path = [[NSBundle mainBundle] pathForResource:[NSString stringWithUTF8String:relativeFilePath] ofType:nil];
+    int       fd   = open([path cStringUsingEncoding:NSMacOSRomanStringEncoding], O_RDONLY);
 
-    *outStart  = ftell(file);
-    fseek(file, 0, SEEK_END);
-    *outLength = ftell(file);
-    fseek(file, *outStart , SEEK_SET);
+    if (fd >= 0)
+    {
+        struct stat fileStat;
+        fstat(fd, &fileStat);
+
+        *outStart  = 0;
+        *outLength = (long) fileStat.st_size;
+    }
 
     return fd;
 }
@@ -76,7 +84,8 @@ static long GetLength(File* file)
 static int Read(File* file, void* buffer, size_t count)
 {
     FILE*  f    = (FILE*) file;
-    size_t read = fread(buffer, count, 1, f);
+    // the count of bytes read
+    size_t read = fread(buffer, 1, count, f);
 
     if (ferror(f) != 0)
     {
@@ -130,6 +139,58 @@ static const char* GetInternalDataPath(int* outPathLength)
 }
 
 
+static bool Map(const char* resourceFilePath, FileMapping* outMapping)
+{
+    NSString* path = [[NSBundle mainBundle] pathForResource:[NSString stringWithUTF8String:resourceFilePath] ofType:nil];
+    int       fd   = open([path cStringUsingEncoding:NSMacOSRomanStringEncoding], O_RDONLY);
+
+    if (fd < 0)
+    {
+        ALog_E("AFile Map failed, cannot open file = %s", resourceFilePath);
+        return false;
+    }
+
+    struct stat fileStat;
+
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        // the empty file cannot be mapped
+        close(fd);
+        return false;
+    }
+
+    void* address = mmap(NULL, (size_t) fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+    // the mapping keeps its own reference of file
+    close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        ALog_E("AFile Map failed, mmap error file = %s", resourceFilePath);
+        return false;
+    }
+
+    outMapping->data       = address;
+    outMapping->length     = (long) fileStat.st_size;
+    outMapping->mapAddress = address;
+    outMapping->mapLength  = (size_t) fileStat.st_size;
+
+    return true;
+}
+
+
+static void Unmap(FileMapping* mapping)
+{
+    if (mapping->mapAddress != NULL)
+    {
+        munmap(mapping->mapAddress, mapping->mapLength);
+
+        mapping->data       = NULL;
+        mapping->mapAddress = NULL;
+    }
+}
+
+
 struct AFile AFile[1] =
 {{
     Open,
@@ -139,6 +200,8 @@ struct AFile AFile[1] =
     Read,
     Seek,
     GetInternalDataPath,
+    Map,
+    Unmap,
 }};
 
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2012-12-20
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -33,7 +33,7 @@
     #define  ALog_D(...)
     #define  ALog_W(...)
     #define  ALog_E(...)    printf(__VA_ARGS__), printf("\n");
-    #define  ALog_A(e, ...) e ? (void) 0 : printf(__VA_ARGS__), printf("\n"),  assert(e);
+    #define  ALog_A(e, ...) e ? (void) 0 : (void) (printf(__VA_ARGS__), printf("\n")), assert(e);
 #endif
 
 
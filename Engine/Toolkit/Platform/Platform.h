@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-5-6
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -20,7 +20,14 @@
 
 #define PLATFORM_ANDROID 0
 #define PLATFORM_IOS     1
-#define PLATFORM_TARGET  PLATFORM_ANDROID
+
+
+/**
+ * The host build tools define PLATFORM_TARGET as PLATFORM_IOS, so the engine code logs by printf.
+ */
+#ifndef PLATFORM_TARGET
+    #define PLATFORM_TARGET PLATFORM_ANDROID
+#endif
 
 
 #if PLATFORM_TARGET == PLATFORM_ANDROID
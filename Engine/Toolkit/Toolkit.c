@@ -9,16 +9,18 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2014-9-8
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
 
 #include "Engine/Toolkit/Toolkit.h"
+#include "Engine/Toolkit/Utils/Job.h"
 
 
 static void Init()
 {
+    AJob->Init(0);
 }
 
 
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "Engine/Toolkit/Utils/Arena.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * Get the aligned offset in block data that not less than used.
+ */
+static inline int GetAlignedOffset(ArenaBlock* block, int used)
+{
+    uintptr_t address = (uintptr_t) (block->data + used);
+    return used + (int) ((AArena_Alignment - (address & (AArena_Alignment - 1))) & (AArena_Alignment - 1));
+}
+
+
+static void* Alloc(Arena* arena, int size)
+{
+    ALog_A(size >= 0, "AArena Alloc failed, size = %d cannot < 0", size);
+
+    if (arena->blockIndex != -1)
+    {
+        ArenaBlock* block  = AArrayList_GetPtr(arena->blockList, arena->blockIndex, ArenaBlock);
+        int         offset = GetAlignedOffset(block, arena->used);
+
+        if (offset + size <= block->size)
+        {
+            arena->used = offset + size;
+            return block->data + offset;
+        }
+    }
+
+    int blockIndex = arena->blockIndex + 1;
+    // enough for the size after aligned
+    int needSize   = size + AArena_Alignment;
+    int freeIndex  = blockIndex;
+
+    // find a free block that is big enough
+    while
+    (
+        freeIndex < arena->blockList->size &&
+        AArrayList_GetPtr(arena->blockList, freeIndex, ArenaBlock)->size < needSize
+    )
+    {
+        ++freeIndex;
+    }
+
+    if (freeIndex == arena->blockList->size)
+    {
+        ArenaBlock block[1];
+        block->size = needSize > arena->blockSize ? needSize : arena->blockSize;
+        block->data = malloc((size_t) block->size);
+
+        ALog_A(block->data != NULL, "AArena Alloc failed, unable to malloc memory, size = %d", block->size);
+
+        // the blocks after blockIndex are free, so insert will not effect any used memory
+        AArrayList->Insert(arena->blockList, blockIndex, block);
+    }
+    else if (freeIndex != blockIndex)
+    {
+        // swap the free block to blockIndex
+        ArenaBlock* blocks = AArrayList_GetData(arena->blockList, ArenaBlock);
+        ArenaBlock  block  = blocks[freeIndex];
+        blocks[freeIndex]  = blocks[blockIndex];
+        blocks[blockIndex] = block;
+    }
+
+    ArenaBlock* block  = AArrayList_GetPtr(arena->blockList, blockIndex, ArenaBlock);
+    int         offset = GetAlignedOffset(block, 0);
+
+    arena->blockIndex  = blockIndex;
+    arena->used        = offset + size;
+
+    return block->data + offset;
+}
+
+
+static void* AllocZero(Arena* arena, int size)
+{
+    return memset(Alloc(arena, size), 0, (size_t) size);
+}
+
+
+static char* CopyStr(Arena* arena, const char* str)
+{
+    int length = (int) strlen(str) + 1;
+    return memcpy(Alloc(arena, length), str, (size_t) length);
+}
+
+
+static void* ArrayListRealloc(void* context, void* oldData, size_t oldSize, size_t newSize)
+{
+    Arena* arena = context;
+
+    if (oldData != NULL && arena->blockIndex != -1)
+    {
+        ArenaBlock* block = AArrayList_GetPtr(arena->blockList, arena->blockIndex, ArenaBlock);
+
+        // the last allocated data can grow in place
+        if
+        (
+            (char*) oldData + oldSize == block->data + arena->used &&
+            (char*) oldData + newSize <= block->data + block->size
+        )
+        {
+            arena->used = (int) ((char*) oldData + newSize - block->data);
+            return oldData;
+        }
+    }
+
+    void* data = Alloc(arena, (int) newSize);
+
+    if (oldData != NULL)
+    {
+        memcpy(data, oldData, oldSize < newSize ? oldSize : newSize);
+    }
+
+    return data;
+}
+
+
+static void ArrayListFree(void* context, void* data, size_t size)
+{
+    Arena* arena = context;
+
+    if (arena->blockIndex != -1)
+    {
+        ArenaBlock* block = AArrayList_GetPtr(arena->blockList, arena->blockIndex, ArenaBlock);
+
+        // give back the last allocated data
+        if ((char*) data + size == block->data + arena->used)
+        {
+            arena->used = (int) ((char*) data - block->data);
+        }
+    }
+}
+
+
+static void InitArrayListAllocator(Arena* arena, ArrayListAllocator* outAllocator)
+{
+    outAllocator->Realloc = ArrayListRealloc;
+    outAllocator->Free    = ArrayListFree;
+    outAllocator->context = arena;
+}
+
+
+static ArenaMark GetMark(Arena* arena)
+{
+    return (ArenaMark) {arena->blockIndex, arena->used};
+}
+
+
+static void Rollback(Arena* arena, ArenaMark mark)
+{
+    ALog_A
+    (
+        mark.blockIndex < arena->blockIndex || (mark.blockIndex == arena->blockIndex && mark.used <= arena->used),
+        "AArena Rollback failed, mark (%d, %d) is after current (%d, %d)",
+        mark.blockIndex,
+        mark.used,
+        arena->blockIndex,
+        arena->used
+    );
+
+    arena->blockIndex = mark.blockIndex;
+    arena->used       = mark.used;
+}
+
+
+static void Reset(Arena* arena)
+{
+    arena->blockIndex = -1;
+    arena->used       = 0;
+}
+
+
+static void Shrink(Arena* arena)
+{
+    int fromIndex = arena->blockIndex + 1;
+
+    if (fromIndex < arena->blockList->size)
+    {
+        for (int i = fromIndex; i < arena->blockList->size; ++i)
+        {
+            free(AArrayList_GetPtr(arena->blockList, i, ArenaBlock)->data);
+        }
+
+        AArrayList->RemoveRange(arena->blockList, fromIndex, arena->blockList->size - 1);
+        AArrayList->Shrink     (arena->blockList);
+    }
+}
+
+
+static void Release(Arena* arena)
+{
+    for (int i = 0; i < arena->blockList->size; ++i)
+    {
+        free(AArrayList_GetPtr(arena->blockList, i, ArenaBlock)->data);
+    }
+
+    AArrayList->Release(arena->blockList);
+    Reset(arena);
+}
+
+
+static void Init(int blockSize, Arena* outArena)
+{
+    ALog_A(blockSize > 0, "AArena Init failed, blockSize = %d cannot <= 0", blockSize);
+
+    AArrayList->Init(sizeof(ArenaBlock), outArena->blockList);
+    outArena->blockList->increase = 4;
+    outArena->blockSize           = blockSize;
+
+    Reset(outArena);
+}
+
+
+static Arena* Create(int blockSize)
+{
+    Arena* arena = malloc(sizeof(Arena));
+    Init(blockSize, arena);
+
+    return arena;
+}
+
+
+struct AArena AArena[1] =
+{{
+    .frameArena   = {AArena_Init(16 * 1024)},
+    .scratchArena = {AArena_Init(64 * 1024)},
+
+    .Create       = Create,
+    .Init         = Init,
+    .Release      = Release,
+    .Alloc        = Alloc,
+    .AllocZero    = AllocZero,
+    .CopyStr      = CopyStr,
+    .GetMark      = GetMark,
+    .Rollback     = Rollback,
+    .Reset        = Reset,
+    .Shrink       = Shrink,
+
+    .InitArrayListAllocator = InitArrayListAllocator,
+}};
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef ARENA_H
+#define ARENA_H
+
+
+#include <stddef.h>
+#include "Engine/Toolkit/Utils/ArrayList.h"
+
+
+/**
+ * One memory block of Arena.
+ */
+typedef struct
+{
+    char* data;
+    int   size;
+}
+ArenaBlock;
+
+
+/**
+ * The linear allocator that alloc memory by moving the used offset in blocks,
+ * and free memory all at once by Reset or Rollback, the blocks keep for reuse.
+ */
+typedef struct
+{
+    /**
+     * The min size of new block.
+     */
+    int                   blockSize;
+
+    /**
+     * All blocks, the blocks after blockIndex are free.
+     */
+    ArrayList(ArenaBlock) blockList[1];
+
+    /**
+     * Index of current alloc block in blockList, -1 means no block used.
+     */
+    int                   blockIndex;
+
+    /**
+     * The used bytes of current block.
+     */
+    int                   used;
+}
+Arena;
+
+
+/**
+ * The alloc position of Arena, use for rollback.
+ */
+typedef struct
+{
+    int blockIndex;
+    int used;
+}
+ArenaMark;
+
+
+/**
+ * Control Arena.
+ *
+ * the memory alloc from Arena is aligned by AArena_Alignment,
+ * and the Arena is not thread safe.
+ */
+struct AArena
+{
+    /**
+     * The Arena reset by AApplication->Loop at the start of each frame,
+     * so the memory alloc from it only valid in current frame.
+     */
+    Arena     frameArena  [1];
+
+    /**
+     * The Arena for loaders temporary data,
+     * use with GetMark and Rollback in a scope, so the nested loaders can share it.
+     */
+    Arena     scratchArena[1];
+
+    Arena*    (*Create)   (int blockSize);
+    void      (*Init)     (int blockSize, Arena* outArena);
+
+    /**
+     * Free all blocks memory.
+     */
+    void      (*Release)  (Arena* arena);
+
+    /**
+     * Alloc size bytes memory, if current block not enough will use or create next block.
+     */
+    void*     (*Alloc)    (Arena* arena, int size);
+
+    /**
+     * Alloc size bytes memory and set to 0.
+     */
+    void*     (*AllocZero)(Arena* arena, int size);
+
+    /**
+     * Copy str with '\0' into Arena memory.
+     */
+    char*     (*CopyStr)  (Arena* arena, const char* str);
+
+    /**
+     * Get the current alloc position.
+     */
+    ArenaMark (*GetMark)  (Arena* arena);
+
+    /**
+     * Free all memory alloc after mark.
+     */
+    void      (*Rollback) (Arena* arena, ArenaMark mark);
+
+    /**
+     * Free all memory alloc from Arena, and keep blocks memory space.
+     */
+    void      (*Reset)    (Arena* arena);
+
+    /**
+     * Release not used blocks memory which are after current block.
+     */
+    void      (*Shrink)   (Arena* arena);
+
+    /**
+     * Init outAllocator that makes ArrayList alloc memory from arena,
+     * the last allocated data grows in place, and the memory is freed with arena.
+     */
+    void      (*InitArrayListAllocator)(Arena* arena, ArrayListAllocator* outAllocator);
+};
+
+
+extern struct AArena AArena[1];
+
+
+/**
+ * The alignment of Arena alloc memory.
+ */
+#define AArena_Alignment 16
+
+
+/**
+ * Init constant Arena.
+ * example: Arena arena[1] = AArena_Init(blockSize)
+ */
+#define AArena_Init(blockSize)             \
+    {                                      \
+        blockSize,                         \
+        {AArrayList_Init(ArenaBlock, 4)},  \
+        -1,                                \
+        0,                                 \
+    }
+
+
+/**
+ * Shortcut of AArena->Alloc with type.
+ * return elementPtr of count elements.
+ */
+#define AArena_AllocArr(arena, ElementType, count) \
+    ((ElementType*) AArena->Alloc(arena, (int) sizeof(ElementType) * (count)))
+
+
+#endif
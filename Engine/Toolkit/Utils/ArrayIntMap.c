@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-5-20
- * Update   : 2019-1-17
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -40,69 +40,93 @@
     )
 
 
+/**
+ * The max size of keyList that use linear search instead of binary search.
+ */
+static const int linearSearchSize = 16;
+
 
 /**
  * Search index of key, if negative not found then return "-insertIndex - 1",
- * so insert index is "-BinarySearch() - 1".
+ * so insert index is "-Search() - 1".
  */
-static inline int BinarySearch(ArrayList(intptr_t)* elementList, intptr_t key)
+static inline int Search(ArrayList(intptr_t)* keyList, intptr_t key)
 {
-    int high  = elementList->size;
-    int low   = -1;
-    int guess = -1;
+    const intptr_t* keys = AArrayList_GetData(keyList, intptr_t);
+    int             size = keyList->size;
+    int             index;
 
-    while (high - low > 1) // prevent infinite loops
+    if (size <= linearSearchSize)
     {
-        // (high + low) always positive, so convert to unsigned
-        // then the '>>' is unsigned move right
-        // so the overflow will be handled correctly
-        // because sign bit shift to right and 0 will be added
-        guess               = (unsigned int) (high + low) >> 1;
-        intptr_t elementKey = AArrayList_Get(elementList, guess, ArrayIntMapElement*)->key;
-
-        if (elementKey < key)
-        {
-            low  = guess;
-        }
-        else if (elementKey > key)
+        index = 0;
+
+        // count the keys less than key without branch,
+        // so the loop can be vectorized by compiler
+        for (int i = 0; i < size; ++i)
         {
-            high = guess;
+            index += keys[i] < key;
         }
-        else if (elementKey == key)
+    }
+    else
+    {
+        const intptr_t* base = keys;
+        int             n    = size;
+
+        // lower bound binary search,
+        // the loop condition only depends on n, and the choice compiles to conditional move
+        while (n > 1)
         {
-            // find the key, the guess is positive value
-            return guess;
+            int half = n >> 1;
+            base     = base[half] < key ? base + half : base;
+            n       -= half;
         }
-    }
 
-    // if guess == high
-    // the guess is bigger than key index and insert value at guess
+        index = (int) (base - keys) + (*base < key);
+    }
 
-    if (guess == low)
+    if (index < size && keys[index] == key)
     {
-        // the guess is smaller than key index and insert value behind,
-        // or if list empty then the guess is -1, so do this make guess at 0
-        ++guess;
+        return index;
     }
 
-    // when list empty the guess is 0, so we -1 make sure return negative value
-    return -guess - 1;
+    // when not found the index is insert index, so we -1 make sure return negative value
+    return -index - 1;
+}
+
+
+static inline void* InsertElement(ArrayIntMap* arrayIntMap, intptr_t key, int index, void* valuePtr)
+{
+    AArrayList_Insert(arrayIntMap->keyList, index, key);
+
+    return memcpy
+           (
+               AArrayList->GetInsert(arrayIntMap->elementList, index),
+               valuePtr,
+               (size_t) arrayIntMap->valueTypeSize
+           );
+}
+
+
+static inline void RemoveElement(ArrayIntMap* arrayIntMap, int index)
+{
+    AArrayList->Remove(arrayIntMap->keyList,     index);
+    AArrayList->Remove(arrayIntMap->elementList, index);
+}
+
+
+static inline void* GetValuePtr(ArrayIntMap* arrayIntMap, int index)
+{
+    return (char*) arrayIntMap->elementList->elementArr->data + arrayIntMap->valueTypeSize * index;
 }
 
 
 static void* TryPut(ArrayIntMap* arrayIntMap, intptr_t key, void* valuePtr)
 {
-    int guess = BinarySearch(arrayIntMap->elementList, key);
+    int guess = Search(arrayIntMap->keyList, key);
 
     if (guess < 0)
     {
-        ArrayIntMapElement* element = malloc(sizeof(ArrayIntMapElement) + arrayIntMap->valueTypeSize);
-        element->key                = key;
-        element->valuePtr           = (char*) element + sizeof(ArrayIntMapElement);
-
-        AArrayList_Insert(arrayIntMap->elementList, -guess - 1, element);
-
-        return memcpy(element->valuePtr, valuePtr, (size_t) arrayIntMap->valueTypeSize);
+        return InsertElement(arrayIntMap, key, -guess - 1, valuePtr);
     }
     else
     {
@@ -113,25 +137,19 @@ static void* TryPut(ArrayIntMap* arrayIntMap, intptr_t key, void* valuePtr)
 
 static void* Get(ArrayIntMap* arrayIntMap, intptr_t key, void* defaultValuePtr)
 {
-    int guess = BinarySearch(arrayIntMap->elementList, key);
+    int guess = Search(arrayIntMap->keyList, key);
 
-    return guess >= 0 ?
-           AArrayList_Get(arrayIntMap->elementList, guess, ArrayIntMapElement*)->valuePtr : defaultValuePtr;
+    return guess >= 0 ? GetValuePtr(arrayIntMap, guess) : defaultValuePtr;
 }
 
 
 static void* TrySet(ArrayIntMap* arrayIntMap, intptr_t key, void* valuePtr)
 {
-    int guess = BinarySearch(arrayIntMap->elementList, key);
+    int guess = Search(arrayIntMap->keyList, key);
 
     if (guess >= 0)
     {
-        return memcpy
-               (
-                   AArrayList_Get(arrayIntMap->elementList, guess, ArrayIntMapElement*)->valuePtr,
-                   valuePtr,
-                   (size_t) arrayIntMap->valueTypeSize
-               );
+        return memcpy(GetValuePtr(arrayIntMap, guess), valuePtr, (size_t) arrayIntMap->valueTypeSize);
     }
     else
     {
@@ -142,17 +160,11 @@ static void* TrySet(ArrayIntMap* arrayIntMap, intptr_t key, void* valuePtr)
 
 static bool TryRemove(ArrayIntMap* arrayIntMap, intptr_t key)
 {
-    int guess = BinarySearch(arrayIntMap->elementList, key);
+    int guess = Search(arrayIntMap->keyList, key);
 
     if (guess >= 0)
     {
-        free
-        (
-            AArrayList_Get(arrayIntMap->elementList, guess, ArrayIntMapElement*)
-        );
-
-        AArrayList->Remove(arrayIntMap->elementList, guess);
-
+        RemoveElement(arrayIntMap, guess);
         return true;
     }
     
@@ -162,14 +174,7 @@ static bool TryRemove(ArrayIntMap* arrayIntMap, intptr_t key)
 
 static void Clear(ArrayIntMap* arrayIntMap)
 {
-    for (int i = 0; i < arrayIntMap->elementList->size; ++i)
-    {
-        free
-        (
-            AArrayList_Get(arrayIntMap->elementList, i, ArrayIntMapElement*)
-        );
-    }
-
+    AArrayList->Clear(arrayIntMap->keyList);
     AArrayList->Clear(arrayIntMap->elementList);
 }
 
@@ -177,72 +182,90 @@ static void Clear(ArrayIntMap* arrayIntMap)
 static void* InsertAt(ArrayIntMap* arrayIntMap, intptr_t key, int index, void* valuePtr)
 {
     CheckInsertIndex("InsertAt");
-
-    ArrayIntMapElement* element = malloc(sizeof(ArrayIntMapElement) + arrayIntMap->valueTypeSize);
-    element->key                = key;
-    element->valuePtr           = (char*) element + sizeof(ArrayIntMapElement);
-    AArrayList_Insert(arrayIntMap->elementList, index, element);
-
-    return memcpy(element->valuePtr, valuePtr, (size_t) arrayIntMap->valueTypeSize);
+    return InsertElement(arrayIntMap, key, index, valuePtr);
 }
 
 
 static int GetIndex(ArrayIntMap* arrayIntMap, intptr_t key)
 {
-    return BinarySearch(arrayIntMap->elementList, key);
+    return Search(arrayIntMap->keyList, key);
 }
 
 
 static intptr_t GetKey(ArrayIntMap* arrayIntMap, int index)
 {
     CheckIndex("GetKey");
-    return AArrayList_Get(arrayIntMap->elementList, index, ArrayIntMapElement*)->key;
+    return AArrayList_Get(arrayIntMap->keyList, index, intptr_t);
 }
 
 
 static void* GetAt(ArrayIntMap* arrayIntMap, int index)
 {
     CheckIndex("GetAt");
-    return AArrayList_Get(arrayIntMap->elementList, index, ArrayIntMapElement*)->valuePtr;
+    return GetValuePtr(arrayIntMap, index);
 }
 
 
 static void* SetAt(ArrayIntMap* arrayIntMap, int index, void* valuePtr)
 {
     CheckIndex("SetAt");
-
-    return memcpy
-           (
-               AArrayList_Get(arrayIntMap->elementList, index, ArrayIntMapElement*)->valuePtr,
-               valuePtr,
-               (size_t) arrayIntMap->valueTypeSize
-           );
+    return memcpy(GetValuePtr(arrayIntMap, index), valuePtr, (size_t) arrayIntMap->valueTypeSize);
 }
 
 
 static void RemoveAt(ArrayIntMap* arrayIntMap, int index)
 {
     CheckIndex("RemoveAt");
-
-    free
-    (
-        AArrayList_Get(arrayIntMap->elementList, index, ArrayIntMapElement*)
-    );
-
-    AArrayList->Remove(arrayIntMap->elementList, index);
+    RemoveElement(arrayIntMap, index);
 }
 
 
-static void Release(ArrayIntMap* arrayIntMap)
+static void Reorder(ArrayIntMap* arrayIntMap)
 {
-    for (int i = 0; i < arrayIntMap->elementList->size; ++i)
+    intptr_t* keys          = AArrayList_GetData(arrayIntMap->keyList, intptr_t);
+    int       valueTypeSize = arrayIntMap->valueTypeSize;
+    char      value[valueTypeSize];
+
+    // insertion sort, keys usually only a few changed so it almost sorted
+    for (int i = 1; i < arrayIntMap->keyList->size; ++i)
     {
-        free
+        intptr_t key = keys[i];
+        int      j   = i - 1;
+
+        if (keys[j] <= key)
+        {
+            ALog_A(keys[j] != key, "AArrayIntMap Reorder failed, two elements have same key = %ld", (long) key);
+            continue;
+        }
+
+        memcpy(value, GetValuePtr(arrayIntMap, i), (size_t) valueTypeSize);
+
+        while (j > -1 && keys[j] > key)
+        {
+            keys[j + 1] = keys[j];
+            --j;
+        }
+
+        ALog_A(j == -1 || keys[j] != key, "AArrayIntMap Reorder failed, two elements have same key = %ld", (long) key);
+
+        keys[j + 1] = key;
+
+        // move values [j + 1, i - 1] one position behind
+        memmove
         (
-            AArrayList_Get(arrayIntMap->elementList, i, ArrayIntMapElement*)
+            GetValuePtr(arrayIntMap, j + 2),
+            GetValuePtr(arrayIntMap, j + 1),
+            (size_t) (valueTypeSize * (i - j - 1))
         );
+
+        memcpy(GetValuePtr(arrayIntMap, j + 1), value, (size_t) valueTypeSize);
     }
+}
 
+
+static void Release(ArrayIntMap* arrayIntMap)
+{
+    AArrayList->Release(arrayIntMap->keyList);
     AArrayList->Release(arrayIntMap->elementList);
 }
 
@@ -251,11 +274,13 @@ static void InitWithCapacity(int valueTypeSize, int capacity, ArrayIntMap* outAr
 {
     if (capacity == 0)
     {
-        AArrayList->Init(sizeof(ArrayIntMapElement*), outArrayIntMap->elementList);
+        AArrayList->Init(sizeof(intptr_t), outArrayIntMap->keyList);
+        AArrayList->Init(valueTypeSize,    outArrayIntMap->elementList);
     }
     else
     {
-        AArrayList->InitWithCapacity(sizeof(ArrayIntMapElement*), capacity, outArrayIntMap->elementList);
+        AArrayList->InitWithCapacity(sizeof(intptr_t), capacity, outArrayIntMap->keyList);
+        AArrayList->InitWithCapacity(valueTypeSize,    capacity, outArrayIntMap->elementList);
     }
 
     outArrayIntMap->valueTypeSize = valueTypeSize;
@@ -303,11 +328,9 @@ struct AArrayIntMap AArrayIntMap[1] =
     GetAt,
     SetAt,
     RemoveAt,
+    Reorder,
 }};
 
 
 #undef CheckIndex
 #undef CheckInsertIndex
-
-
-
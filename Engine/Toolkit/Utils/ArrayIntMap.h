@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-5-27
- * Update   : 2019-1-17
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -24,38 +24,27 @@
 
 
 /**
- * The actual element store in ArrayIntMap.
+ * A list of elements each of which is a k-v pair.
+ * the keys and values are stored in two parallel flat lists without per-element malloc,
+ * and the keys are sorted so the same index of keyList and elementList is one k-v pair.
  */
 typedef struct
 {
     /**
-     * IDentity and search element value.
+     * The sizeof ArrayIntMap value type.
      */
-    intptr_t key;
+    int                      valueTypeSize;
 
     /**
-     * ArrayIntMap value pointer.
-     * the value data copy into ArrayIntMapElement malloc memory space.
+     * Store all keys in ascending order, the contiguous keys make search without chasing pointers.
      */
-    void*    valuePtr;
-}
-ArrayIntMapElement;
+    ArrayList(intptr_t)      keyList    [1];
 
-
-/**
- * A list of elements each of which is a k-v pair.
- */
-typedef struct
-{
     /**
-     * The sizeof ArrayIntMap value type.
-     */
-    int                            valueTypeSize;
-
-    /**
-     * Store all ArrayIntMapElements.
+     * Store all values inline, the value data copy into elementList memory space.
+     * if increase capacity or insert and remove, values will move, so the valuePtr may changed.
      */
-    ArrayList(ArrayIntMapElement*) elementList[1];
+    ArrayList(ValueType)     elementList[1];
 }
 ArrayIntMap;
 
@@ -76,7 +65,7 @@ struct AArrayIntMap
     /**
      * Put key and value of valuePtr into ArrayIntMap.
      *
-     * valuePtr: point to value that will copy in ArrayIntMapElement
+     * valuePtr: point to value that will copy in ArrayIntMap
      *
      * if key not exist in ArrayIntMap
      *     return valuePtr in ArrayIntMap
@@ -154,6 +143,13 @@ struct AArrayIntMap
      * Remove value at index
      */
     void         (*RemoveAt)          (ArrayIntMap* arrayIntMap, int index);
+
+
+    /**
+     * Sort all elements by key, the keys must be unique.
+     * used when keys have been modified directly in keyList.
+     */
+    void         (*Reorder)           (ArrayIntMap* arrayIntMap);
 };
 
 
@@ -170,11 +166,12 @@ extern struct AArrayIntMap AArrayIntMap[1];
  * Init constant ArrayIntMap.
  * example: ArrayIntMap map[1] = AArrayIntMap_Init(ValueType, increase)
  */
-#define AArrayIntMap_Init(ValueType, increase)          \
-    {                                                   \
-        sizeof(ValueType),                              \
-        AArrayList_Init(ArrayIntMapElement*, increase), \
-    }                                                   \
+#define AArrayIntMap_Init(ValueType, increase) \
+    {                                          \
+        sizeof(ValueType),                     \
+        AArrayList_Init(intptr_t,  increase),  \
+        AArrayList_Init(ValueType, increase),  \
+    }                                          \
 
 
 /**
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-2-4
- * Update   : 2019-1-17
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -40,15 +40,72 @@
     )
 
 
+/**
+ * Realloc memory data to length by allocator or realloc, the data in buffer will be copied out.
+ */
+static inline void* ReallocData(ArrayList* arrayList, int length)
+{
+    void*  oldData = arrayList->elementArr->data;
+    size_t oldSize = (size_t) arrayList->elementArr->length * arrayList->elementTypeSize;
+    size_t newSize = (size_t) length                        * arrayList->elementTypeSize;
+
+    if (oldData != NULL && oldData == arrayList->buffer)
+    {
+        // elements move out of buffer
+        void* data = arrayList->allocator == NULL ?
+                     malloc(newSize) :
+                     arrayList->allocator->Realloc(arrayList->allocator->context, NULL, 0, newSize);
+
+        if (data != NULL)
+        {
+            memcpy(data, oldData, (size_t) arrayList->size * arrayList->elementTypeSize);
+        }
+
+        return data;
+    }
+
+    if (arrayList->allocator == NULL)
+    {
+        return realloc(oldData, newSize);
+    }
+
+    return arrayList->allocator->Realloc(arrayList->allocator->context, oldData, oldSize, newSize);
+}
+
+
+/**
+ * Free memory data by allocator or free, the buffer will not be freed.
+ */
+static inline void FreeData(ArrayList* arrayList)
+{
+    void* data = arrayList->elementArr->data;
+
+    if (data == NULL || data == arrayList->buffer)
+    {
+        return;
+    }
+
+    if (arrayList->allocator == NULL)
+    {
+        free(data);
+    }
+    else
+    {
+        arrayList->allocator->Free
+        (
+            arrayList->allocator->context,
+            data,
+            (size_t) arrayList->elementArr->length * arrayList->elementTypeSize
+        );
+    }
+}
+
+
 static inline void AddCapacity(ArrayList* arrayList, int increase)
 {
     ALog_A(increase > 0, "AArrayList AddCapacity failed, increase = %d cannot <= 0", increase);
 
-    void* data = realloc
-                 (
-                     arrayList->elementArr->data,
-                     (size_t) (increase + arrayList->elementArr->length) * arrayList->elementTypeSize
-                 );
+    void* data = ReallocData(arrayList, increase + arrayList->elementArr->length);
 
     ALog_A
     (
@@ -62,11 +119,39 @@ static inline void AddCapacity(ArrayList* arrayList, int increase)
 }
 
 
+/**
+ * Increase capacity by growth policy, and the capacity at least minLength.
+ */
+static inline void Grow(ArrayList* arrayList, int minLength)
+{
+    ALog_A
+    (
+        arrayList->increase > 0,
+        "AArrayList Grow failed, the capacity = %d is fixed, cannot increase to %d",
+        arrayList->elementArr->length, minLength
+    );
+
+    int increase = arrayList->increase;
+
+    if (arrayList->growth == ArrayListGrowth_Geometric && increase < arrayList->elementArr->length >> 1)
+    {
+        increase = arrayList->elementArr->length >> 1;
+    }
+
+    if (increase < minLength - arrayList->elementArr->length)
+    {
+        increase = minLength - arrayList->elementArr->length;
+    }
+
+    AddCapacity(arrayList, increase);
+}
+
+
 static void* GetAdd(ArrayList* arrayList)
 {
     if (arrayList->size == arrayList->elementArr->length)
     {
-        AddCapacity(arrayList, arrayList->increase);
+        Grow(arrayList, arrayList->size + 1);
     }
 
     return (char*) arrayList->elementArr->data + arrayList->elementTypeSize * (arrayList->size++);
@@ -80,7 +165,7 @@ static void* GetInsert(ArrayList* arrayList, int index)
 
     if (arrayList->size == arrayList->elementArr->length)
     {
-        AddCapacity(arrayList, arrayList->increase);
+        Grow(arrayList, arrayList->size + 1);
     }
 
     void* from = (char*) arrayList->elementArr->data + arrayList->elementTypeSize * index;
@@ -157,11 +242,9 @@ static void AddArray(ArrayList* arrayList, void* data, int length, int elementTy
         elementTypeSize
     );
 
-    int n = arrayList->elementArr->length - arrayList->size - length;
-
-    if (n < 0)
+    if (arrayList->size + length > arrayList->elementArr->length)
     {
-        AddCapacity(arrayList, -n + arrayList->increase);
+        Grow(arrayList, arrayList->size + length);
     }
 
     memcpy
@@ -187,8 +270,8 @@ static void Remove(ArrayList* arrayList, int index)
         void* to   = (char*) arrayList->elementArr->data + arrayList->elementTypeSize * index;
         void* from = (char*) to                          + arrayList->elementTypeSize;
 
-        // move between index and last index element
-        memcpy(to, from,  (size_t) arrayList->elementTypeSize * (arrayList->size - index));
+        // move between index and last index element, from and to overlap so cannot use memcpy
+        memmove(to, from, (size_t) arrayList->elementTypeSize * (arrayList->size - index));
     }
 }
 
@@ -209,8 +292,8 @@ static void RemoveRange(ArrayList* arrayList, int fromIndex, int toIndex)
         void* to    = (char*) arrayList->elementArr->data + arrayList->elementTypeSize * fromIndex;
         void* from  = (char*) to                          + arrayList->elementTypeSize * num;
 
-        // move between lastIndex and toIndex element
-        memcpy(to, from, (size_t) arrayList->elementTypeSize * (lastIndex - toIndex));
+        // move between lastIndex and toIndex element, from and to may overlap so cannot use memcpy
+        memmove(to, from, (size_t) arrayList->elementTypeSize * (lastIndex - toIndex));
     }
 }
 
@@ -242,15 +325,21 @@ static void Clear(ArrayList* arrayList)
 
 static void Shrink(ArrayList* arrayList)
 {
+    if (arrayList->elementArr->data == arrayList->buffer)
+    {
+        // the buffer cannot shrink
+        return;
+    }
+
     if (arrayList->size == 0)
     {
-        free(arrayList->elementArr->data);
+        FreeData(arrayList);
         arrayList->elementArr->data   = NULL;
         arrayList->elementArr->length = 0;
     }
     else
     {
-        void* data = realloc(arrayList->elementArr->data, (size_t) arrayList->size * arrayList->elementTypeSize);
+        void* data = ReallocData(arrayList, arrayList->size);
         ALog_A(data, "AArrayList Shrink error, size = %d ", arrayList->size);
 
         arrayList->elementArr->data   = data;
@@ -261,10 +350,11 @@ static void Shrink(ArrayList* arrayList)
 
 static void Release(ArrayList* arrayList)
 {
-    free(arrayList->elementArr->data);
+    FreeData(arrayList);
     arrayList->elementArr->data   = NULL;
     arrayList->elementArr->length = 0;
-    arrayList->size                 = 0;
+    arrayList->size               = 0;
+    arrayList->buffer             = NULL;
 }
 
 
@@ -295,6 +385,9 @@ static inline void InitArrayList(int elementTypeSize, ArrayList* arrayList)
     arrayList->elementTypeSize    = elementTypeSize;
     arrayList->size               = 0;
     arrayList->increase           = 20;
+    arrayList->growth             = ArrayListGrowth_Geometric;
+    arrayList->buffer             = NULL;
+    arrayList->allocator          = NULL;
 }
 
 
@@ -345,6 +438,27 @@ static void InitWithCapacity(int elementTypeSize, int capacity, ArrayList* outAr
 }
 
 
+static void InitWithBuffer(int elementTypeSize, void* buffer, int capacity, ArrayList* outArrayList)
+{
+    InitArrayList(elementTypeSize, outArrayList);
+    outArrayList->buffer             = buffer;
+    outArrayList->elementArr->data   = buffer;
+    outArrayList->elementArr->length = capacity;
+}
+
+
+static void SetAllocator(ArrayList* arrayList, ArrayListAllocator* allocator)
+{
+    ALog_A
+    (
+        arrayList->elementArr->data == NULL || arrayList->elementArr->data == arrayList->buffer,
+        "AArrayList SetAllocator failed, the memory data already allocated"
+    );
+
+    arrayList->allocator = allocator;
+}
+
+
 struct AArrayList AArrayList[1] =
 {{
     Create,
@@ -353,6 +467,7 @@ struct AArrayList AArrayList[1] =
     InitWithSize,
     CreateWithCapacity,
     InitWithCapacity,
+    InitWithBuffer,
 
     Release,
 
@@ -369,6 +484,7 @@ struct AArrayList AArrayList[1] =
     Shrink,
     SetSize,
     SetCapacity,
+    SetAllocator,
 }};
 
 
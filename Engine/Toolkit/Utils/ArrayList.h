@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-2-4
- * Update   : 2019-1-17
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -18,9 +18,52 @@
 #define ARRAY_LIST_H
 
 
+#include <stddef.h>
 #include "Engine/Toolkit/Utils/Array.h"
 
 
+/**
+ * How ArrayList increase memory capacity when full.
+ */
+typedef enum
+{
+    /**
+     * Increase max(increase, capacity / 2), the copying cost of growing to N elements is O(N).
+     */
+    ArrayListGrowth_Geometric,
+
+    /**
+     * Increase fixed increase, keep memory tight for the list that size is known roughly.
+     */
+    ArrayListGrowth_Fixed,
+}
+ArrayListGrowth;
+
+
+/**
+ * The memory allocator of ArrayList elements data, such as Arena.
+ */
+typedef struct
+{
+    /**
+     * Allocate newSize memory and keep oldSize data of oldData, oldData can be NULL.
+     * return new data.
+     */
+    void* (*Realloc)(void* context, void* oldData, size_t oldSize, size_t newSize);
+
+    /**
+     * Free data that allocated by Realloc.
+     */
+    void  (*Free)   (void* context, void* data, size_t size);
+
+    /**
+     * Passed to Realloc and Free.
+     */
+    void*   context;
+}
+ArrayListAllocator;
+
+
 /**
  * The list can dynamically increase memory capacity that implemented by array.
  */
@@ -28,25 +71,42 @@ typedef struct
 {
     /**
      * Increase memory space when needed, default 10.
+     * if 0 the capacity cannot increase.
      */
-    int   increase;
+    int                 increase;
 
     /**
      * The sizeof element type.
      */
-    int   elementTypeSize;
+    int                 elementTypeSize;
 
     /**
      * Elements count.
      */
-    int   size;
+    int                 size;
 
     /**
      * Store memory data, the length is memory capacity.
      * if increase capacity, memory data will realloc,
      * so the data address may changed.
      */
-    Array elementArr[1];
+    Array               elementArr[1];
+
+    /**
+     * Default ArrayListGrowth_Geometric.
+     */
+    ArrayListGrowth     growth;
+
+    /**
+     * The buffer given by InitWithBuffer, the elements store in it until the capacity increased.
+     * it will never be freed by ArrayList.
+     */
+    void*               buffer;
+
+    /**
+     * If NULL use realloc and free.
+     */
+    ArrayListAllocator* allocator;
 }
 ArrayList;
 
@@ -65,6 +125,13 @@ struct AArrayList
     ArrayList* (*CreateWithCapacity)(int elementTypeSize, int capacity);
     void       (*InitWithCapacity)  (int elementTypeSize, int capacity, ArrayList* outArrayList);
 
+    /**
+     * Init ArrayList that stores first capacity elements in buffer without any malloc,
+     * usually the buffer is an array next to ArrayList in the same struct.
+     * when more elements added, the elements will move to heap memory.
+     */
+    void       (*InitWithBuffer)    (int elementTypeSize, void* buffer, int capacity, ArrayList* outArrayList);
+
     void       (*Release)           (ArrayList* arrayList);
 
     /**
@@ -145,6 +212,12 @@ struct AArrayList
      * Set ArrayList capacity and increase capacity if needed.
      */
     void       (*SetCapacity)       (ArrayList* arrayList, int capacity);
+
+    /**
+     * Set the allocator of memory data, must be called when ArrayList has no memory data or only buffer.
+     * allocator: NULL means use realloc and free, the allocator must be valid until ArrayList released.
+     */
+    void       (*SetAllocator)      (ArrayList* arrayList, ArrayListAllocator* allocator);
 };
 
 
@@ -167,10 +240,13 @@ extern struct AArrayList AArrayList[1];
         increase,                              \
         sizeof(ElementType),                   \
         0,                                     \
-        {                                      \
+        {{                                     \
             NULL,                              \
             0,                                 \
-        },                                     \
+        }},                                    \
+        ArrayListGrowth_Geometric,             \
+        NULL,                                  \
+        NULL,                                  \
     }
 
 
@@ -184,6 +260,9 @@ extern struct AArrayList AArrayList[1];
         sizeof(ElementType),                                  \
         size,                                                 \
         AArray_Init(ElementType, capacity, __VA_ARGS__),      \
+        ArrayListGrowth_Fixed,                                \
+        NULL,                                                 \
+        NULL,                                                 \
     }
 
 
@@ -9,38 +9,123 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-6-5
- * Update   : 2019-1-17
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
 
 #include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
 #include "Engine/Toolkit/Utils/ArrayQueue.h"
 #include "Engine/Toolkit/Platform/Log.h"
 
 
+/**
+ * The capacity of first allocation when no capacity given.
+ */
+static const int defaultCapacity = 8;
+
+
+/**
+ * Get the elementPtr at index of elementArr.
+ */
+#define GetElementPtr(arrayQueue, index) \
+    ((char*) (arrayQueue)->elementArr->data + (arrayQueue)->elementTypeSize * (index))
+
+
+/**
+ * Get the index of elementArr by the index that counts from the top.
+ */
+#define GetArrIndex(arrayQueue, index) \
+    (((arrayQueue)->topIndex + (index)) & ((arrayQueue)->elementArr->length - 1))
+
+
+static inline int GetPowerOf2(int capacity)
+{
+    int length = defaultCapacity;
+
+    while (length < capacity)
+    {
+        length <<= 1;
+    }
+
+    return length;
+}
+
+
+static void Grow(ArrayQueue* arrayQueue)
+{
+    int   oldLength = arrayQueue->elementArr->length;
+    int   newLength = oldLength == 0 ? defaultCapacity : oldLength << 1;
+    void* data      = realloc(arrayQueue->elementArr->data, (size_t) (newLength * arrayQueue->elementTypeSize));
+
+    ALog_A
+    (
+        data != NULL,
+        "AArrayQueue Grow failed, unable to realloc memory, size = %d, length = %d",
+        newLength * arrayQueue->elementTypeSize, newLength
+    );
+
+    arrayQueue->elementArr->data   = data;
+    arrayQueue->elementArr->length = newLength;
+
+    // the wrapped elements at the head of elementArr move to after the old tail,
+    // the new length is twice of old, so there is always enough space
+    int wrapCount = arrayQueue->topIndex + arrayQueue->size - oldLength;
+
+    if (wrapCount > 0)
+    {
+        memcpy
+        (
+            GetElementPtr(arrayQueue, oldLength),
+            data,
+            (size_t) (wrapCount * arrayQueue->elementTypeSize)
+        );
+    }
+}
+
+
 static void* Push(ArrayQueue* arrayQueue, void* elementPtr)
 {
-    if (arrayQueue->topIndex > 0 && arrayQueue->topIndex == arrayQueue->elementList->elementArr->length)
+    if (arrayQueue->size == arrayQueue->elementArr->length)
     {
-        AArrayList->RemoveRange(arrayQueue->elementList, 0, arrayQueue->topIndex - 1);
-        arrayQueue->topIndex = 0;
+        Grow(arrayQueue);
     }
 
-    return AArrayList->Add(arrayQueue->elementList, elementPtr);
+    void* ptr = GetElementPtr(arrayQueue, GetArrIndex(arrayQueue, arrayQueue->size));
+    memcpy(ptr, elementPtr, (size_t) arrayQueue->elementTypeSize);
+    ++arrayQueue->size;
+
+    return ptr;
 }
 
 
 static void* Pop(ArrayQueue* arrayQueue, void* defaultElementPtr)
 {
-    if (arrayQueue->topIndex == arrayQueue->elementList->size)
+    if (arrayQueue->size == 0)
     {
         return defaultElementPtr;
     }
 
-    return (char*) arrayQueue->elementList->elementArr->data +
-                   arrayQueue->elementList->elementTypeSize  *
-                   (arrayQueue->topIndex++);
+    void* ptr            = GetElementPtr(arrayQueue, arrayQueue->topIndex);
+    arrayQueue->topIndex = (arrayQueue->topIndex + 1) & (arrayQueue->elementArr->length - 1);
+    --arrayQueue->size;
+
+    return ptr;
+}
+
+
+static void* GetAt(ArrayQueue* arrayQueue, int index)
+{
+    ALog_A
+    (
+        index >= 0 && index < arrayQueue->size,
+        "AArrayQueue GetAt index = %d, out of range [0, %d]",
+        index, arrayQueue->size - 1
+    );
+
+    return GetElementPtr(arrayQueue, GetArrIndex(arrayQueue, index));
 }
 
 
@@ -48,34 +133,80 @@ static void RemoveAt(ArrayQueue* arrayQueue, int index)
 {
     ALog_A
     (
-        index >= arrayQueue->topIndex && index < arrayQueue->elementList->size,
-        "AArrayQueue RemoveAt index = %d, out of range [%d, %d]",
-        index, arrayQueue->topIndex, arrayQueue->elementList->size - 1
+        index >= 0 && index < arrayQueue->size,
+        "AArrayQueue RemoveAt index = %d, out of range [0, %d]",
+        index, arrayQueue->size - 1
     );
 
-    AArrayList->Remove(arrayQueue->elementList, index);
+    int elementTypeSize = arrayQueue->elementTypeSize;
+
+    if (index < arrayQueue->size - 1 - index)
+    {
+        // move the elements before index back by one, from index to top
+        for (int i = index; i > 0; --i)
+        {
+            memcpy
+            (
+                GetElementPtr(arrayQueue, GetArrIndex(arrayQueue, i)),
+                GetElementPtr(arrayQueue, GetArrIndex(arrayQueue, i - 1)),
+                (size_t) elementTypeSize
+            );
+        }
+
+        arrayQueue->topIndex = GetArrIndex(arrayQueue, 1);
+    }
+    else
+    {
+        // move the elements after index forward by one, from index to tail
+        for (int i = index; i < arrayQueue->size - 1; ++i)
+        {
+            memcpy
+            (
+                GetElementPtr(arrayQueue, GetArrIndex(arrayQueue, i)),
+                GetElementPtr(arrayQueue, GetArrIndex(arrayQueue, i + 1)),
+                (size_t) elementTypeSize
+            );
+        }
+    }
+
+    --arrayQueue->size;
 }
 
 
 static void Release(ArrayQueue* arrayQueue)
 {
-    arrayQueue->topIndex = 0;
-    AArrayList->Release(arrayQueue->elementList);
+    free(arrayQueue->elementArr->data);
+    arrayQueue->elementArr->data   = NULL;
+    arrayQueue->elementArr->length = 0;
+    arrayQueue->topIndex           = 0;
+    arrayQueue->size               = 0;
 }
 
 
 static void InitWithCapacity(int elementTypeSize, int capacity, ArrayQueue* outArrayQueue)
 {
+    outArrayQueue->elementTypeSize = elementTypeSize;
+    outArrayQueue->topIndex        = 0;
+    outArrayQueue->size            = 0;
+
     if (capacity == 0)
     {
-        AArrayList->Init(elementTypeSize, outArrayQueue->elementList);
+        outArrayQueue->elementArr->data   = NULL;
+        outArrayQueue->elementArr->length = 0;
     }
     else
     {
-        AArrayList->InitWithCapacity(elementTypeSize, capacity, outArrayQueue->elementList);
+        int length                        = GetPowerOf2(capacity);
+        outArrayQueue->elementArr->data   = malloc((size_t) (length * elementTypeSize));
+        outArrayQueue->elementArr->length = length;
+
+        ALog_A
+        (
+            outArrayQueue->elementArr->data != NULL,
+            "AArrayQueue InitWithCapacity failed, unable to malloc memory, size = %d, length = %d",
+            length * elementTypeSize, length
+        );
     }
-
-    outArrayQueue->topIndex = 0;
 }
 
 
@@ -103,7 +234,7 @@ static ArrayQueue* Create(int elementTypeSize)
 static void Clear(ArrayQueue* arrayQueue)
 {
     arrayQueue->topIndex = 0;
-    AArrayList->Clear(arrayQueue->elementList);
+    arrayQueue->size     = 0;
 }
 
 
@@ -117,6 +248,7 @@ struct AArrayQueue AArrayQueue[1] =
 
     Push,
     Pop,
+    GetAt,
     RemoveAt,
     Clear,
 }};
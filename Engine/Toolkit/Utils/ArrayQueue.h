@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-6-5
- * Update   : 2019-1-17
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -18,23 +18,34 @@
 #define ARRAY_QUEUE_H
 
 
-#include "Engine/Toolkit/Utils/ArrayList.h"
+#include "Engine/Toolkit/Utils/Array.h"
 
 
 /**
- * The queue implementation by array.
+ * The queue implementation by circular array.
+ * the capacity is power of 2, push and pop are O(1), and grow keeps the order of elements.
  */
 typedef struct
 {
     /**
-     * ArrayQueue top element index.
+     * The sizeof element type.
      */
-    int       topIndex;
+    int   elementTypeSize;
 
     /**
-     * Store all elements.
+     * The index of top element in elementArr.
      */
-    ArrayList elementList[1];
+    int   topIndex;
+
+    /**
+     * The count of elements in ArrayQueue.
+     */
+    int   size;
+
+    /**
+     * Store all elements, the length is 0 or power of 2.
+     */
+    Array elementArr[1];
 }
 ArrayQueue;
 
@@ -47,13 +58,16 @@ struct AArrayQueue
     ArrayQueue* (*Create)            (int elementTypeSize);
     void        (*Init)              (int elementTypeSize, ArrayQueue* outArrayQueue);
 
+    /**
+     * The capacity will be rounded up to power of 2.
+     */
     ArrayQueue* (*CreateWithCapacity)(int elementTypeSize, int capacity);
     void        (*InitWithCapacity)  (int elementTypeSize, int capacity, ArrayQueue* outArrayQueue);
 
     void        (*Release)           (ArrayQueue* arrayQueue);
 
     /**
-     * Push element from elementPtr into ArrayQueue.
+     * Push element from elementPtr into the tail of ArrayQueue.
      * elementPtr: point to element
      *
      * return elementPtr in ArrayQueue.
@@ -61,18 +75,24 @@ struct AArrayQueue
     void*       (*Push)              (ArrayQueue* arrayQueue, void* elementPtr);
 
     /**
-     * Pop element from ArrayQueue.
+     * Pop element from the top of ArrayQueue.
      * return top elementPtr in ArrayQueue, if no element return defaultElementPtr.
      */
     void*       (*Pop)               (ArrayQueue* arrayQueue, void* defaultElementPtr);
 
     /**
-     * Remove element at index that range in [topIndex, ArrayQueue size - 1].
+     * Get elementPtr at index that counts from the top, range in [0, ArrayQueue size - 1].
+     */
+    void*       (*GetAt)             (ArrayQueue* arrayQueue, int index);
+
+    /**
+     * Remove element at index that counts from the top, range in [0, ArrayQueue size - 1].
+     * the order of other elements is kept.
      */
-    void        (*RemoveAt)          (ArrayQueue* arrayQueue, int   index);
+    void        (*RemoveAt)          (ArrayQueue* arrayQueue, int index);
 
     /**
-     * Clear all elements, and reset topIndex to 0.
+     * Clear all elements, and reset size and topIndex to 0.
      */
     void        (*Clear)             (ArrayQueue* arrayQueue);
 };
@@ -89,13 +109,18 @@ extern struct AArrayQueue AArrayQueue[1];
 
 
 /**
- * Init constant ArrayQueue.
- * example: ArrayQueue queue[1] = AArrayQueue_Init(ElementType, increase)
+ * Init constant ArrayQueue, the memory space allocated when first push.
+ * example: ArrayQueue queue[1] = AArrayQueue_Init(ElementType)
  */
-#define AArrayQueue_Init(ElementType, increase)  \
-    {                                            \
-        0,                                       \
-        AArrayList_Init(ElementType, increase),  \
+#define AArrayQueue_Init(ElementType) \
+    {                                 \
+        sizeof(ElementType),          \
+        0,                            \
+        0,                            \
+        {                             \
+            NULL,                     \
+            0,                        \
+        },                            \
     }
 
 
@@ -138,4 +163,20 @@ extern struct AArrayQueue AArrayQueue[1];
     ((ElementType*) AArrayQueue->Pop(arrayQueue, &(defaultValue)))
 
 
+/**
+ * Shortcut of AArrayQueue->GetAt.
+ * return element.
+ */
+#define AArrayQueue_GetAt(arrayQueue, index, ElementType) \
+    (*(ElementType*) AArrayQueue->GetAt(arrayQueue, index))
+
+
+/**
+ * Shortcut of AArrayQueue->GetAt.
+ * return elementPtr.
+ */
+#define AArrayQueue_GetPtrAt(arrayQueue, index, ElementType) \
+    ((ElementType*) AArrayQueue->GetAt(arrayQueue, index))
+
+
 #endif
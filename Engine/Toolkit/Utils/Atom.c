@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <stddef.h>
+#include "Engine/Toolkit/Utils/Atom.h"
+#include "Engine/Toolkit/Utils/HashStrMap.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * The key is canonical string, the value is atom that equals the element index,
+ * no element will be removed, so the atom and key address never changed.
+ */
+static HashStrMap(str, int) atomMap[1] = AHashStrMap_Init(int, 128);
+
+
+static int Intern(const char* str)
+{
+    int* atomPtr = AHashStrMap_GetPtr(atomMap, str, int);
+
+    if (atomPtr == NULL)
+    {
+        int atom = atomMap->elementList->size;
+        AHashStrMap_TryPut(atomMap, str, atom);
+
+        return atom;
+    }
+
+    return *atomPtr;
+}
+
+
+static const char* InternStr(const char* str)
+{
+    return AHashStrMap->GetKey(atomMap, Intern(str));
+}
+
+
+static int Find(const char* str)
+{
+    return AHashStrMap->GetIndex(atomMap, str);
+}
+
+
+static const char* GetStr(int atom)
+{
+    ALog_A
+    (
+        atom >= 0 && atom < atomMap->elementList->size,
+        "AAtom GetStr atom = %d, count = %d, invalid",
+        atom,
+        atomMap->elementList->size
+    );
+
+    return AHashStrMap->GetKey(atomMap, atom);
+}
+
+
+static int GetCount(void)
+{
+    return atomMap->elementList->size;
+}
+
+
+struct AAtom AAtom[1] =
+{{
+    Intern,
+    InternStr,
+    Find,
+    GetStr,
+    GetCount,
+}};
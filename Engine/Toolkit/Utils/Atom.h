@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef ATOM_H
+#define ATOM_H
+
+
+/**
+ * Global string interning.
+ *
+ * each interned string has a stable atom (integer ID start from 0) and a canonical string,
+ * so the same strings always get the same atom and the same canonical string pointer,
+ * then the string compare can be replaced by integer or pointer compare.
+ *
+ * the canonical strings are never released until application exit, and not thread safe.
+ */
+struct AAtom
+{
+    /**
+     * Intern str, return the atom of str.
+     */
+    int         (*Intern)   (const char* str);
+
+    /**
+     * Intern str, return the canonical string of str.
+     */
+    const char* (*InternStr)(const char* str);
+
+    /**
+     * Find the atom of str, if str not interned return -1.
+     */
+    int         (*Find)     (const char* str);
+
+    /**
+     * Get canonical string by atom.
+     */
+    const char* (*GetStr)   (int atom);
+
+    /**
+     * Get the count of all atoms.
+     */
+    int         (*GetCount) (void);
+};
+
+
+extern struct AAtom AAtom[1];
+
+
+/**
+ * Intern str that may be NULL, the NULL str is atom -1.
+ */
+static inline int AAtom_InternNullable(const char* str)
+{
+    return str != NULL ? AAtom->Intern(str) : -1;
+}
+
+
+#endif
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-11-13
- * Update   : 2019-1-9
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -18,26 +18,31 @@
 #include "Engine/Toolkit/HeaderUtils/Define.h"
 #include "Engine/Toolkit/Utils/Coroutine.h"
 #include "Engine/Toolkit/Platform/Log.h"
+#include "Engine/Toolkit/Utils/Pool.h"
+
+
+static void OnCreateCoroutine(void* element)
+{
+    Coroutine* coroutine = element;
+    AArrayList->InitWithBuffer
+    (
+        sizeof(Coroutine*),
+        coroutine->waitsBuffer,
+        Coroutine_WaitsBufferLength,
+        coroutine->waits
+    );
+    coroutine->waits->increase = 4;
+}
 
 
 static ArrayList(Coroutine*) coroutineRunningList[1] = AArrayList_Init(Coroutine*, 25);
-static ArrayList(Coroutine*) coroutineCacheList  [1] = AArrayList_Init(Coroutine*, 25);
+static Pool     (Coroutine)  coroutinePool       [1] = APool_Init     (Coroutine,  25, OnCreateCoroutine, NULL);
 
 
 static Coroutine* StartCoroutine(CoroutineRun Run)
 {
-    Coroutine* coroutine = AArrayList_Pop(coroutineCacheList, Coroutine*);
-
-    if (coroutine == NULL)
-    {
-        coroutine = malloc(sizeof(Coroutine));
-        AArrayList->Init(sizeof(Coroutine*), coroutine->waits);
-        coroutine->waits->increase = 4;
-    }
-    else
-    {
-        AArrayList->Clear(coroutine->waits);
-    }
+    Coroutine* coroutine = APool_Get(coroutinePool, Coroutine);
+    AArrayList->Clear(coroutine->waits);
 
     coroutine->Run          = Run;
     coroutine->step         = 0;
@@ -71,8 +76,8 @@ static void Update(float deltaSeconds)
             {
                 AArrayList->RemoveByLast(coroutineRunningList, i);
 
-                // add to cache
-                AArrayList_Add(coroutineCacheList, coroutine);
+                // back to pool
+                APool->Free(coroutinePool, coroutine);
 
                 // set waiting coroutines execute forward
                 for (int j = 0; j < coroutine->waits->size; ++j)
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-11-13
- * Update   : 2019-18
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -73,6 +73,12 @@ CoroutineState;
  */
 typedef struct Coroutine Coroutine;
 
+
+/**
+ * The length of Coroutine waitsBuffer.
+ */
+#define Coroutine_WaitsBufferLength 4
+
 /**
  * A Coroutine running function.
  */
@@ -117,6 +123,11 @@ struct Coroutine
      * Store Coroutines that wait for this Coroutine to finish.
      */
     ArrayList(Coroutine*) waits [1];
+
+    /**
+     * The first Coroutines of waits store in it.
+     */
+    Coroutine*            waitsBuffer[Coroutine_WaitsBufferLength];
 };
 
 
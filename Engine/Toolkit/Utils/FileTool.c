@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2017-03-20
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -19,6 +19,7 @@
 #include "Engine/Toolkit/Math/Math.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Toolkit/Platform/File.h"
+#include "Engine/Toolkit/Utils/Pack.h"
 
 
 static int GetDirLength(const char* filePath)
@@ -88,34 +89,112 @@ static char* CreateStringFromAbsolute(const char* absoluteFilePath)
 }
 
 
-static void* CreateDataFromResource(const char* resourceFilePath, long* outSize)
+/**
+ * Read all data of resource file into the buffer with extraSize bytes,
+ * the buffer alloc from arena, or malloc if arena is NULL.
+ * the asset in mounted packs is read first.
+ */
+static char* ReadResource(const char* resourceFilePath, Arena* arena, int extraSize, long* outLength)
 {
-    File* file   = AFile->Open(resourceFilePath);
-    long  length = AFile->GetLength(file);
-    void* buffer = malloc((size_t) length);
-    *outSize     = length;
+    const PackAsset* asset = APack->Find(resourceFilePath);
+    File*            file  = NULL;
+    long             length;
+
+    if (asset != NULL)
+    {
+        length = asset->length;
+    }
+    else
+    {
+        file   = AFile->Open(resourceFilePath);
+        length = AFile->GetLength(file);
+    }
+
+    char* buffer = arena != NULL ?
+                   AArena->Alloc(arena, (int) length + extraSize) :
+                   malloc((size_t) length + extraSize);
+
+    if (asset != NULL)
+    {
+        APack->Read(asset, 0, buffer, (size_t) length);
+    }
+    else
+    {
+        AFile->Read (file, buffer, (size_t) length);
+        AFile->Close(file);
+    }
 
-    AFile->Read (file, buffer, (size_t) length);
-    AFile->Close(file);
+    *outLength = length;
 
     return buffer;
 }
 
 
+static void* CreateDataFromResource(const char* resourceFilePath, long* outSize)
+{
+    return ReadResource(resourceFilePath, NULL, 0, outSize);
+}
+
+
 static char* CreateStringFromResource(const char* resourceFilePath)
 {
-    File* file     = AFile->Open(resourceFilePath);
-    long  length   = AFile->GetLength(file);
-    char* buffer   = malloc((size_t) length + 1);
+    long  length;
+    char* buffer   = ReadResource(resourceFilePath, NULL, 1, &length);
     buffer[length] = '\0';
 
-    AFile->Read (file, buffer, (size_t) length);
-    AFile->Close(file);
+    return buffer;
+}
+
+
+static void* CreateDataFromResourceWithArena(const char* resourceFilePath, Arena* arena, long* outSize)
+{
+    return ReadResource(resourceFilePath, arena, 0, outSize);
+}
+
+
+static char* CreateStringFromResourceWithArena(const char* resourceFilePath, Arena* arena)
+{
+    long  length;
+    char* buffer   = ReadResource(resourceFilePath, arena, 1, &length);
+    buffer[length] = '\0';
 
     return buffer;
 }
 
 
+static void* CreateMappedDataFromResource(const char* resourceFilePath, FileMapping* outMapping)
+{
+    const PackAsset* asset    = APack->Find(resourceFilePath);
+    bool             isMapped = asset != NULL ?
+                                APack->Map(asset, outMapping) :
+                                AFile->Map(resourceFilePath, outMapping);
+
+    if (isMapped == false)
+    {
+        // the data of file that cannot be mapped is read into malloc buffer
+        outMapping->data       = ReadResource(resourceFilePath, NULL, 0, &outMapping->length);
+        outMapping->mapAddress = NULL;
+        outMapping->mapLength  = 0;
+    }
+
+    return outMapping->data;
+}
+
+
+static void ReleaseMappedData(FileMapping* mapping)
+{
+    if (mapping->mapAddress != NULL)
+    {
+        AFile->Unmap(mapping);
+    }
+    else
+    {
+        free(mapping->data);
+        mapping->data = NULL;
+    }
+}
+
+
 static void* CreateDataFromRelative(const char* relativeDirFilePath, long* outSize)
 {
     int         dirPathLength;
@@ -152,6 +231,10 @@ struct AFileTool AFileTool[1] =
 
     CreateDataFromResource,
     CreateStringFromResource,
+    CreateDataFromResourceWithArena,
+    CreateStringFromResourceWithArena,
+    CreateMappedDataFromResource,
+    ReleaseMappedData,
 
     CreateDataFromRelative,
     WriteDataToRelative,
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2017-03-20
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -20,6 +20,8 @@
 
 #include <stddef.h>
 #include <stdio.h>
+#include "Engine/Toolkit/Utils/Arena.h"
+#include "Engine/Toolkit/Platform/File.h"
 
 
 /**
@@ -31,7 +33,7 @@ struct AFileTool
      * Get file directory length in file path string, include last slash '/' or '\\'.
      * return 0 when no directory.
      */
-    int   (*GetDirLength)            (const char* filePath);
+    int   (*GetDirLength)                     (const char* filePath);
 
     /**
      * Read all file data into malloc buffer, and close file.
@@ -43,7 +45,7 @@ struct AFileTool
      * else
      *     return buffer ptr, and need to free it after using.
      */
-    void* (*CreateDataFromAbsolute)  (const char* absoluteFilePath, long* outSize);
+    void* (*CreateDataFromAbsolute)           (const char* absoluteFilePath, long* outSize);
 
     /**
      * Read all file data into malloc buffer, end with '\0', and close file.
@@ -53,10 +55,11 @@ struct AFileTool
      * else
      *     return buffer ptr, and need to free it after using.
      */
-    char* (*CreateStringFromAbsolute)(const char* absoluteFilePath);
+    char* (*CreateStringFromAbsolute)         (const char* absoluteFilePath);
 
     /**
      * Indirect use AFile, read all file data into malloc buffer, and close file.
+     * all the resource functions read the asset in mounted packs of APack first.
      *
      * outSize: the create data size.
      *
@@ -66,7 +69,7 @@ struct AFileTool
      *
      * return buffer ptr, and need to free it after using.
      */
-    void* (*CreateDataFromResource)  (const char* resourceFilePath, long* outSize);
+    void* (*CreateDataFromResource)           (const char* resourceFilePath, long* outSize);
 
     /**
      * Indirect use AFile, read all file data into malloc buffer, end with '\0', and close file.
@@ -77,7 +80,37 @@ struct AFileTool
      *
      * return buffer ptr, and need to free it after using.
      */
-    char* (*CreateStringFromResource)(const char* resourceFilePath);
+    char* (*CreateStringFromResource)         (const char* resourceFilePath);
+
+    /**
+     * Same as CreateDataFromResource, but the buffer alloc from arena, no need to free it.
+     */
+    void* (*CreateDataFromResourceWithArena)  (const char* resourceFilePath, Arena* arena, long* outSize);
+
+    /**
+     * Same as CreateStringFromResource, but the buffer alloc from arena, no need to free it.
+     */
+    char* (*CreateStringFromResourceWithArena)(const char* resourceFilePath, Arena* arena);
+
+    /**
+     * Map file data into memory by APack->Map or AFile->Map without copy,
+     * if the file cannot be mapped, the data will be read into malloc buffer.
+     * the data is private that can be modified in place, and the file will not be changed.
+     *
+     * outMapping: hold the data and length, need to ReleaseMappedData after using.
+     *
+     * resourceFilePath:
+     *     Android: assets
+     *     IOS    : NSBundle
+     *
+     * return the data ptr.
+     */
+    void* (*CreateMappedDataFromResource)     (const char* resourceFilePath, FileMapping* outMapping);
+
+    /**
+     * Unmap or free the data created by CreateMappedDataFromResource.
+     */
+    void  (*ReleaseMappedData)                (FileMapping* mapping);
 
     /**
      * Read all file data into malloc buffer, and close file.
@@ -94,7 +127,7 @@ struct AFileTool
      * else
      *     return buffer ptr, and need to free it after using.
      */
-    void* (*CreateDataFromRelative)  (const char* relativeFilePath, long* outSize);
+    void* (*CreateDataFromRelative)           (const char* relativeFilePath, long* outSize);
 
     /**
      * Write data into relativeDirFilePath, and close file.
@@ -109,7 +142,7 @@ struct AFileTool
      *
      * if file not exist will created.
      */
-     void (*WriteDataToRelative)     (const char* relativeFilePath, void* data, size_t size);
+     void (*WriteDataToRelative)              (const char* relativeFilePath, void* data, size_t size);
 };
 
 
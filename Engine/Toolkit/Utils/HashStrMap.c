@@ -0,0 +1,587 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <string.h>
+#include <stdlib.h>
+#include "Engine/Toolkit/Utils/HashStrMap.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+#define CheckIndex(tag)                                       \
+    ALog_A                                                    \
+    (                                                         \
+        index >= 0 && index < hashStrMap->elementList->size,  \
+        "AHashStrMap " tag " index = %d, size = %d, invalid", \
+        index,                                                \
+        hashStrMap->elementList->size                         \
+    )
+
+
+/**
+ * The length of first key block, and next block will be double until maxKeyBlockLength.
+ */
+static const int minKeyBlockLength = 64;
+
+
+/**
+ * The max length of key block, unless the key is longer than it.
+ */
+static const int maxKeyBlockLength = 4096;
+
+
+/**
+ * The min length of bucketArr.
+ */
+static const int minBucketLength   = 8;
+
+
+/**
+ * Get HashStrMapElement at index.
+ */
+#define GetElement(hashStrMap, index)                              \
+    ((HashStrMapElement*)                                          \
+     (                                                             \
+         (char*) (hashStrMap)->elementList->elementArr->data +     \
+         (hashStrMap)->elementList->elementTypeSize * (index)      \
+     ))
+
+
+/**
+ * Get valuePtr of HashStrMapElement.
+ */
+#define GetValuePtr(element) \
+    ((char*) (element) + AHashStrMap_ValueOffset)
+
+
+/**
+ * FNV-1a hash, and count the key length at the same time.
+ */
+static uint32_t GetHash(const char* key, int* outKeyLength)
+{
+    uint32_t    hash = 2166136261u;
+    const char* str  = key;
+
+    while (*str != '\0')
+    {
+        hash ^= (uint8_t) *str++;
+        hash *= 16777619u;
+    }
+
+    if (outKeyLength != NULL)
+    {
+        // include '\0'
+        *outKeyLength = (int) (str - key) + 1;
+    }
+
+    return hash;
+}
+
+
+/**
+ * Search the bucket index of key.
+ *
+ * if found key
+ *     return bucket index that holds the key element
+ * else
+ *     return -bucketIndex - 1, the bucketIndex is the empty slot for the key
+ *
+ * bucketArr must not empty.
+ */
+static inline int Search(HashStrMap* hashStrMap, const char* key, int keyLength, uint32_t hash)
+{
+    HashStrMapBucket* buckets = hashStrMap->bucketArr->data;
+    int               mask    = hashStrMap->bucketArr->length - 1;
+    int               index   = (int) (hash & (uint32_t) mask);
+
+    while (true)
+    {
+        HashStrMapBucket* bucket = buckets + index;
+
+        if (bucket->elementIndex == -1)
+        {
+            return -index - 1;
+        }
+
+        if (bucket->hash == hash)
+        {
+            HashStrMapElement* element = GetElement(hashStrMap, bucket->elementIndex);
+
+            if (element->keyLength == keyLength && memcmp(element->key, key, (size_t) keyLength) == 0)
+            {
+                return index;
+            }
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+
+/**
+ * Search the bucket index that holds elementIndex.
+ */
+static inline int SearchElementIndex(HashStrMap* hashStrMap, uint32_t hash, int elementIndex)
+{
+    HashStrMapBucket* buckets = hashStrMap->bucketArr->data;
+    int               mask    = hashStrMap->bucketArr->length - 1;
+    int               index   = (int) (hash & (uint32_t) mask);
+
+    while (buckets[index].elementIndex != elementIndex)
+    {
+        ALog_A(buckets[index].elementIndex != -1, "AHashStrMap SearchElementIndex not found %d", elementIndex);
+        index = (index + 1) & mask;
+    }
+
+    return index;
+}
+
+
+/**
+ * Realloc bucketArr with length, and put all elements again by cached hash.
+ */
+static void Rehash(HashStrMap* hashStrMap, int length)
+{
+    HashStrMapBucket* buckets = realloc(hashStrMap->bucketArr->data, sizeof(HashStrMapBucket) * length);
+    ALog_A(buckets != NULL, "AHashStrMap Rehash failed, unable to realloc memory, length = %d", length);
+
+    // set all elementIndex to -1
+    memset(buckets, -1, sizeof(HashStrMapBucket) * length);
+
+    hashStrMap->bucketArr->data   = buckets;
+    hashStrMap->bucketArr->length = length;
+
+    int mask = length - 1;
+
+    for (int i = 0; i < hashStrMap->elementList->size; ++i)
+    {
+        uint32_t hash  = GetElement(hashStrMap, i)->hash;
+        int      index = (int) (hash & (uint32_t) mask);
+
+        while (buckets[index].elementIndex != -1)
+        {
+            index = (index + 1) & mask;
+        }
+
+        buckets[index].hash         = hash;
+        buckets[index].elementIndex = i;
+    }
+}
+
+
+/**
+ * Make sure the bucketArr can hold count elements, keep load factor under 0.75.
+ */
+static inline void ReserveBuckets(HashStrMap* hashStrMap, int count)
+{
+    int length = hashStrMap->bucketArr->length;
+
+    if (count * 4 > length * 3)
+    {
+        if (length == 0)
+        {
+            length = minBucketLength;
+        }
+
+        while (count * 4 > length * 3)
+        {
+            length <<= 1;
+        }
+
+        Rehash(hashStrMap, length);
+    }
+}
+
+
+/**
+ * Get the size class of key, the key memory takes (8 << sizeClass) bytes.
+ */
+static inline int GetKeySizeClass(int keyLength)
+{
+    int sizeClass = 0;
+
+    while ((8 << sizeClass) < keyLength)
+    {
+        ++sizeClass;
+    }
+
+    ALog_A
+    (
+        sizeClass < HashStrMap_KeySizeClassCount,
+        "AHashStrMap GetKeySizeClass key length = %d too long",
+        keyLength
+    );
+
+    return sizeClass;
+}
+
+
+/**
+ * Copy key into the free memory of same size class or key block, return the copied key.
+ */
+static inline const char* CopyKey(HashStrMap* hashStrMap, const char* key, int keyLength)
+{
+    int   sizeClass = GetKeySizeClass(keyLength);
+    int   size      = 8 << sizeClass;
+    char* copy      = hashStrMap->keyFreeLists[sizeClass];
+
+    if (copy != NULL)
+    {
+        // the free memory stores the next free memory of same size class
+        hashStrMap->keyFreeLists[sizeClass] = *(char**) copy;
+        return memcpy(copy, key, (size_t) keyLength);
+    }
+
+    if (hashStrMap->keyBlockUsed + size > hashStrMap->keyBlockLength)
+    {
+        int length = hashStrMap->keyBlockLength == 0 ? minKeyBlockLength : hashStrMap->keyBlockLength * 2;
+
+        if (length > maxKeyBlockLength)
+        {
+            length = maxKeyBlockLength;
+        }
+
+        if (length < size)
+        {
+            length = size;
+        }
+
+        char* block = malloc((size_t) length);
+        ALog_A(block != NULL, "AHashStrMap CopyKey failed, unable to malloc memory, length = %d", length);
+
+        AArrayList_Add(hashStrMap->keyBlockList, block);
+        hashStrMap->keyBlockUsed   = 0;
+        hashStrMap->keyBlockLength = length;
+    }
+
+    copy = AArrayList_Get
+           (
+               hashStrMap->keyBlockList,
+               hashStrMap->keyBlockList->size - 1,
+               char*
+           ) + hashStrMap->keyBlockUsed;
+
+    hashStrMap->keyBlockUsed += size;
+
+    return memcpy(copy, key, (size_t) keyLength);
+}
+
+
+/**
+ * Give the key memory back to the free list of its size class.
+ */
+static inline void FreeKey(HashStrMap* hashStrMap, HashStrMapElement* element)
+{
+    int   sizeClass = GetKeySizeClass(element->keyLength);
+    char* key       = (char*) element->key;
+
+    *(char**) key                       = hashStrMap->keyFreeLists[sizeClass];
+    hashStrMap->keyFreeLists[sizeClass] = key;
+}
+
+
+/**
+ * Remove the element in bucket index, and fill the hole by backward shift,
+ * then move last element to the removed element index.
+ */
+static void RemoveBucket(HashStrMap* hashStrMap, int bucketIndex)
+{
+    HashStrMapBucket* buckets      = hashStrMap->bucketArr->data;
+    int               mask         = hashStrMap->bucketArr->length - 1;
+    int               elementIndex = buckets[bucketIndex].elementIndex;
+    int               hole         = bucketIndex;
+    int               index        = bucketIndex;
+
+    while (true)
+    {
+        index = (index + 1) & mask;
+
+        if (buckets[index].elementIndex == -1)
+        {
+            break;
+        }
+
+        int ideal = (int) (buckets[index].hash & (uint32_t) mask);
+
+        // the ideal slot is cyclically in (hole, index], so the bucket cannot move to hole
+        if (hole <= index ? (hole < ideal && ideal <= index) : (hole < ideal || ideal <= index))
+        {
+            continue;
+        }
+
+        buckets[hole] = buckets[index];
+        hole          = index;
+    }
+
+    buckets[hole].elementIndex = -1;
+
+    FreeKey(hashStrMap, GetElement(hashStrMap, elementIndex));
+
+    int lastIndex = hashStrMap->elementList->size - 1;
+
+    if (elementIndex != lastIndex)
+    {
+        HashStrMapElement* last = GetElement(hashStrMap, lastIndex);
+        buckets[SearchElementIndex(hashStrMap, last->hash, lastIndex)].elementIndex = elementIndex;
+    }
+
+    AArrayList->RemoveByLast(hashStrMap->elementList, elementIndex);
+
+    if (hashStrMap->elementList->size == 0)
+    {
+        // no key in use, so reuse the last key block
+        hashStrMap->keyBlockUsed = 0;
+        memset(hashStrMap->keyFreeLists, 0, sizeof(hashStrMap->keyFreeLists));
+    }
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static void* TryPut(HashStrMap* hashStrMap, const char* key, void* valuePtr)
+{
+    int      keyLength;
+    uint32_t hash = GetHash(key, &keyLength);
+
+    ReserveBuckets(hashStrMap, hashStrMap->elementList->size + 1);
+
+    int index = Search(hashStrMap, key, keyLength, hash);
+
+    if (index < 0)
+    {
+        HashStrMapBucket* bucket  = (HashStrMapBucket*) hashStrMap->bucketArr->data + (-index - 1);
+        bucket->hash              = hash;
+        bucket->elementIndex      = hashStrMap->elementList->size;
+
+        HashStrMapElement* element = AArrayList->GetAdd(hashStrMap->elementList);
+        element->key               = CopyKey(hashStrMap, key, keyLength);
+        element->keyLength         = keyLength;
+        element->hash              = hash;
+
+        return memcpy(GetValuePtr(element), valuePtr, (size_t) hashStrMap->valueTypeSize);
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+
+static int GetIndex(HashStrMap* hashStrMap, const char* key)
+{
+    if (hashStrMap->elementList->size == 0)
+    {
+        return -1;
+    }
+
+    int      keyLength;
+    uint32_t hash  = GetHash(key, &keyLength);
+    int      index = Search(hashStrMap, key, keyLength, hash);
+
+    return index >= 0 ? ((HashStrMapBucket*) hashStrMap->bucketArr->data)[index].elementIndex : -1;
+}
+
+
+static void* Get(HashStrMap* hashStrMap, const char* key, void* defaultValuePtr)
+{
+    int index = GetIndex(hashStrMap, key);
+    return index >= 0 ? GetValuePtr(GetElement(hashStrMap, index)) : defaultValuePtr;
+}
+
+
+static void* TrySet(HashStrMap* hashStrMap, const char* key, void* valuePtr)
+{
+    int index = GetIndex(hashStrMap, key);
+
+    if (index >= 0)
+    {
+        return memcpy
+               (
+                   GetValuePtr(GetElement(hashStrMap, index)),
+                   valuePtr,
+                   (size_t) hashStrMap->valueTypeSize
+               );
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+
+static bool TryRemove(HashStrMap* hashStrMap, const char* key)
+{
+    if (hashStrMap->elementList->size == 0)
+    {
+        return false;
+    }
+
+    int      keyLength;
+    uint32_t hash  = GetHash(key, &keyLength);
+    int      index = Search(hashStrMap, key, keyLength, hash);
+
+    if (index >= 0)
+    {
+        RemoveBucket(hashStrMap, index);
+        return true;
+    }
+
+    return false;
+}
+
+
+static void Clear(HashStrMap* hashStrMap)
+{
+    for (int i = 0; i < hashStrMap->keyBlockList->size; ++i)
+    {
+        free(AArrayList_Get(hashStrMap->keyBlockList, i, char*));
+    }
+
+    AArrayList->Clear(hashStrMap->keyBlockList);
+    AArrayList->Clear(hashStrMap->elementList);
+
+    hashStrMap->keyBlockUsed   = 0;
+    hashStrMap->keyBlockLength = 0;
+    memset(hashStrMap->keyFreeLists, 0, sizeof(hashStrMap->keyFreeLists));
+
+    if (hashStrMap->bucketArr->data != NULL)
+    {
+        memset(hashStrMap->bucketArr->data, -1, sizeof(HashStrMapBucket) * hashStrMap->bucketArr->length);
+    }
+}
+
+
+static const char* GetKey(HashStrMap* hashStrMap, int index)
+{
+    CheckIndex("GetKey");
+    return GetElement(hashStrMap, index)->key;
+}
+
+
+static void* GetAt(HashStrMap* hashStrMap, int index)
+{
+    CheckIndex("GetAt");
+    return GetValuePtr(GetElement(hashStrMap, index));
+}
+
+
+static void* SetAt(HashStrMap* hashStrMap, int index, void* valuePtr)
+{
+    CheckIndex("SetAt");
+
+    return memcpy
+           (
+               GetValuePtr(GetElement(hashStrMap, index)),
+               valuePtr,
+               (size_t) hashStrMap->valueTypeSize
+           );
+}
+
+
+static void RemoveAt(HashStrMap* hashStrMap, int index)
+{
+    CheckIndex("RemoveAt");
+    RemoveBucket(hashStrMap, SearchElementIndex(hashStrMap, GetElement(hashStrMap, index)->hash, index));
+}
+
+
+static void Release(HashStrMap* hashStrMap)
+{
+    Clear(hashStrMap);
+
+    AArrayList->Release(hashStrMap->keyBlockList);
+    AArrayList->Release(hashStrMap->elementList);
+
+    free(hashStrMap->bucketArr->data);
+    hashStrMap->bucketArr->data   = NULL;
+    hashStrMap->bucketArr->length = 0;
+}
+
+
+static void InitWithCapacity(int valueTypeSize, int capacity, HashStrMap* outHashStrMap)
+{
+    int elementTypeSize = AHashStrMap_GetElementSize(valueTypeSize);
+
+    if (capacity == 0)
+    {
+        AArrayList->Init(elementTypeSize, outHashStrMap->elementList);
+    }
+    else
+    {
+        AArrayList->InitWithCapacity(elementTypeSize, capacity, outHashStrMap->elementList);
+    }
+
+    AArrayList->Init(sizeof(char*), outHashStrMap->keyBlockList);
+    outHashStrMap->keyBlockList->increase = 4;
+
+    outHashStrMap->valueTypeSize     = valueTypeSize;
+    outHashStrMap->keyBlockUsed      = 0;
+    outHashStrMap->keyBlockLength    = 0;
+    outHashStrMap->bucketArr->data   = NULL;
+    outHashStrMap->bucketArr->length = 0;
+    memset(outHashStrMap->keyFreeLists, 0, sizeof(outHashStrMap->keyFreeLists));
+
+    ReserveBuckets(outHashStrMap, capacity);
+}
+
+
+static HashStrMap* CreateWithCapacity(int valueTypeSize, int capacity)
+{
+    HashStrMap* hashStrMap = malloc(sizeof(HashStrMap));
+    InitWithCapacity(valueTypeSize, capacity, hashStrMap);
+
+    return hashStrMap;
+}
+
+
+static void Init(int valueTypeSize, HashStrMap* outHashStrMap)
+{
+    InitWithCapacity(valueTypeSize, 0, outHashStrMap);
+}
+
+
+static HashStrMap* Create(int valueTypeSize)
+{
+    return CreateWithCapacity(valueTypeSize, 0);
+}
+
+
+struct AHashStrMap AHashStrMap[1] =
+{{
+    Create,
+    Init,
+    CreateWithCapacity,
+    InitWithCapacity,
+
+    Release,
+
+    TryPut,
+    Get,
+    TrySet,
+    TryRemove,
+    Clear,
+    GetIndex,
+    GetKey,
+    GetAt,
+    SetAt,
+    RemoveAt,
+    GetHash,
+}};
+
+
+#undef CheckIndex
+#undef GetElement
+#undef GetValuePtr
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef HASH_STR_MAP_H
+#define HASH_STR_MAP_H
+
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "Engine/Toolkit/Utils/ArrayList.h"
+
+
+/**
+ * The element header store in HashStrMap elementList, the value data follows it inline.
+ */
+typedef struct
+{
+    /**
+     * HashStrMap value's key.
+     * the key data copy into HashStrMap key block, and the address never changed until removed, Clear or Release.
+     * the memory of removed key is reused by the next put key of the same size class.
+     */
+    const char* key;
+
+    /**
+     * The length of key, include '\0'.
+     */
+    int         keyLength;
+
+    /**
+     * The cached hash of key.
+     */
+    uint32_t    hash;
+}
+HashStrMapElement;
+
+
+/**
+ * The count of HashStrMap key size classes, the size of class i is (8 << i) bytes.
+ */
+#define HashStrMap_KeySizeClassCount 13
+
+
+/**
+ * One slot of HashStrMap open addressing table.
+ */
+typedef struct
+{
+    /**
+     * The cached hash of key, compare it before compare the key string.
+     */
+    uint32_t hash;
+
+    /**
+     * The index of element in elementList, -1 means empty slot.
+     */
+    int      elementIndex;
+}
+HashStrMapBucket;
+
+
+/**
+ * A hash table of elements each of which is a k-v pair.
+ * the elements are stored flat in elementList without per-element malloc,
+ * and the order of elements is the put order until any element removed.
+ */
+typedef struct
+{
+    /**
+     * The sizeof HashStrMap value type.
+     */
+    int                          valueTypeSize;
+
+    /**
+     * Store all elements, each one is HashStrMapElement header with value data.
+     * if increase capacity, elements will realloc, so the valuePtr may changed after put.
+     */
+    ArrayList(HashStrMapElement) elementList[1];
+
+    /**
+     * Open addressing table, the length is power of 2.
+     */
+    Array(HashStrMapBucket)      bucketArr  [1];
+
+    /**
+     * Memory blocks store all keys.
+     */
+    ArrayList(char*)             keyBlockList[1];
+
+    /**
+     * The used bytes of last key block.
+     */
+    int                          keyBlockUsed;
+
+    /**
+     * The length of last key block.
+     */
+    int                          keyBlockLength;
+
+    /**
+     * The linked lists of removed key memory, one list for each key size class.
+     */
+    char*                        keyFreeLists[HashStrMap_KeySizeClassCount];
+}
+HashStrMap;
+
+
+/**
+ * Control HashStrMap.
+ */
+struct AHashStrMap
+{
+    HashStrMap* (*Create)            (int valueTypeSize);
+    void        (*Init)              (int valueTypeSize, HashStrMap* outHashStrMap);
+
+    HashStrMap* (*CreateWithCapacity)(int valueTypeSize, int capacity);
+    void        (*InitWithCapacity)  (int valueTypeSize, int capacity, HashStrMap* outHashStrMap);
+
+    void        (*Release)           (HashStrMap* hashStrMap);
+
+    /**
+     * Try put key and value of valuePtr into HashStrMap.
+     *
+     * valuePtr: point to value.
+     *
+     * if key not exist in HashStrMap
+     *     return valuePtr in HashStrMap
+     * else
+     *     return NULL
+     */
+    void*       (*TryPut)            (HashStrMap* hashStrMap, const char* key, void* valuePtr);
+
+    /**
+     * Get valuePtr by key, if no key found return defaultValuePtr.
+     */
+    void*       (*Get)               (HashStrMap* hashStrMap, const char* key, void* defaultValuePtr);
+
+    /**
+     * Try set new value of valuePtr to element by key.
+     *
+     * if key exist in HashStrMap
+     *     return valuePtr in HashStrMap
+     * else
+     *     return NULL
+     */
+    void*       (*TrySet)            (HashStrMap* hashStrMap, const char* key, void* valuePtr);
+
+    /**
+     * Remove element by key, the last element will be moved to the removed index.
+     * return true success, false failed.
+     */
+    bool        (*TryRemove)         (HashStrMap* hashStrMap, const char* key);
+
+    /**
+     * Clear all elements and keys, reset size to 0, and keep elements and table memory space.
+     */
+    void        (*Clear)             (HashStrMap* hashStrMap);
+
+    /**
+     * Get index of key, if not found return -1.
+     */
+    int         (*GetIndex)          (HashStrMap* hashStrMap, const char* key);
+
+    /**
+     * Get key at index.
+     */
+    const char* (*GetKey)            (HashStrMap* hashStrMap, int index);
+
+    /**
+     * Get valuePtr at index.
+     */
+    void*       (*GetAt)             (HashStrMap* hashStrMap, int index);
+
+    /**
+     * Set value of valuePtr at index.
+     * return valuePtr in HashStrMap.
+     */
+    void*       (*SetAt)             (HashStrMap* hashStrMap, int index, void* valuePtr);
+
+    /**
+     * Remove element at index, the last element will be moved to the index.
+     */
+    void        (*RemoveAt)          (HashStrMap* hashStrMap, int index);
+
+    /**
+     * Get the hash of key, and set the length of key (include '\0') into outKeyLength if not NULL.
+     */
+    uint32_t    (*GetHash)           (const char* key, int* outKeyLength);
+};
+
+
+extern struct AHashStrMap AHashStrMap[1];
+
+
+/**
+ * The offset of value data from HashStrMapElement header, keep value 8 bytes aligned.
+ */
+#define AHashStrMap_ValueOffset \
+    ((int) ((sizeof(HashStrMapElement) + 7) & ~(size_t) 7))
+
+
+/**
+ * The size of one element in HashStrMap elementList.
+ */
+#define AHashStrMap_GetElementSize(valueTypeSize) \
+    ((AHashStrMap_ValueOffset + (int) (valueTypeSize) + 7) & ~7)
+
+
+/**
+ * Get key by valuePtr in HashStrMap.
+ */
+static inline const char* AHashStrMap_GetKey(void* valuePtr)
+{
+    return ((HashStrMapElement*) ((char*) valuePtr - AHashStrMap_ValueOffset))->key;
+}
+
+
+/**
+ * Marked HashStrMap key and value.
+ */
+#define HashStrMap(keyName, ValueType) HashStrMap
+
+
+/**
+ * Init constant HashStrMap.
+ * the element with value is sized by char array, so the elementList is same as AArrayList_Init.
+ * example: HashStrMap map[1] = AHashStrMap_Init(ValueType, increase)
+ */
+#define AHashStrMap_Init(ValueType, increase)                                           \
+    {                                                                                   \
+        sizeof(ValueType),                                                              \
+        AArrayList_Init(char[AHashStrMap_GetElementSize(sizeof(ValueType))], increase), \
+        {                                                                               \
+            NULL,                                                                       \
+            0,                                                                          \
+        },                                                                              \
+        AArrayList_Init(char*, 4),                                                      \
+        0,                                                                              \
+        0,                                                                              \
+        {                                                                               \
+            NULL,                                                                       \
+        },                                                                              \
+    }
+
+
+/**
+ * Shortcut of AHashStrMap->TryPut.
+ */
+#define AHashStrMap_TryPut(hashStrMap, key, value) \
+    AHashStrMap->TryPut(hashStrMap, key, &(value))
+
+
+/**
+ * Shortcut of AHashStrMap->Get.
+ * return value.
+ */
+#define AHashStrMap_Get(hashStrMap, key, ValueType) \
+    (*(ValueType*) AHashStrMap->Get(hashStrMap, key, NULL_PTR))
+
+
+/**
+ * Shortcut of AHashStrMap->Get.
+ * return valuePtr.
+ */
+#define AHashStrMap_GetPtr(hashStrMap, key, ValueType) \
+    ((ValueType*) AHashStrMap->Get(hashStrMap, key, NULL))
+
+
+/**
+ * Shortcut of AHashStrMap->TrySet.
+ */
+#define AHashStrMap_TrySet(hashStrMap, key, value) \
+    AHashStrMap->TrySet(hashStrMap, key, &(value))
+
+
+/**
+ * Shortcut of AHashStrMap->GetAt.
+ * return value.
+ */
+#define AHashStrMap_GetAt(hashStrMap, index, ValueType) \
+    (*(ValueType*) AHashStrMap->GetAt(hashStrMap, index))
+
+
+/**
+ * Shortcut of AHashStrMap->GetAt.
+ * return valuePtr.
+ */
+#define AHashStrMap_GetPtrAt(hashStrMap, index, ValueType) \
+    ((ValueType*) AHashStrMap->GetAt(hashStrMap, index))
+
+
+/**
+ * Shortcut of AHashStrMap->SetAt.
+ */
+#define AHashStrMap_SetAt(hashStrMap, index, value) \
+    AHashStrMap->SetAt(hashStrMap, index, &(value))
+
+
+#endif
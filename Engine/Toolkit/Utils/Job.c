@@ -0,0 +1,600 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "Engine/Toolkit/Utils/Job.h"
+#include "Engine/Toolkit/Utils/Pool.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * The Jobs of one thread, the owner pushes and pops at the bottom, others steal from the top.
+ */
+typedef struct
+{
+    pthread_mutex_t mutex[1];
+
+    /**
+     * Circular array of Jobs, the length is power of 2.
+     */
+    Job**           jobArr;
+    int             length;
+    int             topIndex;
+    int             size;
+}
+JobDeque;
+
+
+/**
+ * The first length of JobDeque jobArr.
+ */
+static const int       dequeLength       = 64;
+
+
+/**
+ * Guard the Job states, jobPool, pendingCount and waitingCount.
+ */
+static pthread_mutex_t jobMutex    [1]   = {PTHREAD_MUTEX_INITIALIZER};
+static pthread_cond_t  workCond    [1]   = {PTHREAD_COND_INITIALIZER};
+static pthread_cond_t  completeCond[1]   = {PTHREAD_COND_INITIALIZER};
+static Pool(Job)       jobPool     [1]   = APool_Init(Job, 64, NULL, NULL);
+
+
+/**
+ * The deques of workers, and the last one shared by non-worker threads.
+ */
+static JobDeque*       dequeArr          = NULL;
+static pthread_t*      threadArr         = NULL;
+static int             workerCount       = 0;
+
+
+/**
+ * The count of Jobs in all deques.
+ */
+static int             pendingCount      = 0;
+
+
+/**
+ * The count of threads waiting in Wait.
+ */
+static int             waitingCount      = 0;
+
+
+/**
+ * The count of Push, Wait checks it to know whether new Job pushed after it found nothing to run.
+ */
+static uint32_t        pushCount         = 0;
+
+
+static bool            isQuit            = false;
+static bool            isInit            = false;
+
+
+/**
+ * Store the worker index + 1 of worker thread, non-worker thread is NULL.
+ */
+static pthread_key_t   workerKey;
+
+
+static inline int GetSelfIndex()
+{
+    intptr_t index = (intptr_t) pthread_getspecific(workerKey);
+    return index == 0 ? workerCount : (int) index - 1;
+}
+
+
+static void PushBottom(JobDeque* deque, Job* job)
+{
+    pthread_mutex_lock(deque->mutex);
+
+    if (deque->size == deque->length)
+    {
+        int   oldLength = deque->length;
+        Job** jobArr    = realloc(deque->jobArr, sizeof(Job*) * (size_t) (oldLength << 1));
+
+        ALog_A(jobArr != NULL, "AJob PushBottom failed, unable to realloc memory, length = %d", oldLength << 1);
+
+        // move the wrapped Jobs after the old tail
+        int wrapCount = deque->topIndex + deque->size - oldLength;
+
+        if (wrapCount > 0)
+        {
+            memcpy(jobArr + oldLength, jobArr, sizeof(Job*) * (size_t) wrapCount);
+        }
+
+        deque->jobArr = jobArr;
+        deque->length = oldLength << 1;
+    }
+
+    deque->jobArr[(deque->topIndex + deque->size) & (deque->length - 1)] = job;
+    ++deque->size;
+
+    pthread_mutex_unlock(deque->mutex);
+}
+
+
+static Job* PopBottom(JobDeque* deque)
+{
+    Job* job = NULL;
+
+    pthread_mutex_lock(deque->mutex);
+
+    if (deque->size > 0)
+    {
+        --deque->size;
+        job = deque->jobArr[(deque->topIndex + deque->size) & (deque->length - 1)];
+    }
+
+    pthread_mutex_unlock(deque->mutex);
+
+    return job;
+}
+
+
+static Job* StealTop(JobDeque* deque)
+{
+    Job* job = NULL;
+
+    pthread_mutex_lock(deque->mutex);
+
+    if (deque->size > 0)
+    {
+        job             = deque->jobArr[deque->topIndex];
+        deque->topIndex = (deque->topIndex + 1) & (deque->length - 1);
+        --deque->size;
+    }
+
+    pthread_mutex_unlock(deque->mutex);
+
+    return job;
+}
+
+
+/**
+ * Create Job in jobPool, must be called in jobMutex.
+ */
+static inline Job* CreateJob(JobRun Run, JobRunRange RunRange, void* param)
+{
+    Job* job               = APool_Get(jobPool, Job);
+    job->Run               = Run;
+    job->RunRange          = RunRange;
+    job->param             = param;
+    job->fromIndex         = 0;
+    job->toIndex           = 0;
+    job->parent            = NULL;
+    job->unfinishedCount   = 1;
+    job->isDetached        = false;
+    job->continuationCount = 0;
+
+    return job;
+}
+
+
+static void Push(Job* job)
+{
+    PushBottom(dequeArr + GetSelfIndex(), job);
+
+    pthread_mutex_lock(jobMutex);
+    ++pendingCount;
+    ++pushCount;
+    pthread_cond_signal(workCond);
+
+    if (waitingCount > 0)
+    {
+        // waiting threads can help to run Job
+        pthread_cond_broadcast(completeCond);
+    }
+
+    pthread_mutex_unlock(jobMutex);
+}
+
+
+/**
+ * Pop own Job first, if no Job then steal from others.
+ */
+static Job* TryGetJob(int selfIndex)
+{
+    Job* job = PopBottom(dequeArr + selfIndex);
+
+    if (job == NULL)
+    {
+        int dequeCount = workerCount + 1;
+
+        for (int i = 1; i < dequeCount; ++i)
+        {
+            job = StealTop(dequeArr + (selfIndex + i) % dequeCount);
+
+            if (job != NULL)
+            {
+                break;
+            }
+        }
+
+        if (job == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    pthread_mutex_lock(jobMutex);
+    --pendingCount;
+    pthread_mutex_unlock(jobMutex);
+
+    return job;
+}
+
+
+static void Finish(Job* job)
+{
+    Job* continuationArr[Job_ContinuationMax];
+    int  continuationCount = 0;
+    Job* parent            = NULL;
+
+    pthread_mutex_lock(jobMutex);
+
+    if (--job->unfinishedCount == 0)
+    {
+        parent            = job->parent;
+        continuationCount = job->continuationCount;
+
+        memcpy(continuationArr, job->continuationArr, sizeof(Job*) * (size_t) continuationCount);
+        job->continuationCount = 0;
+
+        if (job->isDetached)
+        {
+            APool->Free(jobPool, job);
+        }
+
+        if (waitingCount > 0)
+        {
+            pthread_cond_broadcast(completeCond);
+        }
+    }
+
+    pthread_mutex_unlock(jobMutex);
+
+    for (int i = 0; i < continuationCount; ++i)
+    {
+        Push(continuationArr[i]);
+    }
+
+    if (parent != NULL)
+    {
+        Finish(parent);
+    }
+}
+
+
+static void Execute(Job* job)
+{
+    if (job->Run != NULL)
+    {
+        job->Run(job->param);
+    }
+    else if (job->RunRange != NULL)
+    {
+        job->RunRange(job->fromIndex, job->toIndex, job->param);
+    }
+
+    Finish(job);
+}
+
+
+static void* WorkerRun(void* param)
+{
+    int selfIndex = (int) (intptr_t) param;
+    pthread_setspecific(workerKey, (void*) (intptr_t) (selfIndex + 1));
+
+    while (true)
+    {
+        Job* job = TryGetJob(selfIndex);
+
+        if (job != NULL)
+        {
+            Execute(job);
+            continue;
+        }
+
+        pthread_mutex_lock(jobMutex);
+
+        while (pendingCount <= 0 && isQuit == false)
+        {
+            pthread_cond_wait(workCond, jobMutex);
+        }
+
+        bool isExit = isQuit && pendingCount <= 0;
+
+        pthread_mutex_unlock(jobMutex);
+
+        if (isExit)
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+
+static void Init(int count)
+{
+    ALog_A(isInit == false, "AJob Init already called");
+
+    if (count <= 0)
+    {
+        count = (int) sysconf(_SC_NPROCESSORS_ONLN) - 1;
+
+        if (count < 1)
+        {
+            count = 1;
+        }
+    }
+
+    pthread_key_create(&workerKey, NULL);
+
+    workerCount  = count;
+    pendingCount = 0;
+    waitingCount = 0;
+    isQuit       = false;
+    isInit       = true;
+    dequeArr     = malloc(sizeof(JobDeque) * (size_t) (count + 1));
+    threadArr    = malloc(sizeof(pthread_t) * (size_t) (count + 1));
+
+    for (int i = 0; i <= count; ++i)
+    {
+        JobDeque* deque = dequeArr + i;
+        pthread_mutex_init(deque->mutex, NULL);
+        deque->jobArr   = malloc(sizeof(Job*) * (size_t) dequeLength);
+        deque->length   = dequeLength;
+        deque->topIndex = 0;
+        deque->size     = 0;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        int resultID = pthread_create(threadArr + i, NULL, WorkerRun, (void*) (intptr_t) i);
+        ALog_A(resultID == 0, "AJob Init failed, pthread_create error id = %d", resultID);
+    }
+
+    ALog_D("AJob Init workerCount = %d", count);
+}
+
+
+static void Release()
+{
+    ALog_A(isInit, "AJob Release without Init");
+
+    Job* job;
+
+    // run the remaining Jobs, if no worker thread they only run here
+    while ((job = TryGetJob(GetSelfIndex())) != NULL)
+    {
+        Execute(job);
+    }
+
+    pthread_mutex_lock(jobMutex);
+    isQuit = true;
+    pthread_cond_broadcast(workCond);
+    pthread_mutex_unlock(jobMutex);
+
+    for (int i = 0; i < workerCount; ++i)
+    {
+        pthread_join(threadArr[i], NULL);
+    }
+
+    for (int i = 0; i <= workerCount; ++i)
+    {
+        pthread_mutex_destroy(dequeArr[i].mutex);
+        free(dequeArr[i].jobArr);
+    }
+
+    free(dequeArr);
+    free(threadArr);
+    pthread_key_delete(workerKey);
+    APool->Release(jobPool);
+
+    dequeArr    = NULL;
+    threadArr   = NULL;
+    workerCount = 0;
+    isInit      = false;
+}
+
+
+static Job* Run(JobRun Run, void* param)
+{
+    ALog_A(isInit, "AJob Run without Init");
+
+    pthread_mutex_lock(jobMutex);
+    Job* job = CreateJob(Run, NULL, param);
+    pthread_mutex_unlock(jobMutex);
+
+    Push(job);
+
+    return job;
+}
+
+
+static Job* Then(Job* job, JobRun Run, void* param)
+{
+    bool isPush = false;
+
+    pthread_mutex_lock(jobMutex);
+
+    Job* continuation = CreateJob(Run, NULL, param);
+
+    if (job->unfinishedCount == 0)
+    {
+        isPush = true;
+    }
+    else
+    {
+        ALog_A
+        (
+            job->continuationCount < Job_ContinuationMax,
+            "AJob Then continuation count cannot more than %d",
+            Job_ContinuationMax
+        );
+
+        job->continuationArr[job->continuationCount++] = continuation;
+    }
+
+    pthread_mutex_unlock(jobMutex);
+
+    if (isPush)
+    {
+        Push(continuation);
+    }
+
+    return continuation;
+}
+
+
+static void Wait(Job* job)
+{
+    int selfIndex = GetSelfIndex();
+
+    pthread_mutex_lock(jobMutex);
+
+    while (job->unfinishedCount > 0)
+    {
+        uint32_t lastPushCount = pushCount;
+
+        pthread_mutex_unlock(jobMutex);
+        Job* other = TryGetJob(selfIndex);
+
+        if (other != NULL)
+        {
+            Execute(other);
+            pthread_mutex_lock(jobMutex);
+            continue;
+        }
+
+        pthread_mutex_lock(jobMutex);
+
+        // nothing to run, even if pendingCount > 0 while the stealing thread has not counted it down,
+        // so sleep until a Job finished or pushed, and the Push before here retries
+        if (job->unfinishedCount > 0 && pushCount == lastPushCount)
+        {
+            ++waitingCount;
+            pthread_cond_wait(completeCond, jobMutex);
+            --waitingCount;
+        }
+    }
+
+    APool->Free(jobPool, job);
+
+    pthread_mutex_unlock(jobMutex);
+}
+
+
+static void Detach(Job* job)
+{
+    pthread_mutex_lock(jobMutex);
+
+    if (job->unfinishedCount == 0)
+    {
+        APool->Free(jobPool, job);
+    }
+    else
+    {
+        job->isDetached = true;
+    }
+
+    pthread_mutex_unlock(jobMutex);
+}
+
+
+static bool IsComplete(Job* job)
+{
+    pthread_mutex_lock(jobMutex);
+    bool isComplete = job->unfinishedCount == 0;
+    pthread_mutex_unlock(jobMutex);
+
+    return isComplete;
+}
+
+
+static void ParallelFor(int count, int batchSize, JobRunRange RunRange, void* param)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    if (batchSize <= 0)
+    {
+        // one range for each thread
+        batchSize = (count + workerCount) / (workerCount + 1);
+    }
+
+    if (workerCount == 0 || count <= batchSize)
+    {
+        RunRange(0, count, param);
+        return;
+    }
+
+    pthread_mutex_lock(jobMutex);
+    Job* root = CreateJob(NULL, NULL, NULL);
+    pthread_mutex_unlock(jobMutex);
+
+    // the first range runs on current thread
+    for (int fromIndex = batchSize; fromIndex < count; fromIndex += batchSize)
+    {
+        pthread_mutex_lock(jobMutex);
+
+        Job* child        = CreateJob(NULL, RunRange, param);
+        child->fromIndex  = fromIndex;
+        child->toIndex    = fromIndex + batchSize < count ? fromIndex + batchSize : count;
+        child->parent     = root;
+        child->isDetached = true;
+        ++root->unfinishedCount;
+
+        pthread_mutex_unlock(jobMutex);
+
+        Push(child);
+    }
+
+    RunRange(0, batchSize, param);
+
+    // finish the root self
+    Finish(root);
+    Wait  (root);
+}
+
+
+static int GetWorkerCount()
+{
+    return workerCount;
+}
+
+
+struct AJob AJob[1] =
+{{
+    Init,
+    Release,
+    Run,
+    Then,
+    Wait,
+    Detach,
+    IsComplete,
+    ParallelFor,
+    GetWorkerCount,
+}};
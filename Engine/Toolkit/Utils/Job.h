@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef JOB_H
+#define JOB_H
+
+
+#include <stdbool.h>
+
+
+/**
+ * Job running function.
+ */
+typedef void (*JobRun)     (void* param);
+
+
+/**
+ * ParallelFor running function, run the indexes in range [fromIndex, toIndex).
+ */
+typedef void (*JobRunRange)(int fromIndex, int toIndex, void* param);
+
+
+/**
+ * The max count of continuations on one Job.
+ */
+#define Job_ContinuationMax 8
+
+
+/**
+ * The work unit run by worker threads.
+ */
+typedef struct Job Job;
+struct  Job
+{
+    JobRun      Run;
+    JobRunRange RunRange;
+    void*       param;
+
+    /**
+     * The index range of RunRange.
+     */
+    int         fromIndex;
+    int         toIndex;
+
+    /**
+     * The Job wait for this Job's completion, can be NULL.
+     */
+    Job*        parent;
+
+    /**
+     * Self and unfinished children count, 0 means Job completed.
+     */
+    int         unfinishedCount;
+
+    /**
+     * If true Job will be released when completed, else released by Wait.
+     */
+    bool        isDetached;
+
+    /**
+     * The Jobs push to run after this Job completed.
+     */
+    Job*        continuationArr[Job_ContinuationMax];
+    int         continuationCount;
+};
+
+
+/**
+ * Manage the worker threads pool that run Jobs.
+ * each worker has a deque that pops own Jobs in LIFO and steals others' Jobs in FIFO,
+ * and the thread waiting for a Job runs other Jobs until the Job completed.
+ */
+struct AJob
+{
+    /**
+     * Start worker threads, if workerCount <= 0 will be the cores count - 1 and at least 1.
+     */
+    void  (*Init)          (int workerCount);
+
+    /**
+     * Wait all Jobs completed and stop worker threads.
+     */
+    void  (*Release)       (void);
+
+    /**
+     * Push a Job to run, the returned Job must be passed to Wait or Detach.
+     */
+    Job*  (*Run)           (JobRun Run, void* param);
+
+    /**
+     * Create a Job that runs after job completed, the returned Job must be passed to Wait or Detach.
+     * if job has already completed, the continuation will be pushed to run immediately.
+     */
+    Job*  (*Then)          (Job* job, JobRun Run, void* param);
+
+    /**
+     * Run other Jobs until job completed, then release job.
+     * if no Job to run, it sleeps until any Job completed or pushed.
+     */
+    void  (*Wait)          (Job* job);
+
+    /**
+     * Release job when it completed, no need to Wait.
+     */
+    void  (*Detach)        (Job* job);
+
+    /**
+     * Whether job has completed.
+     */
+    bool  (*IsComplete)    (Job* job);
+
+    /**
+     * Split [0, count) into ranges of batchSize, and run RunRange on worker threads and current thread,
+     * return until all ranges completed.
+     */
+    void  (*ParallelFor)   (int count, int batchSize, JobRunRange RunRange, void* param);
+
+    /**
+     * Get the count of worker threads.
+     */
+    int   (*GetWorkerCount)(void);
+};
+
+
+extern struct AJob AJob[1];
+
+
+#endif
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-5-29
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -17,110 +17,136 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #include "Engine/Toolkit/Utils/Json.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Toolkit/Utils/FileTool.h"
+#include "Engine/Toolkit/Utils/Arena.h"
+#include "Engine/Toolkit/Utils/JsonReader.h"
 
 
-//----------------------------------------------------------------------------------------------------------------------
+/**
+ * The root JsonValue and the arena that holds the whole json tree.
+ */
+typedef struct
+{
+    /**
+     * The first member, so the root JsonValue ptr is the JsonDocument ptr.
+     */
+    JsonValue   root   [1];
+    Arena       arena  [1];
+
+    /**
+     * The mapped json file data that strings are unescaped in place,
+     * the data is NULL when json is copied into arena.
+     */
+    FileMapping mapping[1];
+}
+JsonDocument;
 
 
 /**
- * If the JsonValue is JsonType_Array,  then free each items and do recursively.
- * if the JsonValue is JsonType_Object, then free each K-V   and do recursively.
+ * The reader of json tokens, and the temporary stacks for collecting values of parsing JsonArray and JsonObject,
+ * the collected values are copied into arena with exact count when JsonArray or JsonObject is done.
  */
-static void Destroy(JsonValue* value)
+typedef struct
 {
-    // JsonValue hold the whole memory
-    // so free JsonValue will be release JsonValue's memory
+    Arena*                arena;
+    JsonReader*           reader;
+    ArrayList(JsonValue)  valueStack[1];
+    ArrayList(JsonPair)   pairStack [1];
+}
+JsonParser;
 
-    switch (value->type)
-    {
-        case JsonType_Array:
-        {
-            ArrayList* list = value->jsonArray->valueList;
-            for (int i = 0; i < list->size; ++i)
-            {
-                Destroy(AArrayList_Get(list, i, JsonValue*));
-            }
 
-            AArrayList->Release(list);
-            break;
-        }
+/**
+ * The bytes of arena block for each byte of json string,
+ * make the whole json tree can be allocated in one block usually.
+ */
+#define JsonDocument_ArenaScale 3
 
-        case JsonType_Object:
-        {
-            ArrayStrMap* map = value->jsonObject->valueMap;
-            for (int i = 0; i < map->elementList->size; ++i)
-            {
-                Destroy(AArrayStrMap_GetAt(map, i, JsonValue*));
-            }
 
-            AArrayStrMap->Release(map);
-            break;
-        }
-            
-        case JsonType_Float:
-            break;
-            
-        case JsonType_String:
-            break;
-            
-        case JsonType_Null:
-            break;
-    }
+/**
+ * The capacity of JsonParser stack buffers.
+ */
+#define JsonParser_StackBufferLength 64
 
-    free(value);
-}
 
+//----------------------------------------------------------------------------------------------------------------------
 
-static JsonValue* CreateJsonValue(void* data, size_t valueSize, JsonType type)
+
+static void Destroy(JsonValue* value)
 {
-    JsonValue* value = malloc(sizeof(JsonValue) + valueSize);
+    JsonDocument* document = (JsonDocument*) value;
+    Arena         arena  [1];
+    FileMapping   mapping[1];
 
-    switch (type)
+    // the JsonDocument is in arena memory, so copy the arena and mapping out of it before release
+    *arena   = *document->arena;
+    *mapping = *document->mapping;
+
+    AArena->Release(arena);
+
+    if (mapping->data != NULL)
     {
-        case JsonType_Float:
-            break;
+        AFileTool->ReleaseMappedData(mapping);
+    }
+}
 
-        case JsonType_String:
-            value->jsonString = memcpy((char*) value + sizeof(JsonValue), data, valueSize);
-            break;
 
-        case JsonType_Array:
-            value->jsonArray = (JsonArray*) ((char*) value + sizeof(JsonValue));
-            AArrayList->Init(sizeof(JsonValue*), value->jsonArray->valueList);
-            break;
+//----------------------------------------------------------------------------------------------------------------------
 
-        case JsonType_Object:
-            value->jsonObject = (JsonObject*) ((char*) value + sizeof(JsonValue));
-            AArrayStrMap->Init(sizeof(JsonValue*), value->jsonObject->valueMap);
-            break;
 
-        default:
-            ALog_A(false, "CreateJsonValue unknown JsonType = %d", type);
+static JsonValue* GetValue(JsonObject* object, const char* key)
+{
+    JsonPair* pairs = object->pairArr->data;
+
+    if (object->bucketArr->length == 0)
+    {
+        for (int i = 0; i < object->pairArr->length; ++i)
+        {
+            if (strcmp(pairs[i].key, key) == 0)
+            {
+                return &pairs[i].value;
+            }
+        }
+
+        return NULL;
     }
 
-    value->type = type;
+    HashStrMapBucket* buckets = object->bucketArr->data;
+    uint32_t          hash    = AHashStrMap->GetHash(key, NULL);
+    int               mask    = object->bucketArr->length - 1;
 
-    return value;
-}
+    // the table is never full, so there is always an empty bucket to end the probing
+    for (int i = (int) (hash & (uint32_t) mask);; i = (i + 1) & mask)
+    {
+        HashStrMapBucket* bucket = buckets + i;
 
+        if (bucket->elementIndex == -1)
+        {
+            return NULL;
+        }
 
-//----------------------------------------------------------------------------------------------------------------------
+        if (bucket->hash == hash && strcmp(pairs[bucket->elementIndex].key, key) == 0)
+        {
+            return &pairs[bucket->elementIndex].value;
+        }
+    }
+}
 
 
 static bool ObjectGetBool(JsonObject* object, const char* key, bool defaultValue)
 {
-    JsonValue* jsonValue = AArrayStrMap_Get(object->valueMap, key, JsonValue*);
+    JsonValue* jsonValue = GetValue(object, key);
     return jsonValue != NULL ? strcmp(jsonValue->jsonString, "true") == 0 : defaultValue;
 }
 
 
 static int ObjectGetInt(JsonObject* object, const char* key, int defaultValue)
 {
-    JsonValue* jsonValue = AArrayStrMap_Get(object->valueMap, key, JsonValue*);
+    JsonValue* jsonValue = GetValue(object, key);
     
     if (jsonValue != NULL)
     {
@@ -133,7 +159,7 @@ static int ObjectGetInt(JsonObject* object, const char* key, int defaultValue)
 
 static float ObjectGetFloat(JsonObject* object, const char* key, float defaultValue)
 {
-    JsonValue* jsonValue = AArrayStrMap_Get(object->valueMap, key, JsonValue*);
+    JsonValue* jsonValue = GetValue(object, key);
     
     if (jsonValue != NULL)
     {
@@ -146,28 +172,28 @@ static float ObjectGetFloat(JsonObject* object, const char* key, float defaultVa
 
 static char* ObjectGetString(JsonObject* object, const char* key, const char* defaultValue)
 {
-    JsonValue* jsonValue = AArrayStrMap_Get(object->valueMap, key, JsonValue*);
+    JsonValue* jsonValue = GetValue(object, key);
     return jsonValue != NULL ? jsonValue->jsonString : (char*) defaultValue;
 }
 
 
 static JsonObject* ObjectGetObject(JsonObject* object, const char* key)
 {
-    JsonValue* jsonValue = AArrayStrMap_Get(object->valueMap, key, JsonValue*);
+    JsonValue* jsonValue = GetValue(object, key);
     return jsonValue != NULL ? jsonValue->jsonObject : NULL;
 }
 
 
 static JsonArray* ObjectGetArray(JsonObject* object, const char* key)
 {
-    JsonValue* jsonValue = AArrayStrMap_Get(object->valueMap, key, JsonValue*);
+    JsonValue* jsonValue = GetValue(object, key);
     return jsonValue != NULL ? jsonValue->jsonArray : NULL;
 }
 
 
 static JsonType ObjectGetType(JsonObject* object, const char* key)
 {
-    JsonValue* jsonValue = AArrayStrMap_Get(object->valueMap, key, JsonValue*);
+    JsonValue* jsonValue = GetValue(object, key);
 
     if (jsonValue == NULL)
     {
@@ -180,19 +206,19 @@ static JsonType ObjectGetType(JsonObject* object, const char* key)
 
 static const char* ObjectGetKey(JsonObject* object, int index)
 {
-    return AArrayStrMap->GetKey(object->valueMap, index);
+    return AArray_Get(object->pairArr, index, JsonPair).key;
 }
 
 
 static JsonObject* ObjectGetObjectByIndex(JsonObject* object, int index)
 {
-    return AArrayStrMap_GetAt(object->valueMap, index, JsonValue*)->jsonObject;
+    return AArray_Get(object->pairArr, index, JsonPair).value.jsonObject;
 }
 
 
 static JsonArray* ObjectGetArrayByIndex(JsonObject* object, int index)
 {
-    return AArrayStrMap_GetAt(object->valueMap, index, JsonValue*)->jsonArray;
+    return AArray_Get(object->pairArr, index, JsonPair).value.jsonArray;
 }
 
 
@@ -216,47 +242,47 @@ struct AJsonObject AJsonObject[1] =
 
 static bool ArrayGetBool(JsonArray* array, int index)
 {
-    return strcmp(AArrayList_Get(array->valueList, index, JsonValue*)->jsonString, "true") == 0;
+    return strcmp(AArray_Get(array->valueArr, index, JsonValue).jsonString, "true") == 0;
 }
 
 
 static int ArrayGetInt(JsonArray* array, int index)
 {
-    return (int) AArrayList_Get(array->valueList, index, JsonValue*)->jsonFloat;
+    return (int) AArray_Get(array->valueArr, index, JsonValue).jsonFloat;
 }
 
 static float ArrayGetFloat(JsonArray* array, int index)
 {
-    return AArrayList_Get(array->valueList, index, JsonValue*)->jsonFloat;
+    return AArray_Get(array->valueArr, index, JsonValue).jsonFloat;
 }
 
 
 static char* ArrayGetString(JsonArray* array, int index)
 {
-    return AArrayList_Get(array->valueList, index, JsonValue*)->jsonString;
+    return AArray_Get(array->valueArr, index, JsonValue).jsonString;
 }
 
 
 static JsonObject* ArrayGetObject(JsonArray* array, int index)
 {
-    return AArrayList_Get(array->valueList, index, JsonValue*)->jsonObject;
+    return AArray_Get(array->valueArr, index, JsonValue).jsonObject;
 }
 
 
 static JsonArray* ArrayGetArray(JsonArray* array, int index)
 {
-    return AArrayList_Get(array->valueList, index, JsonValue*)->jsonArray;
+    return AArray_Get(array->valueArr, index, JsonValue).jsonArray;
 }
 
 
 static JsonType ArrayGetType(JsonArray* array, int index)
 {
-    if (index < 0 || index >= array->valueList->size)
+    if (index < 0 || index >= array->valueArr->length)
     {
         return JsonType_Null;
     }
     
-    return AArrayList_Get(array->valueList, index, JsonValue*)->type;
+    return AArray_Get(array->valueArr, index, JsonValue).type;
 }
 
 
@@ -275,320 +301,278 @@ struct AJsonArray AJsonArray[1] =
 //----------------------------------------------------------------------------------------------------------------------
 
 
-static inline void SkipWhiteSpace(const char** jsonPtr)
+// predefine
+static void ParseValue(JsonParser* parser, JsonValue* outValue);
+
+
+static void ParseArray(JsonParser* parser, JsonValue* outValue)
 {
-    const char* json = *jsonPtr;
+    ArrayList* stack = parser->valueStack;
+    int        start = stack->size;
 
-    while (true)
+    ALog_D("Json Array: [");
+
+    while (AJsonReader->Next(parser->reader) != JsonToken_ArrayEnd)
     {
-        switch (*json)
-        {
-            case ' ' :
-            case '\t':
-            case '\n':
-            case '\r':
-                ++json;
-                continue;
-            default:
-                break;
-        }
-        break;
+        // the nested values may realloc the stack, so parse into local value
+        JsonValue value[1];
+        ParseValue(parser, value);
+        AArrayList_Add(stack, *value);
     }
 
-    ALog_A(json != NULL, "The Json parse error on NULL, json is incomplete.");
-    
-    *jsonPtr = json;
-}
-
+    int        count = stack->size - start;
+    JsonArray* array = AArena->Alloc(parser->arena, (int) (sizeof(JsonArray) + sizeof(JsonValue) * count));
 
-static void* ParseNumber(const char** jsonPtr)
-{
-    char* endPtr;
+    array->valueArr->data   = (char*) array + sizeof(JsonArray);
+    array->valueArr->length = count;
+    memcpy(array->valueArr->data, AArrayList_GetPtr(stack, start, JsonValue), sizeof(JsonValue) * count);
 
-    JsonValue* value = CreateJsonValue(NULL, 0, JsonType_Float);
-    value->jsonFloat = strtof(*jsonPtr, &endPtr);
+    // pop values of this array
+    stack->size = start;
 
-    ALog_D("Json number = %.*s", (int) (endPtr - *jsonPtr), *jsonPtr);
-    
-    *jsonPtr = endPtr;
+    outValue->type      = JsonType_Array;
+    outValue->jsonArray = array;
 
-    return value;
+    ALog_D("] JsonArray element count = %d", count);
 }
 
 
-static int SkipString(const char** jsonPtr, const char** outStrStart)
+static void ParseObject(JsonParser* parser, JsonValue* outValue)
 {
-    // skip '"'
-    const char* json  = ++(*jsonPtr);
-    int         count = 0;
-    char        c;
-
-    // check end '"'
-    while ((c = json[count++]) != '"')
-    {
-        if (c == '\\')
-        {
-            // skip escaped quotes
-            // the escape char may be '\"'，which will break while
-            ++count;
-        }
-    }
+    ArrayList* stack = parser->pairStack;
+    int        start = stack->size;
 
-    *outStrStart = json;
-    
-    // already skipped the string end '"'
-    *jsonPtr    += count;
+    ALog_D("Json Object: {");
 
-    // how many char skipped
-    // count contains the string end '"', so -1
-    return count - 1;
-}
+    while (AJsonReader->Next(parser->reader) != JsonToken_ObjectEnd)
+    {
+        JsonPair pair[1];
+        // the key string is in the arena, so it is valid with json tree
+        pair->key = parser->reader->string;
+        ALog_D("Json key = %s", pair->key);
 
+        AJsonReader->Next(parser->reader);
 
-static JsonValue* ParseString(const char** jsonPtr)
-{
-    const char* strStart;
-    int         length        = SkipString(jsonPtr, &strStart);
-    JsonValue*  value         = CreateJsonValue((void*) strStart, (length + 1) * sizeof(char), JsonType_String);
-    value->jsonString[length] = '\0';
+        // the nested values may realloc the stack, so parse into local pair
+        ParseValue(parser, &pair->value);
+        AArrayList_Add(stack, *pair);
+    }
 
-    ALog_D("Json string = %s", value->jsonString);
+    int count       = stack->size - start;
+    int bucketCount = 0;
 
-    return value;
-}
+    if (count > JsonObject_LinearSearchMax)
+    {
+        // power of 2 and keep the load factor not more than 0.5
+        bucketCount = JsonObject_LinearSearchMax * 2;
 
+        while (bucketCount < count * 2)
+        {
+            bucketCount <<= 1;
+        }
+    }
 
-// predefine
-static JsonValue* ParseValue(const char** jsonPtr);
+    JsonObject* object = AArena->Alloc
+                         (
+                             parser->arena,
+                             (int) (sizeof(JsonObject) + sizeof(JsonPair) * count + sizeof(HashStrMapBucket) * bucketCount)
+                         );
 
+    JsonPair* pairs           = (JsonPair*) ((char*) object + sizeof(JsonObject));
+    object->pairArr->data     = pairs;
+    object->pairArr->length   = count;
+    object->bucketArr->data   = pairs + count;
+    object->bucketArr->length = bucketCount;
 
-static JsonValue* ParseArray(const char** jsonPtr)
-{
-    JsonValue* jsonValue = CreateJsonValue(NULL, sizeof(JsonArray), JsonType_Array);
-    ArrayList* list      = jsonValue->jsonArray->valueList;
+    memcpy(pairs, AArrayList_GetPtr(stack, start, JsonPair), sizeof(JsonPair) * count);
 
-    ALog_D("Json Array: [");
-    
-    // skip '['
-    ++(*jsonPtr);
+    // pop pairs of this object
+    stack->size = start;
 
-    do
+    if (bucketCount > 0)
     {
-        SkipWhiteSpace(jsonPtr);
+        HashStrMapBucket* buckets = object->bucketArr->data;
+        int               mask    = bucketCount - 1;
 
-        if (**jsonPtr == ']')
+        for (int i = 0; i < bucketCount; ++i)
         {
-            break;
+            buckets[i].elementIndex = -1;
         }
 
-        JsonValue* value = ParseValue(jsonPtr);
-        // add Array element
-        AArrayList_Add(list, value);
-         
-        SkipWhiteSpace(jsonPtr);
-
-        if (**jsonPtr == ',')
-        {
-            ++(*jsonPtr);
-        }
-        else
+        // the pairs are put in json order, so the first one of same keys will be found
+        for (int i = 0; i < count; ++i)
         {
-            ALog_A(**jsonPtr == ']', "Json Array not has ']', error char = %c ", **jsonPtr);
-            break;
+            uint32_t hash  = AHashStrMap->GetHash(pairs[i].key, NULL);
+            int      index = (int) (hash & (uint32_t) mask);
+
+            while (buckets[index].elementIndex != -1)
+            {
+                index = (index + 1) & mask;
+            }
+
+            buckets[index].hash         = hash;
+            buckets[index].elementIndex = i;
         }
     }
-    while (true);
 
-    // skip ']'
-    ++(*jsonPtr);
-    ALog_D("] JsonArray element count = %d", list->size);
-    
-    return jsonValue;
+    outValue->type       = JsonType_Object;
+    outValue->jsonObject = object;
+
+    ALog_D("} JsonObject elements count = %d", count);
 }
 
 
-static JsonValue* ParseObject(const char** jsonPtr)
+/**
+ * Parse the value of current reader token.
+ */
+static void ParseValue(JsonParser* parser, JsonValue* outValue)
 {
-    JsonValue*   jsonValue = CreateJsonValue(NULL, sizeof(JsonObject), JsonType_Object);
-    ArrayStrMap* map       = jsonValue->jsonObject->valueMap;
-
-    ALog_D("Json Object: {");
-    
-    // skip '{'
-    ++(*jsonPtr);
+    JsonReader* reader = parser->reader;
 
-    do
+    switch (reader->token)
     {
-        SkipWhiteSpace(jsonPtr);
-
-        if (**jsonPtr == '}')
-        {
-            break;
-        }
-        
-        ALog_A(**jsonPtr == '"', "Json object parse error, char = %c, should be '\"' ", **jsonPtr);
-
-        const char* strStart;
-        int         keyLen = SkipString(jsonPtr, &strStart);
-        char        key[keyLen];
-        // make string end
-        key[keyLen] = '\0';
+        case JsonToken_ObjectStart:
+            ParseObject(parser, outValue);
+            return;
+
+        case JsonToken_ArrayStart:
+            ParseArray(parser, outValue);
+            return;
+
+        case JsonToken_String:
+            outValue->type       = JsonType_String;
+            outValue->jsonString = reader->string;
+            ALog_D("Json string = %s", outValue->jsonString);
+            return;
+
+        case JsonToken_Float:
+            outValue->type      = JsonType_Float;
+            outValue->jsonFloat = reader->number;
+            return;
+
+        case JsonToken_True:
+            outValue->type       = JsonType_String;
+            outValue->jsonString = (char*) "true";
+            return;
+
+        case JsonToken_False:
+            outValue->type       = JsonType_String;
+            outValue->jsonString = (char*) "false";
+            return;
+
+        case JsonToken_Null:
+            outValue->type       = JsonType_String;
+            outValue->jsonString = (char*) "null";
+            return;
 
-        memcpy(key, strStart, (size_t) keyLen);
-        ALog_D("Json key = %s", key);
-
-        SkipWhiteSpace(jsonPtr);
-        ALog_A((**jsonPtr) == ':', "Json object parse error, char = %c, should be ':' ", **jsonPtr);
-
-        // skip ':'
-        ++(*jsonPtr);
-        JsonValue* value = ParseValue(jsonPtr);
-        
-        // set object element
-        AArrayStrMap_TryPut(map, key, value);
-
-        SkipWhiteSpace(jsonPtr);
-
-        if (**jsonPtr == ',')
-        {
-            ++(*jsonPtr);
-        }
-        else
-        {
-            ALog_A(**jsonPtr == '}', "Json Object not has '}', error char = %c ", **jsonPtr);
+        default:
             break;
-        }
     }
-    while (true);
-
-    // skip '}'
-    ++(*jsonPtr);
-    ALog_D("} JsonObject elements count = %d", map->elementList->size);
 
-    return jsonValue;
+    ALog_A(false, "Invalid json value, JsonToken = %d", reader->token);
 }
 
 
 /**
- * ParseValue changed the *jsonPtr, so if *jsonPtr is direct malloc will cause error
+ * Create JsonDocument with arena that enough for the json tree of jsonLength usually,
+ * and the extraSize bytes for json copy.
  */
-static JsonValue* ParseValue(const char** jsonPtr)
+static JsonDocument* CreateDocument(int jsonLength, int extraSize)
 {
-    SkipWhiteSpace(jsonPtr);
+    Arena arena[1];
+    AArena->Init
+    (
+        jsonLength * JsonDocument_ArenaScale + extraSize + (int) sizeof(JsonDocument) + AArena_Alignment * 2,
+        arena
+    );
+
+    JsonDocument* document  = AArena->Alloc(arena, sizeof(JsonDocument));
+    *document->arena        = *arena;
+    document->mapping->data = NULL;
+
+    return document;
+}
 
-    char c = **jsonPtr;
 
-    switch (c)
-    {
-        case '{':
-            return ParseObject(jsonPtr);
-
-        case '[':
-            return ParseArray(jsonPtr);
-
-        case '"':
-            return ParseString(jsonPtr);
-
-        case '0':
-        case '1':
-        case '2':
-        case '3':
-        case '4':
-        case '5':
-        case '6':
-        case '7':
-        case '8':
-        case '9':
-        case '-':
-            return ParseNumber(jsonPtr);
-
-        case 'f':
-        {
-            const char* json = *jsonPtr;
-
-            if
-            (
-                json[1] == 'a' &&
-                json[2] == 'l' &&
-                json[3] == 's' &&
-                json[4] == 'e'
-            )
-            {
-                ALog_D("Json false");
+/**
+ * Parse json into document arena, the json must be valid until document destroyed.
+ */
+static JsonValue* ParseDocument(JsonDocument* document, char* json, int length)
+{
+    JsonParser parser[1];
+    JsonReader reader[1];
+    JsonValue  valueBuffer[JsonParser_StackBufferLength];
+    JsonPair   pairBuffer [JsonParser_StackBufferLength];
 
-                (*jsonPtr) += 5;
+    parser->arena  = document->arena;
+    parser->reader = reader;
+    AArrayList->InitWithBuffer(sizeof(JsonValue), valueBuffer, JsonParser_StackBufferLength, parser->valueStack);
+    AArrayList->InitWithBuffer(sizeof(JsonPair),  pairBuffer,  JsonParser_StackBufferLength, parser->pairStack);
+    AJsonReader->InitWithBuffer(json, length, reader);
 
-                // copy with '\0'
-                return CreateJsonValue("false", 6, JsonType_String);
-            }
-            break;
-        }
+    AJsonReader->Next(reader);
+    ParseValue(parser, document->root);
 
-        case 't':
-        {
-            const char* json = *jsonPtr;
-
-            if
-            (
-                json[1] == 'r' &&
-                json[2] == 'u' &&
-                json[3] == 'e'
-            )
-            {
-                ALog_D("Json true");
+    AJsonReader->Release(reader);
+    AArrayList->Release(parser->valueStack);
+    AArrayList->Release(parser->pairStack);
 
-                (*jsonPtr) += 4;
+    return document->root;
+}
 
-                // copy with '\0'
-                return CreateJsonValue("true", 5, JsonType_String);
-            }
-            break;
-        }
 
-        case 'n':
-        {
-            const char* json = *jsonPtr;
-
-            if
-            (
-                json[1] == 'u' &&
-                json[2] == 'l' &&
-                json[3] == 'l'
-            )
-            {
-                ALog_D("Json null");
+static JsonValue* Parse(const char* jsonString)
+{
+    int           length   = (int) strlen(jsonString);
+    JsonDocument* document = CreateDocument(length, length + AArena_Alignment);
+    char*         json     = AArena->Alloc(document->arena, length);
 
-                (*jsonPtr) += 4;
+    memcpy(json, jsonString, (size_t) length);
 
-                // copy with '\0'
-                return CreateJsonValue("null", 5, JsonType_String);
-            }
-            break;
-        }
+    return ParseDocument(document, json, length);
+}
 
-        default:
-            break;
-    }
 
-    ALog_A(false, "Invalid json value type, error char = %c", c);
+static JsonValue* ParseMapping(FileMapping* mapping)
+{
+    char* json   = mapping->data;
+    int   length = (int) mapping->length;
 
-    return NULL;
+    // the strings point into the mapped data, so the document holds the mapping
+    JsonDocument* document = CreateDocument(length, 0);
+    *document->mapping     = *mapping;
+    mapping->data          = NULL;
+
+    return ParseDocument(document, json, length);
 }
 
 
-static JsonValue* Parse(const char* jsonString)
+static JsonValue* ParseFile(const char* jsonFilePath)
 {
-    return ParseValue(&jsonString);
+    FileMapping mapping[1];
+    AFileTool->CreateMappedDataFromResource(jsonFilePath, mapping);
+
+    return ParseMapping(mapping);
 }
 
 
-static JsonValue* ParseFile(const char* jsonFilePath)
+static long GetBytes(JsonValue* value)
 {
-    char*        jsonString = AFileTool->CreateStringFromResource(jsonFilePath);
-    JsonValue*   value      = Parse(jsonString);
-    free(jsonString);
+    JsonDocument* document = (JsonDocument*) value;
+    Arena*        arena    = document->arena;
+    long          bytes    = arena->used;
+
+    for (int i = 0; i < arena->blockIndex; ++i)
+    {
+        bytes += AArrayList_Get(arena->blockList, i, ArenaBlock).size;
+    }
+
+    if (document->mapping->data != NULL)
+    {
+        bytes += (long) document->mapping->length;
+    }
 
-    return value;
+    return bytes;
 }
 
 
@@ -596,5 +580,7 @@ struct AJson AJson[1] =
 {{
     Parse,
     ParseFile,
+    ParseMapping,
     Destroy,
+    GetBytes,
 }};
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-1-26
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -18,8 +18,9 @@
 #define JSON_H
 
 
-#include "Engine/Toolkit/Utils/ArrayStrMap.h"
-#include "Engine/Toolkit/Utils/ArrayList.h"
+#include "Engine/Toolkit/Utils/HashStrMap.h"
+#include "Engine/Toolkit/Utils/Array.h"
+#include "Engine/Toolkit/Platform/File.h"
 
 
 /**
@@ -36,24 +37,8 @@ typedef enum
 JsonType;
 
 
-/**
- * For json object that contains a set of k-v pairs.
- */
-typedef struct
-{
-   ArrayStrMap(objectKey, JsonValue*) valueMap[1];
-}
-JsonObject;
-
-
-/**
- * For json array that contains a list of json value.
- */
-typedef struct
-{
-   ArrayList(JsonValue*) valueList[1];
-}
-JsonArray;
+typedef struct JsonObject JsonObject;
+typedef struct JsonArray  JsonArray;
 
 
 /**
@@ -89,6 +74,55 @@ typedef struct
 JsonValue;
 
 
+/**
+ * One k-v pair of JsonObject.
+ */
+typedef struct
+{
+    /**
+     * The key string unescaped in place inside the json source buffer.
+     */
+    const char* key;
+    JsonValue   value;
+}
+JsonPair;
+
+
+/**
+ * For json object that contains a set of k-v pairs.
+ * the pairs are stored flat in json order, and the memory is in the arena of root JsonValue.
+ *
+ * the keys iterate by index in json order, not sorted by key as before,
+ * so the code that depends on sorted keys needs to sort them itself.
+ */
+struct JsonObject
+{
+    Array(JsonPair)         pairArr  [1];
+
+    /**
+     * The open addressing table of pairArr for finding key, the length is power of 2.
+     * it is empty when the pairs count not more than JsonObject_LinearSearchMax.
+     */
+    Array(HashStrMapBucket) bucketArr[1];
+};
+
+
+/**
+ * The max pairs count of JsonObject that find key by linear search.
+ */
+#define JsonObject_LinearSearchMax 8
+
+
+/**
+ * For json array that contains a list of json value.
+ * the values are stored flat, and the memory is in the arena of root JsonValue.
+ */
+struct JsonArray
+{
+   Array(JsonValue) valueArr[1];
+};
+
+
 /**
  * Get different types of values from JsonObject.
  */
@@ -100,7 +134,8 @@ struct AJsonObject
     JsonType    (*GetType)         (JsonObject* object, const char* key);
 
     /**
-     * When JsonValue released the string value will be freed.
+     * The string is in the arena of root JsonValue, and it is valid until AJson->Destroy the root JsonValue.
+     * if not found key then return defaultValue.
      */
     char*       (*GetString)       (JsonObject* object, const char* key, const char* defaultValue);
 
@@ -115,7 +150,7 @@ struct AJsonObject
     JsonArray*  (*GetArray)        (JsonObject* object, const char* key);
 
     /**
-     * Get JsonObject's key.
+     * Get JsonObject's key by index in json order, the key is in the arena same as GetString.
      */
     const char* (*GetKey)          (JsonObject* object, int index);
 
@@ -145,7 +180,7 @@ struct AJsonArray
     JsonType    (*GetType)  (JsonArray* array, int index);
 
     /**
-     * When JsonValue released the string value will be freed.
+     * The string is in the arena of root JsonValue, and it is valid until AJson->Destroy the root JsonValue.
      */
     char*       (*GetString)(JsonArray* array, int index);
     JsonObject* (*GetObject)(JsonArray* array, int index);
@@ -164,6 +199,9 @@ struct AJson
 {
     /**
      * Parse the Json string, return root JsonValue.
+     *
+     * the whole json tree is allocated from one arena owned by root JsonValue,
+     * and jsonString is copied into the arena that the strings unescaped in place.
      */
     JsonValue* (*Parse)    (const char* jsonString);
 
@@ -177,12 +215,25 @@ struct AJson
     JsonValue* (*ParseFile)(const char* jsonFilePath);
 
     /**
-     * Destroy JsonValue member memory space and free itself,
-     * if Destroy root JsonValue will free all memory space.
+     * Parse the Json file data mapped by AFileTool->CreateMappedDataFromResource, return root JsonValue.
+     * the mapping is held and released by root JsonValue, and it is cleared after calling.
+     */
+    JsonValue* (*ParseMapping)(FileMapping* mapping);
+
+    /**
+     * Free the arena of root JsonValue, that releases all memory space of the json tree at once.
      *
-     * important: after Destroy the jsonValue will be invalidated.
+     * important: only the root JsonValue returned by Parse, ParseFile or ParseMapping can be destroyed,
+     *            and after Destroy all JsonValues and strings of the tree will be invalidated.
      */
     void       (*Destroy)  (JsonValue* jsonValue);
+
+    /**
+     * Get the memory bytes of json tree, include the mapped json file.
+     *
+     * important: only the root JsonValue returned by Parse, ParseFile or ParseMapping can be used.
+     */
+    long       (*GetBytes) (JsonValue* jsonValue);
 };
 
 
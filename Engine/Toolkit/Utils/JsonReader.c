@@ -0,0 +1,978 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define JSON_READER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define JSON_READER_NEON
+#endif
+
+#include "Engine/Toolkit/Utils/JsonReader.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * The bytes of one block scanned by SIMD.
+ */
+#define JsonReader_BlockSize 16
+
+
+/**
+ * The bytes of the number copy on stack, when the number is at the end of buffer data.
+ */
+#define JsonReader_NumberBufferLength 64
+
+
+/**
+ * Whether the reader reads json from file or pack asset incrementally.
+ */
+static inline bool IsReadFile(JsonReader* reader)
+{
+    return reader->file != NULL || reader->packStream->asset != NULL;
+}
+
+
+/**
+ * Make at least count bytes of data after position in buffer,
+ * the data before position will be dropped when read file.
+ *
+ * return the count of available bytes after position, may less than count when no more data.
+ */
+static int Fill(JsonReader* reader, int count)
+{
+    int available = reader->dataLength - reader->position;
+
+    if (available >= count || reader->isFileEnd)
+    {
+        return available;
+    }
+
+    // move the data after position to the buffer start
+    memmove(reader->buffer, reader->buffer + reader->position, (size_t) available);
+    reader->dataLength = available;
+    reader->position   = 0;
+
+    if (count > reader->bufferLength)
+    {
+        // the token is longer than buffer
+        reader->bufferLength = count > reader->bufferLength * 2 ? count : reader->bufferLength * 2;
+        reader->buffer       = realloc(reader->buffer, (size_t) reader->bufferLength + 1);
+
+        ALog_A(reader->buffer != NULL, "AJsonReader Fill failed, unable to realloc buffer, size = %d", reader->bufferLength);
+    }
+
+    while (reader->dataLength < count)
+    {
+        char*  data  = reader->buffer + reader->dataLength;
+        size_t space = (size_t) (reader->bufferLength - reader->dataLength);
+        int    size;
+
+        if (reader->packStream->asset != NULL)
+        {
+            size = APack->ReadStream(reader->packStream, data, space);
+        }
+        else
+        {
+            size = AFile->Read(reader->file, data, space);
+        }
+
+        if (size <= 0)
+        {
+            reader->isFileEnd = true;
+            break;
+        }
+
+        reader->dataLength += size;
+    }
+
+    reader->buffer[reader->dataLength] = '\0';
+
+    return reader->dataLength;
+}
+
+
+/**
+ * Get the char at offset after position, return '\0' if no more data.
+ */
+static inline char PeekChar(JsonReader* reader, int offset)
+{
+    if (reader->position + offset >= reader->dataLength && Fill(reader, offset + 1) <= offset)
+    {
+        return '\0';
+    }
+
+    return reader->buffer[reader->position + offset];
+}
+
+
+#if defined(JSON_READER_NEON)
+/**
+ * Get the bit mask of 16 bytes compare result, 4 bits for each byte.
+ */
+static inline uint64_t GetNeonMask(uint8x16_t match)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+}
+#endif
+
+
+/**
+ * Find the first '"' or '\\' in [str, end) by blocks, return end if not found.
+ */
+static inline char* FindQuoteOrEscape(char* str, char* end)
+{
+    #if defined(JSON_READER_SSE2)
+
+    const __m128i quote  = _mm_set1_epi8('"');
+    const __m128i escape = _mm_set1_epi8('\\');
+
+    while (end - str >= JsonReader_BlockSize)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i*) str);
+        int     mask  = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, quote), _mm_cmpeq_epi8(block, escape)));
+
+        if (mask != 0)
+        {
+            return str + __builtin_ctz((unsigned int) mask);
+        }
+
+        str += JsonReader_BlockSize;
+    }
+
+    #elif defined(JSON_READER_NEON)
+
+    const uint8x16_t quote  = vdupq_n_u8('"');
+    const uint8x16_t escape = vdupq_n_u8('\\');
+
+    while (end - str >= JsonReader_BlockSize)
+    {
+        uint8x16_t block = vld1q_u8((const uint8_t*) str);
+        uint64_t   mask  = GetNeonMask(vorrq_u8(vceqq_u8(block, quote), vceqq_u8(block, escape)));
+
+        if (mask != 0)
+        {
+            return str + (__builtin_ctzll(mask) >> 2);
+        }
+
+        str += JsonReader_BlockSize;
+    }
+
+    #endif
+
+    while (str < end && *str != '"' && *str != '\\')
+    {
+        ++str;
+    }
+
+    return str;
+}
+
+
+/**
+ * Find the first not white space char in [str, end) by blocks, return end if not found.
+ */
+static inline char* FindNotWhiteSpace(char* str, char* end)
+{
+    #if defined(JSON_READER_SSE2)
+
+    const __m128i space   = _mm_set1_epi8(' ');
+    const __m128i tab     = _mm_set1_epi8('\t');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i enter   = _mm_set1_epi8('\r');
+
+    while (end - str >= JsonReader_BlockSize)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i*) str);
+        __m128i match = _mm_or_si128
+                        (
+                            _mm_or_si128(_mm_cmpeq_epi8(block, space),   _mm_cmpeq_epi8(block, tab)),
+                            _mm_or_si128(_mm_cmpeq_epi8(block, newline), _mm_cmpeq_epi8(block, enter))
+                        );
+        int     mask  = ~_mm_movemask_epi8(match) & 0xFFFF;
+
+        if (mask != 0)
+        {
+            return str + __builtin_ctz((unsigned int) mask);
+        }
+
+        str += JsonReader_BlockSize;
+    }
+
+    #elif defined(JSON_READER_NEON)
+
+    const uint8x16_t space   = vdupq_n_u8(' ');
+    const uint8x16_t tab     = vdupq_n_u8('\t');
+    const uint8x16_t newline = vdupq_n_u8('\n');
+    const uint8x16_t enter   = vdupq_n_u8('\r');
+
+    while (end - str >= JsonReader_BlockSize)
+    {
+        uint8x16_t block = vld1q_u8((const uint8_t*) str);
+        uint8x16_t match = vorrq_u8
+                           (
+                               vorrq_u8(vceqq_u8(block, space),   vceqq_u8(block, tab)),
+                               vorrq_u8(vceqq_u8(block, newline), vceqq_u8(block, enter))
+                           );
+        uint64_t   mask  = GetNeonMask(vmvnq_u8(match));
+
+        if (mask != 0)
+        {
+            return str + (__builtin_ctzll(mask) >> 2);
+        }
+
+        str += JsonReader_BlockSize;
+    }
+
+    #endif
+
+    while (str < end && (*str == ' ' || *str == '\t' || *str == '\n' || *str == '\r'))
+    {
+        ++str;
+    }
+
+    return str;
+}
+
+
+/**
+ * Skip white space and return the char at position.
+ */
+static inline char SkipWhiteSpace(JsonReader* reader)
+{
+    while (true)
+    {
+        char c = PeekChar(reader, 0);
+
+        switch (c)
+        {
+            case ' ' :
+            case '\t':
+            case '\n':
+            case '\r':
+            {
+                // most white space are single or indents, so check the next char before scanning blocks
+                char* data        = reader->buffer + reader->position;
+                reader->position += (int) (FindNotWhiteSpace(data + 1, reader->buffer + reader->dataLength) - data);
+                continue;
+            }
+
+            default:
+                return c;
+        }
+    }
+}
+
+
+static int ParseHex4(const char* hex)
+{
+    int code = 0;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        char c = hex[i];
+        code <<= 4;
+
+        if (c >= '0' && c <= '9')
+        {
+            code |= c - '0';
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            code |= c - 'a' + 10;
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            code |= c - 'A' + 10;
+        }
+        else
+        {
+            ALog_A(false, "AJsonReader string parse error, invalid \\u escape char = %c", c);
+        }
+    }
+
+    return code;
+}
+
+
+/**
+ * Write the UTF-8 bytes of code into write, return the write end.
+ */
+static char* WriteUTF8(char* write, int code)
+{
+    if (code < 0x80)
+    {
+        *write++ = (char) code;
+    }
+    else if (code < 0x800)
+    {
+        *write++ = (char) (0xC0 | (code >> 6));
+        *write++ = (char) (0x80 | (code & 0x3F));
+    }
+    else if (code < 0x10000)
+    {
+        *write++ = (char) (0xE0 | (code >> 12));
+        *write++ = (char) (0x80 | ((code >> 6) & 0x3F));
+        *write++ = (char) (0x80 | (code & 0x3F));
+    }
+    else
+    {
+        *write++ = (char) (0xF0 | (code >> 18));
+        *write++ = (char) (0x80 | ((code >> 12) & 0x3F));
+        *write++ = (char) (0x80 | ((code >> 6) & 0x3F));
+        *write++ = (char) (0x80 | (code & 0x3F));
+    }
+
+    return write;
+}
+
+
+/**
+ * Unescape str in place until end, the unescaped string is never longer than the source.
+ * return the unescaped string end.
+ */
+static char* Unescape(char* str, char* end)
+{
+    char* read  = str;
+    char* write = str;
+
+    while (read < end)
+    {
+        if (*read != '\\')
+        {
+            *write++ = *read++;
+            continue;
+        }
+
+        // skip '\\'
+        ++read;
+
+        switch (*read++)
+        {
+            case '"':
+                *write++ = '"';
+                break;
+
+            case '\\':
+                *write++ = '\\';
+                break;
+
+            case '/':
+                *write++ = '/';
+                break;
+
+            case 'b':
+                *write++ = '\b';
+                break;
+
+            case 'f':
+                *write++ = '\f';
+                break;
+
+            case 'n':
+                *write++ = '\n';
+                break;
+
+            case 'r':
+                *write++ = '\r';
+                break;
+
+            case 't':
+                *write++ = '\t';
+                break;
+
+            case 'u':
+            {
+                ALog_A(end - read >= 4, "AJsonReader string parse error, incomplete \\u escape.");
+
+                int code = ParseHex4(read);
+                read    += 4;
+
+                // the surrogate pair
+                if (code >= 0xD800 && code <= 0xDBFF && end - read >= 6 && read[0] == '\\' && read[1] == 'u')
+                {
+                    int low = ParseHex4(read + 2);
+
+                    if (low >= 0xDC00 && low <= 0xDFFF)
+                    {
+                        code  = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                        read += 6;
+                    }
+                }
+
+                write = WriteUTF8(write, code);
+                break;
+            }
+
+            default:
+                ALog_A(false, "AJsonReader string parse error, invalid escape char = %c", read[-1]);
+        }
+    }
+
+    return write;
+}
+
+
+/**
+ * Read the string at position that starts with '"', and set into reader string.
+ * if isKey, the white space and ':' after string are skipped too.
+ *
+ * the chars are peeked by offset after position,
+ * so the string is still in buffer when the buffer data moved by Fill.
+ */
+static void ReadString(JsonReader* reader, bool isKey)
+{
+    // the offset after position, skip '"'
+    int  offset    = 1;
+    bool hasEscape = false;
+
+    while (true)
+    {
+        // scan the data in buffer by blocks, and PeekChar will fill more data if scanned to the end
+        char* data = reader->buffer + reader->position;
+        offset     = (int) (FindQuoteOrEscape(data + offset, reader->buffer + reader->dataLength) - data);
+        char  c    = PeekChar(reader, offset);
+
+        if (c == '"')
+        {
+            break;
+        }
+
+        if (c == '\\')
+        {
+            hasEscape = true;
+            // skip the escaped char, that may be '"'
+            offset   += 2;
+        }
+        else if (c == '\0')
+        {
+            ALog_A(false, "AJsonReader string parse error on '\\0', json is incomplete.");
+            break;
+        }
+    }
+
+    // the string end '"'
+    int endOffset = offset;
+
+    // skip the string end '"'
+    ++offset;
+
+    if (isKey)
+    {
+        char c;
+
+        while ((c = PeekChar(reader, offset)) == ' ' || c == '\t' || c == '\n' || c == '\r')
+        {
+            ++offset;
+        }
+
+        ALog_A(c == ':', "AJsonReader parse error, char = %c, should be ':' after key", c);
+
+        // skip ':'
+        ++offset;
+    }
+
+    char* str = reader->buffer + reader->position + 1;
+    char* end = reader->buffer + reader->position + endOffset;
+
+    if (hasEscape)
+    {
+        end = Unescape(str, end);
+    }
+
+    // replace the string end '"' or after
+    *end                 = '\0';
+    reader->string       = str;
+    reader->stringLength = (int) (end - str);
+    reader->position    += offset;
+}
+
+
+/**
+ * The exact powers of 10 in double.
+ */
+static const double pow10Arr[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+
+/**
+ * Parse the decimal number at str into float, the outEnd is the char after number.
+ *
+ * the digits are accumulated into an integer mantissa, when mantissa <= 2^53 and the exponent in [-22, 22],
+ * both mantissa and power of 10 are exact double, so the result is the correctly rounded double.
+ * then rounding it to float is exact unless the double is just at the middle of two floats,
+ * the other cases fall back to strtof.
+ */
+static float ParseFloat(char* str, char** outEnd)
+{
+    char*    p          = str;
+    bool     isNegative = false;
+    uint64_t mantissa   = 0;
+    int      digitCount = 0;
+    int      exponent   = 0;
+    bool     hasDigit   = false;
+
+    if (*p == '-')
+    {
+        isNegative = true;
+        ++p;
+    }
+
+    // the leading zeros are not significant digits
+    while (*p == '0')
+    {
+        hasDigit = true;
+        ++p;
+    }
+
+    while ((unsigned int) (*p - '0') < 10)
+    {
+        mantissa  = mantissa * 10 + (uint64_t) (*p - '0');
+        hasDigit  = true;
+        ++digitCount;
+        ++p;
+    }
+
+    if (*p == '.')
+    {
+        ++p;
+
+        if (mantissa == 0)
+        {
+            // the zeros after '.' are not significant digits when no digit before them
+            while (*p == '0')
+            {
+                hasDigit = true;
+                --exponent;
+                ++p;
+            }
+        }
+
+        while ((unsigned int) (*p - '0') < 10)
+        {
+            mantissa  = mantissa * 10 + (uint64_t) (*p - '0');
+            hasDigit  = true;
+            ++digitCount;
+            --exponent;
+            ++p;
+        }
+    }
+
+    if (hasDigit == false)
+    {
+        // not a json number, and strtof may read words like "infinity" over the data end
+        *outEnd = str;
+        return 0.0f;
+    }
+
+    if (*p == 'e' || *p == 'E')
+    {
+        char* exponentStart      = p;
+        bool  isNegativeExponent = false;
+        int   exponentValue      = 0;
+
+        ++p;
+
+        if (*p == '-' || *p == '+')
+        {
+            isNegativeExponent = *p == '-';
+            ++p;
+        }
+
+        if ((unsigned int) (*p - '0') < 10)
+        {
+            while ((unsigned int) (*p - '0') < 10)
+            {
+                // big enough to overflow or underflow float
+                if (exponentValue < 1000)
+                {
+                    exponentValue = exponentValue * 10 + (*p - '0');
+                }
+
+                ++p;
+            }
+
+            exponent += isNegativeExponent ? -exponentValue : exponentValue;
+        }
+        else
+        {
+            // not exponent, the number ends before 'e'
+            p = exponentStart;
+        }
+    }
+
+    *outEnd = p;
+
+    if (mantissa == 0)
+    {
+        return isNegative ? -0.0f : 0.0f;
+    }
+
+    // the 19 digits never overflow uint64_t
+    if (digitCount <= 19 && mantissa <= (UINT64_C(1) << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double value = (double) mantissa;
+
+        if (exponent < 0)
+        {
+            value /= pow10Arr[-exponent];
+        }
+        else
+        {
+            value *= pow10Arr[exponent];
+        }
+
+        uint64_t bits;
+        memcpy(&bits, &value, sizeof(double));
+
+        // the double has 29 more mantissa bits than float,
+        // and only the middle of two floats may be rounded differently from the exact decimal
+        if ((bits & ((UINT64_C(1) << 29) - 1)) != (UINT64_C(1) << 28))
+        {
+            return isNegative ? -(float) value : (float) value;
+        }
+    }
+
+    return strtof(str, outEnd);
+}
+
+
+/**
+ * Read the number at position, and set into reader number.
+ */
+static void ReadNumber(JsonReader* reader)
+{
+    int length = 0;
+
+    // find the number length, and make the whole number in buffer when read file
+    while (true)
+    {
+        switch (PeekChar(reader, length))
+        {
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9':
+            case '-': case '+': case '.': case 'e': case 'E':
+                ++length;
+                continue;
+
+            default:
+                break;
+        }
+        break;
+    }
+
+    char* start = reader->buffer + reader->position;
+    char* endPtr;
+
+    if (IsReadFile(reader) || reader->position + length < reader->dataLength)
+    {
+        // the file buffer ends with '\0', or a non-number char is after number in data,
+        // so parsing stops in data
+        reader->number = ParseFloat(start, &endPtr);
+    }
+    else
+    {
+        // the number is at the end of buffer data that may not end with '\0', so parse it in a copy
+        char  buffer[JsonReader_NumberBufferLength];
+        char* number = length < JsonReader_NumberBufferLength ? buffer : malloc((size_t) length + 1);
+
+        ALog_A(number != NULL, "AJsonReader ReadNumber failed, unable to malloc number, length = %d", length);
+
+        memcpy(number, start, (size_t) length);
+        number[length] = '\0';
+
+        reader->number = ParseFloat(number, &endPtr);
+        endPtr         = start + (endPtr - number);
+
+        if (number != buffer)
+        {
+            free(number);
+        }
+    }
+
+    ALog_A(endPtr > start, "AJsonReader number parse error, char = %c", *start);
+
+    reader->position += (int) (endPtr - start);
+}
+
+
+/**
+ * Read the literal word at position.
+ */
+static void ReadWord(JsonReader* reader, const char* word, int length)
+{
+    for (int i = 1; i < length; ++i)
+    {
+        ALog_A
+        (
+            PeekChar(reader, i) == word[i],
+            "AJsonReader parse error, invalid word, should be %s",
+            word
+        );
+    }
+
+    reader->position += length;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static JsonToken Next(JsonReader* reader)
+{
+    char c = SkipWhiteSpace(reader);
+
+    if (reader->isNeedComma)
+    {
+        if (c == ',')
+        {
+            ++reader->position;
+            c                   = SkipWhiteSpace(reader);
+            reader->isNeedComma = false;
+
+            ALog_A(c != '}' && c != ']', "AJsonReader parse error, char = %c after ','", c);
+        }
+        else
+        {
+            ALog_A
+            (
+                c == '}' || c == ']' || reader->scopeList->size == 0,
+                "AJsonReader parse error, char = %c, should be ','",
+                c
+            );
+        }
+    }
+
+    ArrayList* scopeList = reader->scopeList;
+    char       scope     = scopeList->size > 0 ? AArrayList_Get(scopeList, scopeList->size - 1, char) : '\0';
+
+    switch (c)
+    {
+        case '{':
+            ++reader->position;
+            AArrayList_Add(scopeList, c);
+            reader->isNeedComma = false;
+            reader->isAfterKey  = false;
+            return reader->token = JsonToken_ObjectStart;
+
+        case '[':
+            ++reader->position;
+            AArrayList_Add(scopeList, c);
+            reader->isNeedComma = false;
+            reader->isAfterKey  = false;
+            return reader->token = JsonToken_ArrayStart;
+
+        case '}':
+            ALog_A(scope == '{' && reader->isAfterKey == false, "AJsonReader parse error, '}' not matched.");
+            ++reader->position;
+            AArrayList->Pop(scopeList, NULL);
+            reader->token = JsonToken_ObjectEnd;
+            break;
+
+        case ']':
+            ALog_A(scope == '[', "AJsonReader parse error, ']' not matched.");
+            ++reader->position;
+            AArrayList->Pop(scopeList, NULL);
+            reader->token = JsonToken_ArrayEnd;
+            break;
+
+        case '"':
+            if (scope == '{' && reader->isAfterKey == false)
+            {
+                ReadString(reader, true);
+                reader->isAfterKey = true;
+
+                return reader->token = JsonToken_Key;
+            }
+
+            ReadString(reader, false);
+            reader->token = JsonToken_String;
+            break;
+
+        case '0':
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+        case '5':
+        case '6':
+        case '7':
+        case '8':
+        case '9':
+        case '-':
+            ReadNumber(reader);
+            reader->token = JsonToken_Float;
+            break;
+
+        case 't':
+            ReadWord(reader, "true", 4);
+            reader->token = JsonToken_True;
+            break;
+
+        case 'f':
+            ReadWord(reader, "false", 5);
+            reader->token = JsonToken_False;
+            break;
+
+        case 'n':
+            ReadWord(reader, "null", 4);
+            reader->token = JsonToken_Null;
+            break;
+
+        case '\0':
+            ALog_A(scopeList->size == 0, "AJsonReader parse error on '\\0', json is incomplete.");
+            return reader->token = JsonToken_End;
+
+        default:
+            ALog_A(false, "AJsonReader parse error, invalid char = %c", c);
+            return reader->token = JsonToken_End;
+    }
+
+    ALog_A
+    (
+        scope != '{' || reader->isAfterKey || reader->token == JsonToken_ObjectEnd,
+        "AJsonReader parse error, the value in object has no key."
+    );
+
+    // a value of current scope is completed
+    reader->isNeedComma = true;
+    reader->isAfterKey  = false;
+
+    return reader->token;
+}
+
+
+static void SkipValue(JsonReader* reader)
+{
+    if (reader->token != JsonToken_ObjectStart && reader->token != JsonToken_ArrayStart)
+    {
+        return;
+    }
+
+    int depth = reader->scopeList->size - 1;
+
+    while (reader->scopeList->size > depth)
+    {
+        JsonToken token = Next(reader);
+        ALog_A(token != JsonToken_End, "AJsonReader SkipValue failed, json is incomplete.");
+    }
+}
+
+
+static int GetDepth(JsonReader* reader)
+{
+    return reader->scopeList->size;
+}
+
+
+static void InitScope(JsonReader* outReader)
+{
+    AArrayList->InitWithBuffer(sizeof(char), outReader->scopeBuffer, JsonReader_ScopeBufferLength, outReader->scopeList);
+
+    outReader->token        = JsonToken_End;
+    outReader->string       = NULL;
+    outReader->stringLength = 0;
+    outReader->number       = 0.0f;
+    outReader->position     = 0;
+    outReader->isNeedComma  = false;
+    outReader->isAfterKey   = false;
+}
+
+
+static void InitWithBuffer(char* json, int length, JsonReader* outReader)
+{
+    InitScope(outReader);
+
+    outReader->file              = NULL;
+    outReader->packStream->asset = NULL;
+    outReader->buffer            = json;
+    outReader->bufferLength      = length;
+    outReader->dataLength        = length;
+    outReader->isFileEnd         = true;
+}
+
+
+static void InitWithFile(const char* jsonFilePath, int bufferLength, JsonReader* outReader)
+{
+    ALog_A(bufferLength > 0, "AJsonReader InitWithFile failed, bufferLength = %d cannot <= 0", bufferLength);
+
+    InitScope(outReader);
+
+    const PackAsset* asset = APack->Find(jsonFilePath);
+
+    if (asset != NULL)
+    {
+        // the compressed json is decompressed block by block while reading
+        APack->InitStream(asset, outReader->packStream);
+        outReader->file = NULL;
+    }
+    else
+    {
+        outReader->packStream->asset = NULL;
+        outReader->file              = AFile->Open(jsonFilePath);
+    }
+
+    outReader->buffer       = malloc((size_t) bufferLength + 1);
+    outReader->bufferLength = bufferLength;
+    outReader->dataLength   = 0;
+    outReader->isFileEnd    = false;
+    outReader->buffer[0]    = '\0';
+}
+
+
+static void Release(JsonReader* reader)
+{
+    if (IsReadFile(reader))
+    {
+        if (reader->file != NULL)
+        {
+            AFile->Close(reader->file);
+        }
+        else
+        {
+            APack->ReleaseStream(reader->packStream);
+        }
+
+        free(reader->buffer);
+
+        reader->file              = NULL;
+        reader->packStream->asset = NULL;
+        reader->buffer            = NULL;
+    }
+
+    AArrayList->Release(reader->scopeList);
+}
+
+
+struct AJsonReader AJsonReader[1] =
+{{
+    InitWithBuffer,
+    InitWithFile,
+    Release,
+    Next,
+    SkipValue,
+    GetDepth,
+}};
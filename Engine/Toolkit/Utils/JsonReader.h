@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+
+#include <stdbool.h>
+#include "Engine/Toolkit/Utils/ArrayList.h"
+#include "Engine/Toolkit/Platform/File.h"
+#include "Engine/Toolkit/Utils/Pack.h"
+
+
+/**
+ * The token type read by JsonReader.
+ */
+typedef enum
+{
+    JsonToken_ObjectStart,
+    JsonToken_ObjectEnd,
+    JsonToken_ArrayStart,
+    JsonToken_ArrayEnd,
+
+    /**
+     * The key of JsonObject, the ':' after key is skipped.
+     */
+    JsonToken_Key,
+    JsonToken_String,
+    JsonToken_Float,
+    JsonToken_True,
+    JsonToken_False,
+    JsonToken_Null,
+
+    /**
+     * No more token.
+     */
+    JsonToken_End,
+}
+JsonToken;
+
+
+/**
+ * The capacity of JsonReader scopeBuffer, the deeper scopes will move to heap memory.
+ */
+#define JsonReader_ScopeBufferLength 32
+
+
+/**
+ * The pull reader that reads json token by token without building json tree,
+ * and the memory is bounded by the longest token when reading file.
+ */
+typedef struct
+{
+    /**
+     * The current token.
+     */
+    JsonToken        token;
+
+    /**
+     * The string of JsonToken_Key and JsonToken_String, unescaped in place inside buffer and end with '\0'.
+     *
+     * if read buffer
+     *     valid until the buffer freed
+     * else
+     *     valid until the next token read
+     */
+    char*            string;
+
+    /**
+     * The length of string, not include '\0'.
+     */
+    int              stringLength;
+
+    /**
+     * The number of JsonToken_Float.
+     */
+    float            number;
+
+    /**
+     * The file of json data, NULL when read buffer or pack asset.
+     */
+    File*            file;
+
+    /**
+     * The stream of pack asset of json data, the asset is NULL when read buffer or file.
+     */
+    PackStream       packStream[1];
+
+    /**
+     * The json data, when read file it always ends with '\0' after dataLength.
+     */
+    char*            buffer;
+
+    /**
+     * The capacity of buffer not include the '\0'.
+     */
+    int              bufferLength;
+
+    /**
+     * The valid json data length in buffer.
+     */
+    int              dataLength;
+
+    /**
+     * The read position in buffer.
+     */
+    int              position;
+
+    /**
+     * The scopes of '{' and '[' from root to current.
+     */
+    ArrayList(char)  scopeList  [1];
+    char             scopeBuffer[JsonReader_ScopeBufferLength];
+
+    /**
+     * The value of current scope is completed, so next token should be after ','.
+     */
+    bool             isNeedComma;
+
+    /**
+     * The key of current object scope is read, so next token is value.
+     */
+    bool             isAfterKey;
+
+    /**
+     * The file has no more data to read.
+     */
+    bool             isFileEnd;
+}
+JsonReader;
+
+
+/**
+ * Control JsonReader.
+ */
+struct AJsonReader
+{
+    /**
+     * Init JsonReader that reads the length bytes of json in buffer,
+     * the json not need to end with '\0', and no byte after json[length - 1] will be read.
+     * the strings are unescaped in place, so json will be modified.
+     */
+    void      (*InitWithBuffer)(char* json, int length, JsonReader* outReader);
+
+    /**
+     * Init JsonReader that reads json from file incrementally,
+     * the buffer holds bufferLength bytes, and grows only when a token is longer than it.
+     * the json file in mounted packs of APack is read first.
+     *
+     * jsonFilePath:
+     *     Android: assets
+     *     IOS    : NSBundle
+     */
+    void      (*InitWithFile)  (const char* jsonFilePath, int bufferLength, JsonReader* outReader);
+
+    /**
+     * Close the file and free the buffer of JsonReader that is created by InitWithFile.
+     */
+    void      (*Release)       (JsonReader* reader);
+
+    /**
+     * Read next token and set into reader token, string and number.
+     * return the reader token.
+     */
+    JsonToken (*Next)          (JsonReader* reader);
+
+    /**
+     * Skip the whole object or array of current token JsonToken_ObjectStart or JsonToken_ArrayStart,
+     * after skipped the current token is the matched end.
+     * other tokens are single value that no need to skip.
+     */
+    void      (*SkipValue)     (JsonReader* reader);
+
+    /**
+     * Get the count of '{' and '[' that not closed.
+     */
+    int       (*GetDepth)      (JsonReader* reader);
+};
+
+
+extern struct AJsonReader AJsonReader[1];
+
+
+#endif
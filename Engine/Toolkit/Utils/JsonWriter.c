@@ -0,0 +1,591 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "Engine/Toolkit/Utils/JsonWriter.h"
+#include "Engine/Toolkit/Platform/Log.h"
+#include "Engine/Toolkit/Platform/File.h"
+
+
+/**
+ * The initial capacity of bufferList when write into bufferList.
+ */
+#define JsonWriter_BufferCapacity 256
+
+
+/**
+ * The exact powers of 10 in double.
+ */
+static const double pow10Arr[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+
+static inline void Flush(JsonWriter* writer)
+{
+    if (writer->bufferList->size > 0)
+    {
+        fwrite(writer->bufferList->elementArr->data, (size_t) writer->bufferList->size, 1, writer->file);
+        AArrayList->Clear(writer->bufferList);
+    }
+}
+
+
+static void Write(JsonWriter* writer, const char* data, int length)
+{
+    if (writer->file != NULL && writer->bufferList->size + length > writer->flushSize)
+    {
+        Flush(writer);
+
+        if (length > writer->flushSize)
+        {
+            // the big data no need to copy into bufferList
+            fwrite(data, (size_t) length, 1, writer->file);
+            return;
+        }
+    }
+
+    AArrayList->AddArray(writer->bufferList, (void*) data, length, sizeof(char));
+}
+
+
+static inline void WriteChar(JsonWriter* writer, char c)
+{
+    if (writer->file != NULL && writer->bufferList->size >= writer->flushSize)
+    {
+        Flush(writer);
+    }
+
+    AArrayList_Add(writer->bufferList, c);
+}
+
+
+/**
+ * Write the string with '"' and escaped chars.
+ */
+static void WriteEscaped(JsonWriter* writer, const char* str)
+{
+    static const char hexChars[] = "0123456789abcdef";
+
+    WriteChar(writer, '"');
+
+    while (true)
+    {
+        const char* run = str;
+
+        // find the run of chars no need to escape
+        while ((unsigned char) *str >= 0x20 && *str != '"' && *str != '\\')
+        {
+            ++str;
+        }
+
+        if (str > run)
+        {
+            Write(writer, run, (int) (str - run));
+        }
+
+        char c = *str;
+
+        if (c == '\0')
+        {
+            break;
+        }
+
+        char escape[6] = {'\\', c};
+        int  length    = 2;
+
+        switch (c)
+        {
+            case '"':
+            case '\\':
+                break;
+
+            case '\b':
+                escape[1] = 'b';
+                break;
+
+            case '\f':
+                escape[1] = 'f';
+                break;
+
+            case '\n':
+                escape[1] = 'n';
+                break;
+
+            case '\r':
+                escape[1] = 'r';
+                break;
+
+            case '\t':
+                escape[1] = 't';
+                break;
+
+            default:
+                escape[1] = 'u';
+                escape[2] = '0';
+                escape[3] = '0';
+                escape[4] = hexChars[(c >> 4) & 0xF];
+                escape[5] = hexChars[c & 0xF];
+                length    = 6;
+                break;
+        }
+
+        Write(writer, escape, length);
+        ++str;
+    }
+
+    WriteChar(writer, '"');
+}
+
+
+/**
+ * Write the digits of value into end of buffer backward, return the start of digits.
+ */
+static inline char* FormatDigits(uint32_t value, char* end)
+{
+    do
+    {
+        *--end = (char) ('0' + value % 10);
+        value /= 10;
+    }
+    while (value != 0);
+
+    return end;
+}
+
+
+/**
+ * Check the decimal digits * 10^exponent is parsed to value.
+ */
+static inline bool IsRoundTrip(uint32_t digits, int exponent, float value)
+{
+    if (exponent < -22 || exponent > 22)
+    {
+        return false;
+    }
+
+    // both digits and power of 10 are exact double, so the result is the correctly rounded double
+    double decimal = exponent < 0 ? digits / pow10Arr[-exponent] : digits * pow10Arr[exponent];
+
+    uint64_t bits;
+    memcpy(&bits, &decimal, sizeof(double));
+
+    // at the middle of two floats, rounding double to float may differ from the exact decimal
+    if ((bits & ((UINT64_C(1) << 29) - 1)) == (UINT64_C(1) << 28))
+    {
+        return false;
+    }
+
+    return (float) decimal == value;
+}
+
+
+/**
+ * Format digits * 10^exponent into buffer like javascript number, return the length.
+ */
+static int FormatDecimal(uint32_t digits, int exponent, char* buffer)
+{
+    // remove the trailing zeros
+    while (digits % 10 == 0)
+    {
+        digits /= 10;
+        ++exponent;
+    }
+
+    char  digitBuffer[16];
+    char* digitEnd   = digitBuffer + sizeof(digitBuffer);
+    char* digitStart = FormatDigits(digits, digitEnd);
+    int   count      = (int) (digitEnd - digitStart);
+
+    // the count of digits before '.'
+    int   pointIndex = count + exponent;
+    char* p          = buffer;
+
+    if (exponent >= 0 && pointIndex <= 21)
+    {
+        memcpy(p, digitStart, (size_t) count);
+        p += count;
+
+        for (int i = 0; i < exponent; ++i)
+        {
+            *p++ = '0';
+        }
+    }
+    else if (pointIndex > 0 && pointIndex <= 21)
+    {
+        memcpy(p, digitStart, (size_t) pointIndex);
+        p   += pointIndex;
+        *p++ = '.';
+        memcpy(p, digitStart + pointIndex, (size_t) (count - pointIndex));
+        p   += count - pointIndex;
+    }
+    else if (pointIndex > -6 && pointIndex <= 0)
+    {
+        *p++ = '0';
+        *p++ = '.';
+
+        for (int i = pointIndex; i < 0; ++i)
+        {
+            *p++ = '0';
+        }
+
+        memcpy(p, digitStart, (size_t) count);
+        p += count;
+    }
+    else
+    {
+        *p++ = digitStart[0];
+
+        if (count > 1)
+        {
+            *p++ = '.';
+            memcpy(p, digitStart + 1, (size_t) (count - 1));
+            p += count - 1;
+        }
+
+        p += sprintf(p, "e%d", pointIndex - 1);
+    }
+
+    return (int) (p - buffer);
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+/**
+ * Write ',' if needed before value, and check the value has key in object.
+ */
+static inline void BeginValue(JsonWriter* writer)
+{
+    ArrayList* scopeList = writer->scopeList;
+
+    if (scopeList->size > 0 && AArrayList_Get(scopeList, scopeList->size - 1, char) == '{')
+    {
+        ALog_A(writer->isAfterKey, "AJsonWriter write value failed, the value in object has no key.");
+        writer->isAfterKey = false;
+    }
+    else
+    {
+        ALog_A
+        (
+            scopeList->size > 0 || writer->isNeedComma == false,
+            "AJsonWriter write value failed, json can only has one root value."
+        );
+
+        if (writer->isNeedComma)
+        {
+            WriteChar(writer, ',');
+        }
+    }
+}
+
+
+static void BeginObject(JsonWriter* writer)
+{
+    BeginValue(writer);
+    WriteChar(writer, '{');
+
+    AArrayList_Add(writer->scopeList, (char) {'{'});
+    writer->isNeedComma = false;
+}
+
+
+static void EndObject(JsonWriter* writer)
+{
+    ArrayList* scopeList = writer->scopeList;
+
+    ALog_A
+    (
+        scopeList->size > 0 && AArrayList_Get(scopeList, scopeList->size - 1, char) == '{' && !writer->isAfterKey,
+        "AJsonWriter EndObject failed, not matched BeginObject or the last key has no value."
+    );
+
+    WriteChar(writer, '}');
+
+    AArrayList->Pop(scopeList, NULL);
+    writer->isNeedComma = true;
+}
+
+
+static void BeginArray(JsonWriter* writer)
+{
+    BeginValue(writer);
+    WriteChar(writer, '[');
+
+    AArrayList_Add(writer->scopeList, (char) {'['});
+    writer->isNeedComma = false;
+}
+
+
+static void EndArray(JsonWriter* writer)
+{
+    ArrayList* scopeList = writer->scopeList;
+
+    ALog_A
+    (
+        scopeList->size > 0 && AArrayList_Get(scopeList, scopeList->size - 1, char) == '[',
+        "AJsonWriter EndArray failed, not matched BeginArray."
+    );
+
+    WriteChar(writer, ']');
+
+    AArrayList->Pop(scopeList, NULL);
+    writer->isNeedComma = true;
+}
+
+
+static void WriteKey(JsonWriter* writer, const char* key)
+{
+    ArrayList* scopeList = writer->scopeList;
+
+    ALog_A
+    (
+        scopeList->size > 0 && AArrayList_Get(scopeList, scopeList->size - 1, char) == '{' && !writer->isAfterKey,
+        "AJsonWriter WriteKey failed, the key must be in object and before value."
+    );
+
+    if (writer->isNeedComma)
+    {
+        WriteChar(writer, ',');
+    }
+
+    WriteEscaped(writer, key);
+    WriteChar   (writer, ':');
+
+    writer->isAfterKey = true;
+}
+
+
+static void WriteString(JsonWriter* writer, const char* str)
+{
+    BeginValue  (writer);
+    WriteEscaped(writer, str);
+    writer->isNeedComma = true;
+}
+
+
+static void WriteInt(JsonWriter* writer, int value)
+{
+    char  buffer[16];
+    char* end   = buffer + sizeof(buffer);
+    // the unsigned negation is safe for INT_MIN
+    char* start = FormatDigits(value < 0 ? 0u - (uint32_t) value : (uint32_t) value, end);
+
+    if (value < 0)
+    {
+        *--start = '-';
+    }
+
+    BeginValue(writer);
+    Write     (writer, start, (int) (end - start));
+    writer->isNeedComma = true;
+}
+
+
+static void WriteFloat(JsonWriter* writer, float value)
+{
+    ALog_A(isfinite(value), "AJsonWriter WriteFloat failed, json not support value = %f", value);
+
+    if (isfinite(value) == false || value == 0.0f)
+    {
+        value = 0.0f;
+    }
+
+    float absValue = fabsf(value);
+
+    if (absValue < 16777216.0f && absValue == (float) (int) absValue)
+    {
+        // the float is an exact int
+        WriteInt(writer, (int) value);
+        return;
+    }
+
+    char buffer[32];
+    char* p = buffer;
+
+    if (value < 0.0f)
+    {
+        *p++ = '-';
+    }
+
+    int exponent = (int) floor(log10((double) absValue));
+
+    // find the shortest digits from 1 to 9 that can be parsed back to the same float
+    for (int precision = 1; precision <= 9; ++precision)
+    {
+        int scale = precision - 1 - exponent;
+
+        if (scale < -22 || scale > 22)
+        {
+            break;
+        }
+
+        double scaled = scale >= 0 ? (double) absValue * pow10Arr[scale] : (double) absValue / pow10Arr[-scale];
+
+        // the exponent may be 1 less by log10 error
+        if (scaled >= (double) UINT32_MAX)
+        {
+            break;
+        }
+
+        uint32_t digits = (uint32_t) (scaled + 0.5);
+
+        if (digits != 0 && IsRoundTrip(digits, -scale, absValue))
+        {
+            p += FormatDecimal(digits, -scale, p);
+
+            BeginValue(writer);
+            Write     (writer, buffer, (int) (p - buffer));
+            writer->isNeedComma = true;
+
+            return;
+        }
+    }
+
+    // the 9 significant digits can always be parsed back to the same float
+    int length = snprintf(buffer, sizeof(buffer), "%.9g", value);
+
+    BeginValue(writer);
+    Write     (writer, buffer, length);
+    writer->isNeedComma = true;
+}
+
+
+static void WriteBool(JsonWriter* writer, bool value)
+{
+    BeginValue(writer);
+
+    if (value)
+    {
+        Write(writer, "true", 4);
+    }
+    else
+    {
+        Write(writer, "false", 5);
+    }
+
+    writer->isNeedComma = true;
+}
+
+
+static void WriteNull(JsonWriter* writer)
+{
+    BeginValue(writer);
+    Write     (writer, "null", 4);
+    writer->isNeedComma = true;
+}
+
+
+static const char* GetString(JsonWriter* writer, int* outLength)
+{
+    ALog_A(writer->file == NULL, "AJsonWriter GetString failed, the output is written into file.");
+
+    ArrayList* bufferList = writer->bufferList;
+
+    // make the '\0' end and not count it into size
+    AArrayList_Add(bufferList, (char) {'\0'});
+    --bufferList->size;
+
+    if (outLength != NULL)
+    {
+        *outLength = bufferList->size;
+    }
+
+    return bufferList->elementArr->data;
+}
+
+
+//----------------------------------------------------------------------------------------------------------------------
+
+
+static void InitScope(JsonWriter* outWriter)
+{
+    AArrayList->InitWithBuffer(sizeof(char), outWriter->scopeBuffer, JsonWriter_ScopeBufferLength, outWriter->scopeList);
+
+    outWriter->isNeedComma = false;
+    outWriter->isAfterKey  = false;
+}
+
+
+static void Init(JsonWriter* outWriter)
+{
+    InitScope(outWriter);
+    AArrayList->InitWithCapacity(sizeof(char), JsonWriter_BufferCapacity, outWriter->bufferList);
+
+    outWriter->file      = NULL;
+    outWriter->flushSize = 0;
+}
+
+
+static void InitWithFile(const char* relativeFilePath, int bufferLength, JsonWriter* outWriter)
+{
+    ALog_A(bufferLength > 0, "AJsonWriter InitWithFile failed, bufferLength = %d cannot <= 0", bufferLength);
+
+    int         dirPathLength;
+    const char* dirPath = AFile->GetInternalDataPath(&dirPathLength);
+
+    char path[dirPathLength + strlen(relativeFilePath) + 2];
+    sprintf(path, "%s/%s", dirPath, relativeFilePath);
+
+    InitScope(outWriter);
+    AArrayList->InitWithCapacity(sizeof(char), bufferLength, outWriter->bufferList);
+
+    outWriter->file      = fopen(path, "wb");
+    outWriter->flushSize = bufferLength;
+
+    ALog_A(outWriter->file != NULL, "AJsonWriter InitWithFile failed, unable to open file = %s", path);
+}
+
+
+static void Release(JsonWriter* writer)
+{
+    if (writer->file != NULL)
+    {
+        Flush (writer);
+        fclose(writer->file);
+        writer->file = NULL;
+    }
+
+    AArrayList->Release(writer->bufferList);
+    AArrayList->Release(writer->scopeList);
+}
+
+
+struct AJsonWriter AJsonWriter[1] =
+{{
+    Init,
+    InitWithFile,
+    Release,
+    BeginObject,
+    EndObject,
+    BeginArray,
+    EndArray,
+    WriteKey,
+    WriteString,
+    WriteFloat,
+    WriteInt,
+    WriteBool,
+    WriteNull,
+    GetString,
+}};
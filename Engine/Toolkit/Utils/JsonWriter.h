@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+
+#include <stdbool.h>
+#include <stdio.h>
+#include "Engine/Toolkit/Utils/ArrayList.h"
+
+
+/**
+ * The capacity of JsonWriter scopeBuffer, the deeper scopes will move to heap memory.
+ */
+#define JsonWriter_ScopeBufferLength 32
+
+
+/**
+ * The writer that writes json value by value without building json tree,
+ * the output is in bufferList or flushed into file when bufferList is full.
+ */
+typedef struct
+{
+    /**
+     * The json output, when write file it holds the data not flushed yet.
+     */
+    ArrayList(char) bufferList [1];
+
+    /**
+     * The file of json output, NULL when write into bufferList.
+     */
+    FILE*           file;
+
+    /**
+     * The bufferList size that flush into file.
+     */
+    int             flushSize;
+
+    /**
+     * The scopes of '{' and '[' from root to current.
+     */
+    ArrayList(char) scopeList  [1];
+    char            scopeBuffer[JsonWriter_ScopeBufferLength];
+
+    /**
+     * The value of current scope is written, so ',' is needed before next one.
+     */
+    bool            isNeedComma;
+
+    /**
+     * The key of current object scope is written, so next one is value.
+     */
+    bool            isAfterKey;
+}
+JsonWriter;
+
+
+/**
+ * Control JsonWriter.
+ */
+struct AJsonWriter
+{
+    /**
+     * Init JsonWriter that writes json into bufferList, get the result by GetString.
+     */
+    void        (*Init)          (JsonWriter* outWriter);
+
+    /**
+     * Init JsonWriter that writes json into file incrementally,
+     * the data is flushed into file when more than bufferLength.
+     *
+     * the relativeFilePath is relative internalDataPath from AFile->GetInternalDataPath().
+     *
+     * internalDataPath:
+     *     Android: internal data directory
+     *     IOS    : document data directory
+     *
+     * if file not exist will created.
+     */
+    void        (*InitWithFile)  (const char* relativeFilePath, int bufferLength, JsonWriter* outWriter);
+
+    /**
+     * Free the bufferList, if write file will flush data and close file.
+     */
+    void        (*Release)       (JsonWriter* writer);
+
+    void        (*BeginObject)   (JsonWriter* writer);
+    void        (*EndObject)     (JsonWriter* writer);
+    void        (*BeginArray)    (JsonWriter* writer);
+    void        (*EndArray)      (JsonWriter* writer);
+
+    /**
+     * Write the key of object, next must be a value.
+     */
+    void        (*WriteKey)      (JsonWriter* writer, const char* key);
+
+    /**
+     * Write the string with escaped chars.
+     */
+    void        (*WriteString)   (JsonWriter* writer, const char* str);
+
+    /**
+     * Write the shortest decimal that can be parsed back to the same float.
+     */
+    void        (*WriteFloat)    (JsonWriter* writer, float value);
+    void        (*WriteInt)      (JsonWriter* writer, int   value);
+    void        (*WriteBool)     (JsonWriter* writer, bool  value);
+    void        (*WriteNull)     (JsonWriter* writer);
+
+    /**
+     * Get the json output of JsonWriter that init by Init, end with '\0'.
+     * outLength: the length of json not include '\0', can be NULL.
+     *
+     * the string is valid until write more or Release.
+     */
+    const char* (*GetString)     (JsonWriter* writer, int* outLength);
+};
+
+
+extern struct AJsonWriter AJsonWriter[1];
+
+
+#endif
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "Engine/Toolkit/Utils/LZ4.h"
+
+
+/**
+ * The bits of hash table index for compression.
+ */
+#define LZ4_HashLog      12
+
+
+/**
+ * The min length of match.
+ */
+#define LZ4_MinMatch     4
+
+
+/**
+ * The last match must start before the last LZ4_MatchLimit bytes.
+ */
+#define LZ4_MatchLimit   12
+
+
+/**
+ * The last LZ4_LastLiterals bytes are always literals.
+ */
+#define LZ4_LastLiterals 5
+
+
+/**
+ * The max offset of match.
+ */
+#define LZ4_MaxOffset    65535
+
+
+static inline uint32_t Read32(const uint8_t* ptr)
+{
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(uint32_t));
+    return value;
+}
+
+
+static inline uint32_t GetHash(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - LZ4_HashLog);
+}
+
+
+/**
+ * Write the extra bytes of length that >= 15.
+ * return the dst after written, or NULL if dst is not enough.
+ */
+static inline uint8_t* WriteLength(uint8_t* dst, const uint8_t* dstEnd, int length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        if (dst >= dstEnd)
+        {
+            return NULL;
+        }
+
+        *dst++ = 255;
+    }
+
+    if (dst >= dstEnd)
+    {
+        return NULL;
+    }
+
+    *dst++ = (uint8_t) length;
+
+    return dst;
+}
+
+
+/**
+ * Write one sequence of literals and match, the match is omitted when matchLength is 0.
+ * return the dst after written, or NULL if dst is not enough.
+ */
+static uint8_t* WriteSequence
+(
+    uint8_t*       dst,
+    const uint8_t* dstEnd,
+    const uint8_t* literals,
+    int            literalLength,
+    int            offset,
+    int            matchLength
+)
+{
+    if (dst >= dstEnd)
+    {
+        return NULL;
+    }
+
+    uint8_t* token = dst++;
+    int      code  = matchLength - LZ4_MinMatch;
+
+    *token = (uint8_t) ((literalLength < 15 ? literalLength : 15) << 4);
+
+    if (literalLength >= 15)
+    {
+        dst = WriteLength(dst, dstEnd, literalLength - 15);
+
+        if (dst == NULL)
+        {
+            return NULL;
+        }
+    }
+
+    if (dstEnd - dst < literalLength)
+    {
+        return NULL;
+    }
+
+    memcpy(dst, literals, (size_t) literalLength);
+    dst += literalLength;
+
+    if (matchLength == 0)
+    {
+        return dst;
+    }
+
+    if (dstEnd - dst < 2)
+    {
+        return NULL;
+    }
+
+    *dst++  = (uint8_t) offset;
+    *dst++  = (uint8_t) (offset >> 8);
+    *token |= (uint8_t) (code < 15 ? code : 15);
+
+    if (code >= 15)
+    {
+        dst = WriteLength(dst, dstEnd, code - 15);
+    }
+
+    return dst;
+}
+
+
+static int GetCompressBound(int srcLength)
+{
+    return srcLength + srcLength / 255 + 16;
+}
+
+
+static int Compress(const char* src, int srcLength, char* dst, int dstCapacity)
+{
+    const uint8_t* srcStart = (const uint8_t*) src;
+    const uint8_t* srcEnd   = srcStart + srcLength;
+    const uint8_t* anchor   = srcStart;
+    uint8_t*       out      = (uint8_t*) dst;
+    const uint8_t* outEnd   = out + dstCapacity;
+
+    if (srcLength > LZ4_MatchLimit)
+    {
+        const uint8_t* matchLimit   = srcEnd - LZ4_MatchLimit;
+        const uint8_t* literalLimit = srcEnd - LZ4_LastLiterals;
+        const uint8_t* ip           = srcStart + 1;
+        int            missCount    = 0;
+        uint32_t       table[1 << LZ4_HashLog];
+
+        memset(table, 0, sizeof(table));
+
+        while (ip < matchLimit)
+        {
+            uint32_t       sequence = Read32(ip);
+            uint32_t       hash     = GetHash(sequence);
+            const uint8_t* ref      = srcStart + table[hash];
+
+            table[hash] = (uint32_t) (ip - srcStart);
+
+            if (ref >= ip || ip - ref > LZ4_MaxOffset || Read32(ref) != sequence)
+            {
+                // skip faster in the data that has no match
+                ip += 1 + (missCount++ >> 6);
+                continue;
+            }
+
+            missCount = 0;
+
+            // extend match backward into literals
+            while (ip > anchor && ref > srcStart && ip[-1] == ref[-1])
+            {
+                --ip;
+                --ref;
+            }
+
+            int matchLength = LZ4_MinMatch;
+
+            while (ip + matchLength < literalLimit && ip[matchLength] == ref[matchLength])
+            {
+                ++matchLength;
+            }
+
+            out = WriteSequence(out, outEnd, anchor, (int) (ip - anchor), (int) (ip - ref), matchLength);
+
+            if (out == NULL)
+            {
+                return 0;
+            }
+
+            ip    += matchLength;
+            anchor = ip;
+
+            if (ip < matchLimit)
+            {
+                // the position before next search helps to find the repeated data
+                table[GetHash(Read32(ip - 2))] = (uint32_t) (ip - 2 - srcStart);
+            }
+        }
+    }
+
+    out = WriteSequence(out, outEnd, anchor, (int) (srcEnd - anchor), 0, 0);
+
+    if (out == NULL)
+    {
+        return 0;
+    }
+
+    return (int) (out - (uint8_t*) dst);
+}
+
+
+/**
+ * Read the extra bytes of length that >= 15.
+ * return false if src is broken.
+ */
+static inline bool ReadLength(const uint8_t** src, const uint8_t* srcEnd, int* length)
+{
+    uint8_t value;
+
+    do
+    {
+        if (*src >= srcEnd)
+        {
+            return false;
+        }
+
+        value    = *(*src)++;
+        *length += value;
+    }
+    while (value == 255);
+
+    return true;
+}
+
+
+static int Decompress(const char* src, int srcLength, char* dst, int dstCapacity)
+{
+    const uint8_t* ip     = (const uint8_t*) src;
+    const uint8_t* ipEnd  = ip + srcLength;
+    uint8_t*       op     = (uint8_t*) dst;
+    uint8_t*       opEnd  = op + dstCapacity;
+
+    while (ip < ipEnd)
+    {
+        int token         = *ip++;
+        int literalLength = token >> 4;
+
+        if (literalLength == 15 && ReadLength(&ip, ipEnd, &literalLength) == false)
+        {
+            return -1;
+        }
+
+        if (ipEnd - ip < literalLength || opEnd - op < literalLength)
+        {
+            return -1;
+        }
+
+        memcpy(op, ip, (size_t) literalLength);
+        op += literalLength;
+        ip += literalLength;
+
+        // the last sequence has only literals
+        if (ip == ipEnd)
+        {
+            break;
+        }
+
+        if (ipEnd - ip < 2)
+        {
+            return -1;
+        }
+
+        int offset      = ip[0] | (ip[1] << 8);
+        int matchLength = (token & 15) + LZ4_MinMatch;
+        ip             += 2;
+
+        if (offset == 0 || offset > op - (uint8_t*) dst)
+        {
+            return -1;
+        }
+
+        if ((token & 15) == 15 && ReadLength(&ip, ipEnd, &matchLength) == false)
+        {
+            return -1;
+        }
+
+        if (opEnd - op < matchLength)
+        {
+            return -1;
+        }
+
+        const uint8_t* match = op - offset;
+
+        if (offset >= matchLength)
+        {
+            memcpy(op, match, (size_t) matchLength);
+        }
+        else if (offset >= 8)
+        {
+            // each 8 bytes copy never overlaps
+            for (int i = 0; i < matchLength; i += 8)
+            {
+                memcpy(op + i, match + i, (size_t) (matchLength - i < 8 ? matchLength - i : 8));
+            }
+        }
+        else
+        {
+            // the match repeats the short pattern
+            for (int i = 0; i < matchLength; ++i)
+            {
+                op[i] = match[i];
+            }
+        }
+
+        op += matchLength;
+    }
+
+    return (int) (op - (uint8_t*) dst);
+}
+
+
+struct ALZ4 ALZ4[1] =
+{{
+    GetCompressBound,
+    Compress,
+    Decompress,
+}};
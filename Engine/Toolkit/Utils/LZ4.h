@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#ifndef LZ4_H
+#define LZ4_H
+
+
+/**
+ * The compression and decompression of LZ4 block format,
+ * the block format is compatible with LZ4 library, and has no frame header.
+ *
+ * the compression is fast greedy matching that suits build tools,
+ * and the decompression is very fast and safe for broken data, that suits runtime.
+ * all functions are thread safe.
+ */
+struct ALZ4
+{
+    /**
+     * Get the max compressed size of srcLength bytes data.
+     */
+    int (*GetCompressBound)(int srcLength);
+
+    /**
+     * Compress src into dst.
+     * return the compressed size, or 0 if dstCapacity is not enough.
+     */
+    int (*Compress)        (const char* src, int srcLength, char* dst, int dstCapacity);
+
+    /**
+     * Decompress src into dst.
+     * return the decompressed size, or -1 if src is broken or dstCapacity is not enough.
+     */
+    int (*Decompress)      (const char* src, int srcLength, char* dst, int dstCapacity);
+};
+
+
+extern struct ALZ4 ALZ4[1];
+
+
+#endif
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "Engine/Toolkit/Utils/MPMCQueue.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * The header of each cell.
+ */
+typedef struct
+{
+    /**
+     * Equal to index means can push, equal to index + 1 means can pop.
+     */
+    atomic_uint sequence;
+}
+MPMCQueueCell;
+
+
+/**
+ * The offset of element from MPMCQueueCell header, keep element 8 bytes aligned.
+ */
+#define ElementOffset \
+    ((int) ((sizeof(MPMCQueueCell) + 7) & ~(size_t) 7))
+
+
+#define GetCell(mpmcQueue, index) \
+    ((MPMCQueueCell*) ((mpmcQueue)->data + (mpmcQueue)->cellSize * (int) ((index) & (mpmcQueue)->mask)))
+
+
+#define GetElement(cell) \
+    ((void*) ((char*) (cell) + ElementOffset))
+
+
+static bool Push(MPMCQueue* mpmcQueue, void* elementPtr)
+{
+    unsigned int   index = atomic_load_explicit(&mpmcQueue->tailIndex, memory_order_relaxed);
+    MPMCQueueCell* cell;
+
+    while (true)
+    {
+        cell              = GetCell(mpmcQueue, index);
+        unsigned int seq  = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        int          diff = (int) (seq - index);
+
+        if (diff == 0)
+        {
+            // the cell is free in this round, try to own it
+            if
+            (
+                atomic_compare_exchange_weak_explicit
+                (
+                    &mpmcQueue->tailIndex, &index, index + 1, memory_order_relaxed, memory_order_relaxed
+                )
+            )
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the cell still has element of last round
+            return false;
+        }
+        else
+        {
+            // other producer has pushed
+            index = atomic_load_explicit(&mpmcQueue->tailIndex, memory_order_relaxed);
+        }
+    }
+
+    memcpy(GetElement(cell), elementPtr, (size_t) mpmcQueue->elementTypeSize);
+    atomic_store_explicit(&cell->sequence, index + 1, memory_order_release);
+
+    return true;
+}
+
+
+static bool Pop(MPMCQueue* mpmcQueue, void* outElementPtr)
+{
+    unsigned int   index = atomic_load_explicit(&mpmcQueue->headIndex, memory_order_relaxed);
+    MPMCQueueCell* cell;
+
+    while (true)
+    {
+        cell              = GetCell(mpmcQueue, index);
+        unsigned int seq  = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+        int          diff = (int) (seq - (index + 1));
+
+        if (diff == 0)
+        {
+            // the cell has element in this round, try to own it
+            if
+            (
+                atomic_compare_exchange_weak_explicit
+                (
+                    &mpmcQueue->headIndex, &index, index + 1, memory_order_relaxed, memory_order_relaxed
+                )
+            )
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the cell has not been pushed
+            return false;
+        }
+        else
+        {
+            // other consumer has popped
+            index = atomic_load_explicit(&mpmcQueue->headIndex, memory_order_relaxed);
+        }
+    }
+
+    memcpy(outElementPtr, GetElement(cell), (size_t) mpmcQueue->elementTypeSize);
+
+    // free the cell for next round
+    atomic_store_explicit(&cell->sequence, index + mpmcQueue->mask + 1, memory_order_release);
+
+    return true;
+}
+
+
+static int PushBatch(MPMCQueue* mpmcQueue, void* elementArr, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        if (Push(mpmcQueue, (char*) elementArr + mpmcQueue->elementTypeSize * i) == false)
+        {
+            return i;
+        }
+    }
+
+    return count;
+}
+
+
+static int PopBatch(MPMCQueue* mpmcQueue, void* outElementArr, int maxCount)
+{
+    for (int i = 0; i < maxCount; ++i)
+    {
+        if (Pop(mpmcQueue, (char*) outElementArr + mpmcQueue->elementTypeSize * i) == false)
+        {
+            return i;
+        }
+    }
+
+    return maxCount;
+}
+
+
+static int Drain(MPMCQueue* mpmcQueue, int maxCount, void (*OnElement)(void* elementPtr, void* context), void* context)
+{
+    // keep 8 bytes aligned
+    long long element[(mpmcQueue->elementTypeSize + 7) / 8];
+
+    for (int i = 0; i < maxCount; ++i)
+    {
+        if (Pop(mpmcQueue, element) == false)
+        {
+            return i;
+        }
+
+        OnElement(element, context);
+    }
+
+    return maxCount;
+}
+
+
+static int GetSize(MPMCQueue* mpmcQueue)
+{
+    unsigned int headIndex = atomic_load_explicit(&mpmcQueue->headIndex, memory_order_acquire);
+    unsigned int tailIndex = atomic_load_explicit(&mpmcQueue->tailIndex, memory_order_acquire);
+    int          size      = (int) (tailIndex - headIndex);
+
+    return size < 0 ? 0 : size;
+}
+
+
+static void Init(int elementTypeSize, int capacity, MPMCQueue* outMPMCQueue)
+{
+    ALog_A(capacity > 0, "AMPMCQueue Init capacity = %d, must greater than 0", capacity);
+
+    unsigned int length = 2;
+
+    while (length < (unsigned int) capacity)
+    {
+        length <<= 1;
+    }
+
+    outMPMCQueue->elementTypeSize = elementTypeSize;
+    outMPMCQueue->cellSize        = (ElementOffset + elementTypeSize + 7) & ~7;
+    outMPMCQueue->mask            = length - 1;
+    outMPMCQueue->data            = malloc((size_t) outMPMCQueue->cellSize * length);
+
+    ALog_A
+    (
+        outMPMCQueue->data != NULL,
+        "AMPMCQueue Init failed, unable to malloc memory, size = %d, length = %u",
+        outMPMCQueue->cellSize * (int) length, length
+    );
+
+    for (unsigned int i = 0; i < length; ++i)
+    {
+        atomic_init(&GetCell(outMPMCQueue, i)->sequence, i);
+    }
+
+    atomic_init(&outMPMCQueue->tailIndex, 0);
+    atomic_init(&outMPMCQueue->headIndex, 0);
+}
+
+
+static MPMCQueue* Create(int elementTypeSize, int capacity)
+{
+    MPMCQueue* mpmcQueue = malloc(sizeof(MPMCQueue));
+    Init(elementTypeSize, capacity, mpmcQueue);
+
+    return mpmcQueue;
+}
+
+
+static void Release(MPMCQueue* mpmcQueue)
+{
+    free(mpmcQueue->data);
+    mpmcQueue->data = NULL;
+}
+
+
+struct AMPMCQueue AMPMCQueue[1] =
+{{
+    Create,
+    Init,
+    Release,
+    Push,
+    Pop,
+    PushBatch,
+    PopBatch,
+    Drain,
+    GetSize,
+}};
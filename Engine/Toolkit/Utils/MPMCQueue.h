@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+
+/**
+ * The bytes of cache line, used to separate the data written by different threads.
+ */
+#define MPMCQueue_CacheLineSize 64
+
+
+/**
+ * The bounded lock-free queue for any count of producer and consumer threads.
+ * each cell has a sequence that tells whether it can be pushed or popped in current round,
+ * so producers and consumers only contend on their own index by compare and swap.
+ */
+typedef struct
+{
+    int          elementTypeSize;
+
+    /**
+     * The size of cell with sequence header and element.
+     */
+    int          cellSize;
+
+    /**
+     * The capacity - 1.
+     */
+    unsigned int mask;
+
+    /**
+     * Cells memory space.
+     */
+    char*        data;
+
+    char         padding0[MPMCQueue_CacheLineSize];
+
+    /**
+     * The next index to push.
+     */
+    atomic_uint  tailIndex;
+
+    char         padding1[MPMCQueue_CacheLineSize];
+
+    /**
+     * The next index to pop.
+     */
+    atomic_uint  headIndex;
+
+    char         padding2[MPMCQueue_CacheLineSize];
+}
+MPMCQueue;
+
+
+/**
+ * Control MPMCQueue, all functions except Init and Release can be called by any thread.
+ */
+struct AMPMCQueue
+{
+    /**
+     * The capacity will be rounded up to power of 2.
+     */
+    MPMCQueue* (*Create)   (int elementTypeSize, int capacity);
+    void       (*Init)     (int elementTypeSize, int capacity, MPMCQueue* outMPMCQueue);
+    void       (*Release)  (MPMCQueue* mpmcQueue);
+
+    /**
+     * Copy element from elementPtr into the tail of MPMCQueue.
+     * return false if MPMCQueue is full.
+     */
+    bool       (*Push)     (MPMCQueue* mpmcQueue, void* elementPtr);
+
+    /**
+     * Copy top element into outElementPtr.
+     * return false if MPMCQueue is empty.
+     */
+    bool       (*Pop)      (MPMCQueue* mpmcQueue, void* outElementPtr);
+
+    /**
+     * Copy count elements from elementArr into MPMCQueue,
+     * the elements may be interleaved with other producers.
+     *
+     * return the count of pushed elements, less than count when MPMCQueue is full.
+     */
+    int        (*PushBatch)(MPMCQueue* mpmcQueue, void* elementArr, int count);
+
+    /**
+     * Copy maxCount elements at most into outElementArr.
+     * return the count of popped elements.
+     */
+    int        (*PopBatch) (MPMCQueue* mpmcQueue, void* outElementArr, int maxCount);
+
+    /**
+     * Pop maxCount elements at most and pass each one to OnElement,
+     * the elementPtr is only valid in OnElement. Usually called by main thread every frame.
+     *
+     * return the count of popped elements.
+     */
+    int        (*Drain)    (MPMCQueue* mpmcQueue, int maxCount, void (*OnElement)(void* elementPtr, void* context), void* context);
+
+    /**
+     * Get the count of elements, the result may be out of date when returned.
+     */
+    int        (*GetSize)  (MPMCQueue* mpmcQueue);
+};
+
+
+extern struct AMPMCQueue AMPMCQueue[1];
+
+
+/**
+ * Marked MPMCQueue element type.
+ */
+#define MPMCQueue(ElementType) MPMCQueue
+
+
+/**
+ * Shortcut of AMPMCQueue->Push.
+ */
+#define AMPMCQueue_Push(mpmcQueue, element) \
+    AMPMCQueue->Push(mpmcQueue, &(element))
+
+
+/**
+ * Shortcut of AMPMCQueue->Pop.
+ */
+#define AMPMCQueue_Pop(mpmcQueue, outElement) \
+    AMPMCQueue->Pop(mpmcQueue, &(outElement))
+
+
+#endif
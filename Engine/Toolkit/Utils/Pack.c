@@ -0,0 +1,827 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+
+#include "Engine/Toolkit/Utils/Pack.h"
+#include "Engine/Toolkit/Utils/ArrayList.h"
+#include "Engine/Toolkit/Utils/LZ4.h"
+#include "Engine/Toolkit/Math/Math.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * One mounted pack file.
+ */
+typedef struct
+{
+    /**
+     * The file descriptor of pack file, < 0 means pack is read by file.
+     */
+    int   fd;
+
+    /**
+     * The file of pack, only used when fd < 0.
+     */
+    File* file;
+
+    /**
+     * The offset of pack data in file descriptor.
+     */
+    long  start;
+
+    /**
+     * The length of pack data.
+     */
+    long  length;
+
+    /**
+     * The PackEntry array and path strings read from pack file.
+     */
+    char* indexData;
+}
+Pack;
+
+
+static ArrayList(Pack)      packList [1] = AArrayList_Init(Pack,      2);
+static ArrayList(PackAsset) assetList[1] = AArrayList_Init(PackAsset, 100);
+
+
+/**
+ * Guard the seek and read of pack file that has no file descriptor.
+ */
+static pthread_mutex_t      fileMutex[1] = {PTHREAD_MUTEX_INITIALIZER};
+
+
+/**
+ * The count of PackStreams not released, the streams hold PackAsset pointers into assetList,
+ * so Mount cannot sort and grow assetList until they are released.
+ */
+static atomic_int           streamCount  = 0;
+
+
+/**
+ * Read count bytes of pack data from offset, and return the number of bytes read.
+ */
+static long ReadPack(Pack* pack, long offset, void* buffer, size_t count)
+{
+    long readCount = 0;
+
+    if (pack->fd >= 0)
+    {
+        // pread not changes the file offset, so the fd can be read in any thread
+        while (readCount < (long) count)
+        {
+            ssize_t size = pread
+                           (
+                               pack->fd,
+                               (char*) buffer + readCount,
+                               count - (size_t) readCount,
+                               (off_t) (pack->start + offset + readCount)
+                           );
+
+            if (size <= 0)
+            {
+                break;
+            }
+
+            readCount += size;
+        }
+    }
+    else
+    {
+        pthread_mutex_lock(fileMutex);
+
+        if (AFile->Seek(pack->file, offset, SEEK_SET) == offset)
+        {
+            while (readCount < (long) count)
+            {
+                int size = AFile->Read(pack->file, (char*) buffer + readCount, count - (size_t) readCount);
+
+                if (size <= 0)
+                {
+                    break;
+                }
+
+                readCount += size;
+            }
+        }
+
+        pthread_mutex_unlock(fileMutex);
+    }
+
+    return readCount;
+}
+
+
+static void ClosePack(Pack* pack)
+{
+    if (pack->fd >= 0)
+    {
+        close(pack->fd);
+    }
+    else
+    {
+        AFile->Close(pack->file);
+    }
+
+    free(pack->indexData);
+}
+
+
+/**
+ * Order by hash, then path, then the later mounted pack first.
+ */
+static int CompareAsset(const void* a, const void* b)
+{
+    const PackAsset* assetA = a;
+    const PackAsset* assetB = b;
+
+    if (assetA->hash != assetB->hash)
+    {
+        return assetA->hash < assetB->hash ? -1 : 1;
+    }
+
+    int result = strcmp(assetA->path, assetB->path);
+
+    if (result != 0)
+    {
+        return result;
+    }
+
+    return assetB->packIndex - assetA->packIndex;
+}
+
+
+/**
+ * Whether the entry is inside pack, and its blocks are inside block table.
+ */
+static bool IsValidEntry(Pack* pack, PackHeader* header, PackEntry* entry, const uint32_t* blockEnds)
+{
+    if (entry->pathOffset >= header->pathSize || (long) entry->offset + (long) entry->storedLength > pack->length)
+    {
+        return false;
+    }
+
+    if (entry->blockIndex == APack_NoBlock)
+    {
+        return entry->storedLength == entry->length;
+    }
+
+    uint32_t blockCount = (entry->length + APack_BlockSize - 1) / APack_BlockSize;
+
+    if (entry->blockIndex > header->blockCount || blockCount > header->blockCount - entry->blockIndex)
+    {
+        return false;
+    }
+
+    uint32_t blockStart = 0;
+
+    for (uint32_t i = 0; i < blockCount; ++i)
+    {
+        uint32_t blockEnd = blockEnds[entry->blockIndex + i];
+
+        if (blockEnd <= blockStart || blockEnd - blockStart > APack_BlockSize)
+        {
+            return false;
+        }
+
+        blockStart = blockEnd;
+    }
+
+    return blockStart == entry->storedLength;
+}
+
+
+/**
+ * Check the index of pack, then add the assets of pack into assetList.
+ */
+static bool AddAssets(Pack* pack, int packIndex, PackHeader* header)
+{
+    PackEntry*      entries   = (PackEntry*) pack->indexData;
+    const uint32_t* blockEnds = (uint32_t*) (entries + header->entryCount);
+    const char*     paths     = (char*) (blockEnds + header->blockCount);
+
+    if (header->pathSize > 0 && paths[header->pathSize - 1] != '\0')
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header->entryCount; ++i)
+    {
+        if (IsValidEntry(pack, header, entries + i, blockEnds) == false)
+        {
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < header->entryCount; ++i)
+    {
+        PackEntry* entry    = entries + i;
+        PackAsset* asset    = AArrayList_GetPtrAdd(assetList, PackAsset);
+
+        asset->hash         = entry->hash;
+        asset->path         = paths + entry->pathOffset;
+        asset->packIndex    = packIndex;
+        asset->offset       = (long) entry->offset;
+        asset->length       = (long) entry->length;
+        asset->storedLength = (long) entry->storedLength;
+        asset->blockEnds    = entry->blockIndex == APack_NoBlock ? NULL : blockEnds + entry->blockIndex;
+    }
+
+    return true;
+}
+
+
+static bool Mount(const char* resourceFilePath)
+{
+    if (atomic_load(&streamCount) > 0)
+    {
+        ALog_E
+        (
+            "APack Mount failed, %d PackStreams are open, pack file = %s",
+            atomic_load(&streamCount),
+            resourceFilePath
+        );
+        return false;
+    }
+
+    Pack pack[1];
+
+    pack->file      = NULL;
+    pack->indexData = NULL;
+    pack->fd        = AFile->OpenFileDescriptor(resourceFilePath, &pack->start, &pack->length);
+
+    if (pack->fd < 0)
+    {
+        // the pack file is compressed, so read it by file
+        pack->file = AFile->Open(resourceFilePath);
+
+        if (pack->file == NULL)
+        {
+            return false;
+        }
+
+        pack->start  = 0;
+        pack->length = AFile->GetLength(pack->file);
+    }
+
+    PackHeader header[1];
+
+    if
+    (
+        ReadPack(pack, 0, header, sizeof(PackHeader)) != (long) sizeof(PackHeader) ||
+        header->magic                                 != APack_Magic               ||
+        header->version                               != APack_Version
+    )
+    {
+        ALog_E("APack Mount failed, invalid pack file = %s", resourceFilePath);
+        ClosePack(pack);
+        return false;
+    }
+
+    long indexSize  = (long) header->entryCount * (long) sizeof(PackEntry) +
+                      (long) header->blockCount * (long) sizeof(uint32_t)  +
+                      (long) header->pathSize;
+    pack->indexData = malloc((size_t) indexSize);
+
+    ALog_A(pack->indexData != NULL, "APack Mount failed, unable to malloc index, size = %ld", indexSize);
+
+    int  packIndex  = packList->size;
+    int  assetCount = assetList->size;
+
+    if
+    (
+        ReadPack(pack, (long) sizeof(PackHeader), pack->indexData, (size_t) indexSize) != indexSize ||
+        AddAssets(pack, packIndex, header) == false
+    )
+    {
+        ALog_E("APack Mount failed, broken pack index = %s", resourceFilePath);
+        AArrayList->SetSize(assetList, assetCount);
+        ClosePack(pack);
+        return false;
+    }
+
+    AArrayList_Add(packList, *pack);
+
+    if (assetCount > 0)
+    {
+        PackAsset* assets = AArrayList_GetData(assetList, PackAsset);
+        int        count  = 0;
+
+        qsort(assets, (size_t) assetList->size, sizeof(PackAsset), CompareAsset);
+
+        // keep the first one of the same path assets, which is in the later mounted pack
+        for (int i = 0; i < assetList->size; ++i)
+        {
+            if (count == 0 || assets[i].hash != assets[count - 1].hash || strcmp(assets[i].path, assets[count - 1].path) != 0)
+            {
+                assets[count++] = assets[i];
+            }
+        }
+
+        AArrayList->SetSize(assetList, count);
+    }
+
+    return true;
+}
+
+
+static void UnmountAll()
+{
+    ALog_A(atomic_load(&streamCount) == 0, "APack UnmountAll failed, %d PackStreams are open", atomic_load(&streamCount));
+
+    for (int i = 0; i < packList->size; ++i)
+    {
+        ClosePack(AArrayList_GetPtr(packList, i, Pack));
+    }
+
+    AArrayList->Clear(packList);
+    AArrayList->Clear(assetList);
+}
+
+
+static const PackAsset* Find(const char* resourceFilePath)
+{
+    if (assetList->size == 0)
+    {
+        return NULL;
+    }
+
+    uint32_t   hash   = APack_GetHash(resourceFilePath);
+    PackAsset* assets = AArrayList_GetData(assetList, PackAsset);
+    int        low    = 0;
+    int        high   = assetList->size;
+
+    // find the first asset that hash >= target hash
+    while (low < high)
+    {
+        int mid = (low + high) >> 1;
+
+        if (assets[mid].hash < hash)
+        {
+            low  = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    for (; low < assetList->size && assets[low].hash == hash; ++low)
+    {
+        if (strcmp(assets[low].path, resourceFilePath) == 0)
+        {
+            return assets + low;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * Get the stored start offset of block from the start of asset data.
+ */
+static inline long GetBlockStart(const PackAsset* asset, int blockIndex)
+{
+    return blockIndex == 0 ? 0 : (long) asset->blockEnds[blockIndex - 1];
+}
+
+
+/**
+ * Get the raw length of block.
+ */
+static inline int GetBlockLength(const PackAsset* asset, int blockIndex)
+{
+    long rawStart = (long) blockIndex * APack_BlockSize;
+    return (int) (asset->length - rawStart < APack_BlockSize ? asset->length - rawStart : APack_BlockSize);
+}
+
+
+/**
+ * Decompress the stored data of block into raw buffer.
+ * return the raw length, or -1 if block is broken.
+ */
+static int DecodeBlock(const PackAsset* asset, int blockIndex, const char* stored, char* raw)
+{
+    int storedLength = (int) (asset->blockEnds[blockIndex] - GetBlockStart(asset, blockIndex));
+    int rawLength    = GetBlockLength(asset, blockIndex);
+
+    if (storedLength == rawLength)
+    {
+        // the block cannot be compressed smaller
+        memcpy(raw, stored, (size_t) rawLength);
+    }
+    else if (ALZ4->Decompress(stored, storedLength, raw, rawLength) != rawLength)
+    {
+        ALog_E("APack DecodeBlock failed, broken block = %d, asset = %s", blockIndex, asset->path);
+        return -1;
+    }
+
+    return rawLength;
+}
+
+
+/**
+ * The blocks of compressed asset decompressed in parallel by Read.
+ */
+typedef struct
+{
+    const PackAsset* asset;
+
+    /**
+     * The first block index of reading range.
+     */
+    int              firstBlock;
+
+    /**
+     * The stored data from the first block.
+     */
+    const char*      stored;
+
+    /**
+     * The buffer of reading range [offset, offset + count).
+     */
+    char*            buffer;
+    long             offset;
+    long             count;
+
+    /**
+     * The raw data of the partial blocks at the start and end of reading range.
+     */
+    char*            partialBuffer;
+
+    /**
+     * The decompressed length of each block.
+     */
+    int*             resultArr;
+}
+BlockDecodeTask;
+
+
+static void DecodeBlockRange(int fromIndex, int toIndex, void* param)
+{
+    BlockDecodeTask* task       = param;
+    long             firstStart = GetBlockStart(task->asset, task->firstBlock);
+
+    for (int i = fromIndex; i < toIndex; ++i)
+    {
+        int         blockIndex = task->firstBlock + i;
+        long        rawStart   = (long) blockIndex * APack_BlockSize;
+        int         rawLength  = GetBlockLength(task->asset, blockIndex);
+        const char* stored     = task->stored + (GetBlockStart(task->asset, blockIndex) - firstStart);
+
+        if (rawStart >= task->offset && rawStart + rawLength <= task->offset + task->count)
+        {
+            // the whole block is decompressed straight into buffer
+            task->resultArr[i] = DecodeBlock(task->asset, blockIndex, stored, task->buffer + (rawStart - task->offset));
+        }
+        else
+        {
+            char* raw          = task->partialBuffer + (i == 0 ? 0 : APack_BlockSize);
+            task->resultArr[i] = DecodeBlock(task->asset, blockIndex, stored, raw);
+
+            if (task->resultArr[i] >= 0)
+            {
+                long from = AMath_Max(rawStart,             task->offset);
+                long to   = AMath_Min(rawStart + rawLength, task->offset + task->count);
+
+                memcpy(task->buffer + (from - task->offset), raw + (from - rawStart), (size_t) (to - from));
+            }
+        }
+    }
+}
+
+
+/**
+ * Read the raw data of compressed asset, the count is not 0 and not beyond asset.
+ */
+static int ReadCompressed(Pack* pack, const PackAsset* asset, long offset, void* buffer, size_t count)
+{
+    int  firstBlock   = (int) (offset / APack_BlockSize);
+    int  lastBlock    = (int) ((offset + (long) count - 1) / APack_BlockSize);
+    int  blockCount   = lastBlock - firstBlock + 1;
+    long storedStart  = GetBlockStart(asset, firstBlock);
+    long storedLength = (long) asset->blockEnds[lastBlock] - storedStart;
+
+    // results, then partial blocks, then stored data
+    size_t resultSize = (sizeof(int) * (size_t) blockCount + 15) & ~(size_t) 15;
+    char*  data       = malloc(resultSize + APack_BlockSize * 2 + (size_t) storedLength);
+    ALog_A(data != NULL, "APack ReadCompressed failed, unable to malloc, asset = %s", asset->path);
+
+    BlockDecodeTask task[1] =
+    {{
+        asset,
+        firstBlock,
+        data + resultSize + APack_BlockSize * 2,
+        buffer,
+        offset,
+        (long) count,
+        data + resultSize,
+        (int*) data,
+    }};
+
+    int result = (int) count;
+
+    if (ReadPack(pack, asset->offset + storedStart, (char*) task->stored, (size_t) storedLength) != storedLength)
+    {
+        result = -1;
+    }
+    else
+    {
+        // the stored data has been read, so the decompressing not touches pack and can run in parallel
+        AJob->ParallelFor(blockCount, 1, DecodeBlockRange, task);
+
+        for (int i = 0; i < blockCount; ++i)
+        {
+            if (task->resultArr[i] < 0)
+            {
+                result = -1;
+                break;
+            }
+        }
+    }
+
+    free(data);
+
+    return result;
+}
+
+
+static int Read(const PackAsset* asset, long offset, void* buffer, size_t count)
+{
+    if (offset < 0 || offset > asset->length)
+    {
+        return -1;
+    }
+
+    if ((long) count > asset->length - offset)
+    {
+        count = (size_t) (asset->length - offset);
+    }
+
+    Pack* pack = AArrayList_GetPtr(packList, asset->packIndex, Pack);
+
+    if (asset->blockEnds == NULL)
+    {
+        return (int) ReadPack(pack, asset->offset + offset, buffer, count);
+    }
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    return ReadCompressed(pack, asset, offset, buffer, count);
+}
+
+
+static bool Map(const PackAsset* asset, FileMapping* outMapping)
+{
+    Pack* pack = AArrayList_GetPtr(packList, asset->packIndex, Pack);
+
+    if (pack->fd < 0 || asset->length == 0 || asset->blockEnds != NULL)
+    {
+        return false;
+    }
+
+    // the mmap offset must be aligned by page size
+    long  pageSize     = sysconf(_SC_PAGESIZE);
+    long  start        = pack->start + asset->offset;
+    long  alignedStart = start & ~(pageSize - 1);
+    void* address      = mmap
+                         (
+                             NULL,
+                             (size_t) (asset->length + start - alignedStart),
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE,
+                             pack->fd,
+                             (off_t) alignedStart
+                         );
+
+    if (address == MAP_FAILED)
+    {
+        ALog_E("APack Map failed, mmap error asset = %s", asset->path);
+        return false;
+    }
+
+    outMapping->data       = (char*) address + (start - alignedStart);
+    outMapping->length     = asset->length;
+    outMapping->mapAddress = address;
+    outMapping->mapLength  = (size_t) (asset->length + start - alignedStart);
+
+    return true;
+}
+
+
+static int OpenFileDescriptor(const PackAsset* asset, long* outStart, long* outLength)
+{
+    Pack* pack = AArrayList_GetPtr(packList, asset->packIndex, Pack);
+
+    if (pack->fd < 0 || asset->blockEnds != NULL)
+    {
+        return -1;
+    }
+
+    *outStart  = pack->start + asset->offset;
+    *outLength = asset->length;
+
+    return dup(pack->fd);
+}
+
+
+static void InitStream(const PackAsset* asset, PackStream* outStream)
+{
+    outStream->asset             = asset;
+    outStream->position          = 0;
+    outStream->blockIndexArr [0] = -1;
+    outStream->blockIndexArr [1] = -1;
+    outStream->blockLengthArr[0] = -1;
+    outStream->blockLengthArr[1] = -1;
+    outStream->currentSlot       = 0;
+    outStream->prefetchJob       = NULL;
+
+    atomic_fetch_add(&streamCount, 1);
+
+    if (asset->blockEnds != NULL)
+    {
+        // raw data of two slots, then stored data of two slots
+        outStream->blockBuffer = malloc(APack_BlockSize * 4);
+        ALog_A(outStream->blockBuffer != NULL, "APack InitStream failed, unable to malloc, asset = %s", asset->path);
+    }
+    else
+    {
+        outStream->blockBuffer = NULL;
+    }
+}
+
+
+/**
+ * Read and decompress the block of blockIndexArr[slot] into slot.
+ */
+static void LoadBlock(PackStream* stream, int slot)
+{
+    const PackAsset* asset        = stream->asset;
+    int              blockIndex   = stream->blockIndexArr[slot];
+    char*            raw          = stream->blockBuffer + slot       * APack_BlockSize;
+    char*            stored       = stream->blockBuffer + (slot + 2) * APack_BlockSize;
+    long             storedStart  = GetBlockStart(asset, blockIndex);
+    long             storedLength = (long) asset->blockEnds[blockIndex] - storedStart;
+    Pack*            pack         = AArrayList_GetPtr(packList, asset->packIndex, Pack);
+
+    if (ReadPack(pack, asset->offset + storedStart, stored, (size_t) storedLength) != storedLength)
+    {
+        stream->blockLengthArr[slot] = -1;
+    }
+    else
+    {
+        stream->blockLengthArr[slot] = DecodeBlock(asset, blockIndex, stored, raw);
+    }
+}
+
+
+/**
+ * The Job that loads the block into the slot other than current slot.
+ */
+static void PrefetchBlock(void* param)
+{
+    PackStream* stream = param;
+    LoadBlock(stream, 1 - stream->currentSlot);
+}
+
+
+/**
+ * Make the block of blockIndex in current slot, and prefetch the next block.
+ */
+static void SwitchBlock(PackStream* stream, int blockIndex)
+{
+    int otherSlot = 1 - stream->currentSlot;
+
+    if (stream->prefetchJob != NULL)
+    {
+        AJob->Wait(stream->prefetchJob);
+        stream->prefetchJob = NULL;
+    }
+
+    if (stream->blockIndexArr[otherSlot] == blockIndex)
+    {
+        stream->currentSlot = otherSlot;
+    }
+    else
+    {
+        stream->blockIndexArr[stream->currentSlot] = blockIndex;
+        LoadBlock(stream, stream->currentSlot);
+    }
+
+    const PackAsset* asset = stream->asset;
+    Pack*            pack  = AArrayList_GetPtr(packList, asset->packIndex, Pack);
+
+    // the reading of pack file is serialized, so only prefetch by file descriptor
+    if (pack->fd >= 0 && (long) (blockIndex + 1) * APack_BlockSize < asset->length)
+    {
+        stream->blockIndexArr[1 - stream->currentSlot] = blockIndex + 1;
+        stream->prefetchJob                            = AJob->Run(PrefetchBlock, stream);
+    }
+}
+
+
+static int ReadStream(PackStream* stream, void* buffer, size_t count)
+{
+    const PackAsset* asset = stream->asset;
+
+    if (asset->blockEnds == NULL)
+    {
+        int size = Read(asset, stream->position, buffer, count);
+
+        if (size > 0)
+        {
+            stream->position += size;
+        }
+
+        return size;
+    }
+
+    long readCount = 0;
+
+    while (readCount < (long) count && stream->position < asset->length)
+    {
+        int blockIndex = (int) (stream->position / APack_BlockSize);
+
+        if (stream->blockIndexArr[stream->currentSlot] != blockIndex)
+        {
+            SwitchBlock(stream, blockIndex);
+        }
+
+        int blockLength = stream->blockLengthArr[stream->currentSlot];
+
+        if (blockLength < 0)
+        {
+            return readCount > 0 ? (int) readCount : -1;
+        }
+
+        int  blockOffset  = (int) (stream->position % APack_BlockSize);
+        long size         = AMath_Min(blockLength - blockOffset, (long) count - readCount);
+
+        memcpy
+        (
+            (char*) buffer      + readCount,
+            stream->blockBuffer + stream->currentSlot * APack_BlockSize + blockOffset,
+            (size_t) size
+        );
+
+        readCount        += size;
+        stream->position += size;
+    }
+
+    return (int) readCount;
+}
+
+
+static void ReleaseStream(PackStream* stream)
+{
+    if (stream->prefetchJob != NULL)
+    {
+        AJob->Wait(stream->prefetchJob);
+        stream->prefetchJob = NULL;
+    }
+
+    free(stream->blockBuffer);
+    stream->blockBuffer = NULL;
+
+    atomic_fetch_sub(&streamCount, 1);
+}
+
+
+struct APack APack[1] =
+{{
+    Mount,
+    UnmountAll,
+    Find,
+    Read,
+    Map,
+    OpenFileDescriptor,
+    InitStream,
+    ReadStream,
+    ReleaseStream,
+}};
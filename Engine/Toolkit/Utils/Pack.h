@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#ifndef PACK_H
+#define PACK_H
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "Engine/Toolkit/Platform/File.h"
+#include "Engine/Toolkit/Utils/Job.h"
+
+
+/**
+ * The pack file stores many asset files contiguously, created by Engine/Build/Tools/Packer.c.
+ * all integers are little-endian, and the layout is:
+ *
+ * PackHeader
+ * PackEntry[entryCount], sorted by hash then path
+ * uint32_t blockEnd[blockCount], the end offset of each compressed block from the start of its asset data
+ * path strings of entries, each one ends with '\0'
+ * asset data, each one starts at APack_DataAlignment aligned offset
+ *
+ * the compressed asset data is split into blocks of APack_BlockSize bytes (the last one may be smaller),
+ * each block is compressed by ALZ4 independently, or stored raw when its stored length equals its raw length.
+ */
+#define APack_Magic         0x4B50434D
+
+
+/**
+ * The version of pack file layout.
+ */
+#define APack_Version       2
+
+
+/**
+ * The alignment of asset data offset in pack file.
+ */
+#define APack_DataAlignment 16
+
+
+/**
+ * The raw bytes of one compressed block.
+ */
+#define APack_BlockSize     (64 * 1024)
+
+
+/**
+ * The PackEntry blockIndex of asset that is not compressed.
+ */
+#define APack_NoBlock       UINT32_MAX
+
+
+/**
+ * The head of pack file.
+ */
+typedef struct
+{
+    /**
+     * Always APack_Magic.
+     */
+    uint32_t magic;
+
+    /**
+     * Always APack_Version.
+     */
+    uint32_t version;
+
+    /**
+     * The count of PackEntry.
+     */
+    uint32_t entryCount;
+
+    /**
+     * The count of blockEnd of all compressed assets.
+     */
+    uint32_t blockCount;
+
+    /**
+     * The bytes of all path strings.
+     */
+    uint32_t pathSize;
+}
+PackHeader;
+
+
+/**
+ * The index of one asset in pack file.
+ */
+typedef struct
+{
+    /**
+     * The hash of path by APack_GetHash.
+     */
+    uint32_t hash;
+
+    /**
+     * The offset of path string from the start of path strings.
+     */
+    uint32_t pathOffset;
+
+    /**
+     * The offset of asset data from the start of pack file.
+     */
+    uint32_t offset;
+
+    /**
+     * The raw length of asset data.
+     */
+    uint32_t length;
+
+    /**
+     * The length of asset data stored in pack file.
+     */
+    uint32_t storedLength;
+
+    /**
+     * The index of first blockEnd of asset, APack_NoBlock means not compressed.
+     */
+    uint32_t blockIndex;
+}
+PackEntry;
+
+
+/**
+ * One asset in mounted packs.
+ */
+typedef struct
+{
+    /**
+     * The hash of path.
+     */
+    uint32_t        hash;
+
+    /**
+     * The resource file path of asset, same as the path used by AFile.
+     */
+    const char*     path;
+
+    /**
+     * The index of pack that holds asset in mounted order.
+     */
+    int             packIndex;
+
+    /**
+     * The offset of asset data from the start of pack file.
+     */
+    long            offset;
+
+    /**
+     * The raw length of asset data.
+     */
+    long            length;
+
+    /**
+     * The length of asset data stored in pack file.
+     */
+    long            storedLength;
+
+    /**
+     * The end offsets of compressed blocks, NULL means not compressed.
+     */
+    const uint32_t* blockEnds;
+}
+PackAsset;
+
+
+/**
+ * Read one asset sequentially, and the compressed asset is decompressed block by block,
+ * the next block is decompressed by worker thread while the current block is being consumed.
+ */
+typedef struct
+{
+    /**
+     * The asset of stream.
+     */
+    const PackAsset* asset;
+
+    /**
+     * The raw position of next read.
+     */
+    long             position;
+
+    /**
+     * The raw data of two blocks, and the stored data of two blocks,
+     * NULL when asset is not compressed.
+     */
+    char*            blockBuffer;
+
+    /**
+     * The index of block in blockBuffer slot 0 and slot 1, -1 means empty.
+     */
+    int              blockIndexArr[2];
+
+    /**
+     * The decompressed length of block in slot 0 and slot 1, -1 means broken block.
+     */
+    int              blockLengthArr[2];
+
+    /**
+     * The slot of current block.
+     */
+    int              currentSlot;
+
+    /**
+     * The Job that decompresses next block into the other slot, NULL means no Job.
+     */
+    Job*             prefetchJob;
+}
+PackStream;
+
+
+/**
+ * Access assets in pack files, each pack file is opened only once when mounted,
+ * and each asset is found by one binary search of path hash.
+ *
+ * the pack file needs to be stored uncompressed (Android apk noCompress),
+ * then the assets are read by file descriptor and can be mapped,
+ * otherwise the assets are read by AFile that cannot be mapped.
+ */
+struct APack
+{
+    /**
+     * Open pack file from platform resource directory, and read the index of assets.
+     * the assets of later mounted pack replace the same path assets of earlier mounted packs,
+     * and the found PackAssets are moved, so the Mount fails while any PackStream is not released.
+     *
+     * resourceFilePath:
+     *     Android: assets
+     *     IOS    : NSBundle
+     *
+     * return false if pack file not exist or invalid, or any PackStream is open.
+     */
+    bool             (*Mount)             (const char* resourceFilePath);
+
+    /**
+     * Close all mounted pack files, and all PackAssets will be invalidated,
+     * all PackStreams must be released before.
+     */
+    void             (*UnmountAll)        (void);
+
+    /**
+     * Find asset by the resource file path in mounted packs.
+     * return NULL if not found.
+     */
+    const PackAsset* (*Find)              (const char* resourceFilePath);
+
+    /**
+     * Read count bytes of raw asset data from the offset of asset.
+     * the blocks of compressed asset are decompressed in parallel by AJob, straight into buffer.
+     *
+     * return the number of bytes read, zero on the end of asset, or < 0 on error.
+     * it can be called in any thread, and the pack without file descriptor is read one by one.
+     */
+    int              (*Read)              (const PackAsset* asset, long offset, void* buffer, size_t count);
+
+    /**
+     * Map the asset data into memory, same as AFile->Map and unmap by AFile->Unmap.
+     * return false if the asset cannot be mapped (for example, if the asset is compressed).
+     */
+    bool             (*Map)               (const PackAsset* asset, FileMapping* outMapping);
+
+    /**
+     * Open a new file descriptor of pack file, and the asset data is in [outStart, outStart + outLength).
+     * the file descriptor needs to be closed after using.
+     *
+     * returns < 0 if pack is not read by file descriptor or asset is compressed.
+     */
+    int              (*OpenFileDescriptor)(const PackAsset* asset, long* outStart, long* outLength);
+
+    /**
+     * Init PackStream that reads asset from the start.
+     */
+    void             (*InitStream)        (const PackAsset* asset, PackStream* outStream);
+
+    /**
+     * Read count bytes of raw asset data from stream position, and move position.
+     * return the number of bytes read, zero on the end of asset, or < 0 on error.
+     */
+    int              (*ReadStream)        (PackStream* stream, void* buffer, size_t count);
+
+    /**
+     * Wait the decompressing Job and free the buffer of stream, it must be called once for each InitStream.
+     */
+    void             (*ReleaseStream)     (PackStream* stream);
+};
+
+
+extern struct APack APack[1];
+
+
+/**
+ * The hash of asset path in pack file, it is FNV-1a.
+ * this is a part of pack file layout, so it is separate from AHashStrMap->GetHash.
+ */
+static inline uint32_t APack_GetHash(const char* path)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*path != '\0')
+    {
+        hash ^= (uint8_t) *path++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+
+#endif
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "Engine/Toolkit/Utils/Pool.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+#define GetSlot(slab, index) \
+    ((PoolSlot*) ((slab) + pool->slotSize * (index)))
+
+
+#define GetElement(slot) \
+    ((void*) ((char*) (slot) + APool_ElementOffset))
+
+
+static void AddSlab(Pool* pool, int length)
+{
+    PoolSlab poolSlab[1] = {{malloc((size_t) (pool->slotSize * length)), length}};
+    char*    slab        = poolSlab->data;
+
+    ALog_A
+    (
+        slab != NULL,
+        "APool AddSlab failed, unable to malloc memory, slotSize = %d, length = %d",
+        pool->slotSize,
+        length
+    );
+
+    AArrayList->Add(pool->slabList, poolSlab);
+
+    // link slots in address order, so the continuous Get is in order
+    for (int i = 0; i < length - 1; ++i)
+    {
+        GetSlot(slab, i)->next = GetSlot(slab, i + 1);
+    }
+
+    GetSlot(slab, length - 1)->next = pool->freeSlot;
+    pool->freeSlot                  = GetSlot(slab, 0);
+
+    if (pool->OnCreateElement != NULL)
+    {
+        for (int i = 0; i < length; ++i)
+        {
+            pool->OnCreateElement(GetElement(GetSlot(slab, i)));
+        }
+    }
+
+    pool->count += length;
+}
+
+
+static void* Get(Pool* pool)
+{
+    if (pool->freeSlot == NULL)
+    {
+        int length = pool->slabLength;
+
+        if (pool->maxCount > 0)
+        {
+            if (pool->count >= pool->maxCount)
+            {
+                switch (pool->fullPolicy)
+                {
+                    case PoolFullPolicy_Grow:
+                        ALog_W("APool Get over maxCount = %d, count = %d", pool->maxCount, pool->count);
+                        break;
+
+                    case PoolFullPolicy_ReturnNull:
+                        return NULL;
+
+                    case PoolFullPolicy_Assert:
+                        ALog_A(false, "APool Get failed, reach maxCount = %d", pool->maxCount);
+                        break;
+                }
+            }
+            else if (pool->count + length > pool->maxCount)
+            {
+                // not over maxCount
+                length = pool->maxCount - pool->count;
+            }
+        }
+
+        AddSlab(pool, length);
+    }
+
+    PoolSlot* slot = pool->freeSlot;
+    pool->freeSlot = slot->next;
+    // mark in using
+    slot->next     = slot;
+
+    if (++pool->liveCount > pool->peakCount)
+    {
+        pool->peakCount = pool->liveCount;
+    }
+
+    return GetElement(slot);
+}
+
+
+static void Free(Pool* pool, void* element)
+{
+    PoolSlot* slot = (PoolSlot*) ((char*) element - APool_ElementOffset);
+
+    ALog_A(slot->next == slot, "APool Free element %p is not in using", element);
+
+    slot->next     = pool->freeSlot;
+    pool->freeSlot = slot;
+
+    --pool->liveCount;
+}
+
+
+static void Prewarm(Pool* pool, int count)
+{
+    if (count > pool->count)
+    {
+        AddSlab(pool, count - pool->count);
+    }
+}
+
+
+static void LogStats(Pool* pool, const char* tag)
+{
+    ALog_D
+    (
+        "APool %s count = %d, liveCount = %d, peakCount = %d, slabs = %d",
+        tag,
+        pool->count,
+        pool->liveCount,
+        pool->peakCount,
+        pool->slabList->size
+    );
+}
+
+
+static void Release(Pool* pool)
+{
+    for (int i = 0; i < pool->slabList->size; ++i)
+    {
+        PoolSlab* poolSlab = AArrayList_GetPtr(pool->slabList, i, PoolSlab);
+
+        if (pool->OnReleaseElement != NULL)
+        {
+            for (int j = 0; j < poolSlab->length; ++j)
+            {
+                pool->OnReleaseElement(GetElement(GetSlot(poolSlab->data, j)));
+            }
+        }
+
+        free(poolSlab->data);
+    }
+
+    AArrayList->Release(pool->slabList);
+
+    pool->freeSlot  = NULL;
+    pool->count     = 0;
+    pool->liveCount = 0;
+    pool->peakCount = 0;
+}
+
+
+static void Init(int elementTypeSize, int slabLength, Pool* outPool)
+{
+    ALog_A(slabLength > 0, "APool Init failed, slabLength = %d cannot <= 0", slabLength);
+
+    AArrayList->Init(sizeof(PoolSlab), outPool->slabList);
+    outPool->slabList->increase = 4;
+
+    outPool->elementTypeSize    = elementTypeSize;
+    outPool->slotSize           = APool_GetSlotSize(elementTypeSize);
+    outPool->slabLength         = slabLength;
+    outPool->maxCount           = 0;
+    outPool->fullPolicy         = PoolFullPolicy_Grow;
+    outPool->OnCreateElement    = NULL;
+    outPool->OnReleaseElement   = NULL;
+    outPool->freeSlot           = NULL;
+    outPool->count              = 0;
+    outPool->liveCount          = 0;
+    outPool->peakCount          = 0;
+}
+
+
+static Pool* Create(int elementTypeSize, int slabLength)
+{
+    Pool* pool = malloc(sizeof(Pool));
+    Init(elementTypeSize, slabLength, pool);
+
+    return pool;
+}
+
+
+struct APool APool[1] =
+{{
+    Create,
+    Init,
+    Release,
+    Get,
+    Free,
+    Prewarm,
+    LogStats,
+}};
+
+
+#undef GetSlot
+#undef GetElement
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef POOL_H
+#define POOL_H
+
+
+#include "Engine/Toolkit/Utils/ArrayList.h"
+
+
+/**
+ * What to do when Pool has no free element and reach the maxCount.
+ */
+typedef enum
+{
+    /**
+     * Continue to create new slab, and log warning.
+     */
+    PoolFullPolicy_Grow,
+
+    /**
+     * Get return NULL.
+     */
+    PoolFullPolicy_ReturnNull,
+
+    /**
+     * Assert failed.
+     */
+    PoolFullPolicy_Assert,
+}
+PoolFullPolicy;
+
+
+/**
+ * The header before each element in slab.
+ */
+typedef struct PoolSlot PoolSlot;
+struct  PoolSlot
+{
+    /**
+     * The next free slot when free, or point to self when element in using.
+     */
+    PoolSlot* next;
+};
+
+
+/**
+ * One contiguous memory of slots.
+ */
+typedef struct
+{
+    char* data;
+
+    /**
+     * The count of slots.
+     */
+    int   length;
+}
+PoolSlab;
+
+
+/**
+ * The elements are created in contiguous slabs, and the free elements are linked by slot header in slab.
+ * the element data keep unchanged after free, so the reused element can reuse its inner memory.
+ */
+typedef struct
+{
+    /**
+     * The sizeof element type.
+     */
+    int                 elementTypeSize;
+
+    /**
+     * The sizeof PoolSlot header with element.
+     */
+    int                 slotSize;
+
+    /**
+     * The element count of each new slab.
+     */
+    int                 slabLength;
+
+    /**
+     * The max count of elements, 0 means no limit.
+     */
+    int                 maxCount;
+
+    /**
+     * What to do when reach maxCount, default PoolFullPolicy_Grow.
+     */
+    PoolFullPolicy      fullPolicy;
+
+    /**
+     * If not NULL, called only once for each element when its slab created.
+     */
+    void (*OnCreateElement) (void* element);
+
+    /**
+     * If not NULL, called for each element when Pool Release.
+     */
+    void (*OnReleaseElement)(void* element);
+
+    /**
+     * All slabs memory.
+     */
+    ArrayList(PoolSlab) slabList[1];
+
+    /**
+     * The first free slot.
+     */
+    PoolSlot*           freeSlot;
+
+    /**
+     * The count of all elements in slabs.
+     */
+    int                 count;
+
+    /**
+     * The count of elements in using.
+     */
+    int                 liveCount;
+
+    /**
+     * The max liveCount in history.
+     */
+    int                 peakCount;
+}
+Pool;
+
+
+/**
+ * Control Pool.
+ */
+struct APool
+{
+    Pool* (*Create)  (int elementTypeSize, int slabLength);
+    void  (*Init)    (int elementTypeSize, int slabLength, Pool* outPool);
+
+    /**
+     * Free all slabs memory, the elements in using will be invalid.
+     */
+    void  (*Release) (Pool* pool);
+
+    /**
+     * Get a free element, if no free element will create new slab.
+     * the element data is created by OnCreateElement or left by last using.
+     *
+     * if reach maxCount and fullPolicy is PoolFullPolicy_ReturnNull
+     *     return NULL
+     * else
+     *     return element
+     */
+    void* (*Get)     (Pool* pool);
+
+    /**
+     * Free element that get from Pool.
+     */
+    void  (*Free)    (Pool* pool, void* element);
+
+    /**
+     * Make sure Pool has count elements at least.
+     */
+    void  (*Prewarm) (Pool* pool, int count);
+
+    /**
+     * Log Pool count, liveCount and peakCount.
+     */
+    void  (*LogStats)(Pool* pool, const char* tag);
+};
+
+
+extern struct APool APool[1];
+
+
+/**
+ * The offset of element from PoolSlot header, keep element 8 bytes aligned.
+ */
+#define APool_ElementOffset \
+    ((int) ((sizeof(PoolSlot) + 7) & ~(size_t) 7))
+
+
+/**
+ * The size of one slot in slab.
+ */
+#define APool_GetSlotSize(elementTypeSize) \
+    ((APool_ElementOffset + (int) (elementTypeSize) + 7) & ~7)
+
+
+/**
+ * Marked Pool element type.
+ */
+#define Pool(ElementType) Pool
+
+
+/**
+ * Init constant Pool.
+ * example: Pool pool[1] = APool_Init(ElementType, slabLength, OnCreateElement, OnReleaseElement)
+ */
+#define APool_Init(ElementType, slabLength, OnCreateElement, OnReleaseElement) \
+    {                                                                          \
+        sizeof(ElementType),                                                   \
+        APool_GetSlotSize(sizeof(ElementType)),                                \
+        slabLength,                                                            \
+        0,                                                                     \
+        PoolFullPolicy_Grow,                                                   \
+        OnCreateElement,                                                       \
+        OnReleaseElement,                                                      \
+        {AArrayList_Init(PoolSlab, 4)},                                        \
+        NULL,                                                                  \
+        0,                                                                     \
+        0,                                                                     \
+        0,                                                                     \
+    }
+
+
+/**
+ * Shortcut of APool->Get with type.
+ * return elementPtr.
+ */
+#define APool_Get(pool, ElementType) \
+    ((ElementType*) APool->Get(pool))
+
+
+#endif
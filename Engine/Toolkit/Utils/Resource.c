@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#include <stddef.h>
+#include "Engine/Toolkit/Utils/Resource.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+/**
+ * The resources of one class.
+ */
+typedef struct
+{
+    long         budgetBytes;
+    long         residentBytes;
+
+    /**
+     * The most recently released unused resource.
+     */
+    ResourceRef* unusedHead;
+
+    /**
+     * The least recently released unused resource, evicted first.
+     */
+    ResourceRef* unusedTail;
+}
+ResourceClassData;
+
+
+static ResourceClassData classDataArr[ResourceClass_Length] =
+{
+    [ResourceClass_Texture]      = {64 * 1024 * 1024, 0, NULL, NULL},
+    [ResourceClass_TextureAtlas] = {1  * 1024 * 1024, 0, NULL, NULL},
+    [ResourceClass_SkeletonData] = {16 * 1024 * 1024, 0, NULL, NULL},
+    [ResourceClass_Font]         = {1  * 1024 * 1024, 0, NULL, NULL},
+    [ResourceClass_DrawAtlas]    = {1  * 1024 * 1024, 0, NULL, NULL},
+};
+
+
+static inline void UnlinkUnused(ResourceRef* ref)
+{
+    ResourceClassData* classData = classDataArr + ref->resourceClass;
+
+    if (ref->prev != NULL)
+    {
+        ref->prev->next = ref->next;
+    }
+    else
+    {
+        classData->unusedHead = ref->next;
+    }
+
+    if (ref->next != NULL)
+    {
+        ref->next->prev = ref->prev;
+    }
+    else
+    {
+        classData->unusedTail = ref->prev;
+    }
+
+    ref->prev = NULL;
+    ref->next = NULL;
+}
+
+
+/**
+ * Evict the least recently released unused resources until resident bytes not over budget.
+ */
+static void Trim(ResourceClass resourceClass, long budgetBytes)
+{
+    ResourceClassData* classData = classDataArr + resourceClass;
+
+    while (classData->residentBytes > budgetBytes && classData->unusedTail != NULL)
+    {
+        ResourceRef* ref = classData->unusedTail;
+
+        UnlinkUnused(ref);
+        classData->residentBytes -= ref->bytes;
+
+        // the Evict may release other resources, so the unused list changed
+        ref->Evict(ref);
+    }
+}
+
+
+static void Add(ResourceClass resourceClass, long bytes, ResourceEvict Evict, ResourceRef* outRef)
+{
+    outRef->refCount      = 1;
+    outRef->bytes         = bytes;
+    outRef->resourceClass = resourceClass;
+    outRef->Evict         = Evict;
+    outRef->prev          = NULL;
+    outRef->next          = NULL;
+
+    classDataArr[resourceClass].residentBytes += bytes;
+    Trim(resourceClass, classDataArr[resourceClass].budgetBytes);
+}
+
+
+static void Remove(ResourceRef* ref)
+{
+    if (ref->refCount == 0)
+    {
+        UnlinkUnused(ref);
+    }
+
+    classDataArr[ref->resourceClass].residentBytes -= ref->bytes;
+}
+
+
+static void Retain(ResourceRef* ref)
+{
+    if (ref->refCount == 0)
+    {
+        UnlinkUnused(ref);
+    }
+
+    ++ref->refCount;
+}
+
+
+static void Release(ResourceRef* ref)
+{
+    ALog_A(ref->refCount > 0, "AResource Release ref %p refCount already zero", ref);
+
+    if (--ref->refCount == 0)
+    {
+        ResourceClassData* classData = classDataArr + ref->resourceClass;
+
+        ref->next = classData->unusedHead;
+
+        if (classData->unusedHead != NULL)
+        {
+            classData->unusedHead->prev = ref;
+        }
+        else
+        {
+            classData->unusedTail = ref;
+        }
+
+        classData->unusedHead = ref;
+
+        Trim(ref->resourceClass, classData->budgetBytes);
+    }
+}
+
+
+static void SetBytes(ResourceRef* ref, long bytes)
+{
+    classDataArr[ref->resourceClass].residentBytes += bytes - ref->bytes;
+    ref->bytes                                       = bytes;
+
+    Trim(ref->resourceClass, classDataArr[ref->resourceClass].budgetBytes);
+}
+
+
+static void SetBudget(ResourceClass resourceClass, long budgetBytes)
+{
+    classDataArr[resourceClass].budgetBytes = budgetBytes;
+    Trim(resourceClass, budgetBytes);
+}
+
+
+static long GetBudget(ResourceClass resourceClass)
+{
+    return classDataArr[resourceClass].budgetBytes;
+}
+
+
+static long GetResidentBytes(ResourceClass resourceClass)
+{
+    return classDataArr[resourceClass].residentBytes;
+}
+
+
+static void EvictUnused(ResourceClass resourceClass)
+{
+    Trim(resourceClass, -1);
+}
+
+
+struct AResource AResource[1] =
+{{
+    Add,
+    Remove,
+    Retain,
+    Release,
+    SetBytes,
+    SetBudget,
+    GetBudget,
+    GetResidentBytes,
+    EvictUnused,
+}};
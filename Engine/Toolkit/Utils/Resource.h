@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+
+
+#ifndef RESOURCE_H
+#define RESOURCE_H
+
+
+/**
+ * The class of cached resource, each class has its own memory budget.
+ */
+typedef enum
+{
+    ResourceClass_Texture,
+    ResourceClass_TextureAtlas,
+    ResourceClass_SkeletonData,
+    ResourceClass_Font,
+    ResourceClass_DrawAtlas,
+    ResourceClass_Length,
+}
+ResourceClass;
+
+
+typedef struct ResourceRef ResourceRef;
+
+
+/**
+ * Free the resource of ref that evicted, and the ref has been removed from AResource.
+ */
+typedef void (*ResourceEvict)(ResourceRef* ref);
+
+
+/**
+ * The reference count and memory bytes of cached resource, it is a member of resource.
+ */
+struct ResourceRef
+{
+    /**
+     * The count of users, zero means the resource is unused and can be evicted.
+     */
+    int           refCount;
+
+    /**
+     * The memory bytes of resource.
+     */
+    long          bytes;
+
+    ResourceClass resourceClass;
+
+    ResourceEvict Evict;
+
+    /**
+     * The links in unused list of class when refCount is zero, the prev one is released later.
+     */
+    ResourceRef*  prev;
+    ResourceRef*  next;
+};
+
+
+/**
+ * Track the references and memory bytes of cached resources by class.
+ * when resident bytes of class over budget, the unused resources are evicted least recently released first,
+ * and the resources in use are never evicted.
+ *
+ * important: it is not thread safe, and only used in main thread same as resource caches.
+ */
+struct AResource
+{
+    /**
+     * Add resource into class with refCount 1, and evict unused resources if over budget.
+     */
+    void (*Add)             (ResourceClass resourceClass, long bytes, ResourceEvict Evict, ResourceRef* outRef);
+
+    /**
+     * Remove resource from class without Evict, when resource is destroyed by its owner.
+     */
+    void (*Remove)          (ResourceRef* ref);
+
+    /**
+     * Increase refCount.
+     */
+    void (*Retain)          (ResourceRef* ref);
+
+    /**
+     * Decrease refCount, when refCount is zero the resource becomes unused,
+     * and evict unused resources if over budget.
+     */
+    void (*Release)         (ResourceRef* ref);
+
+    /**
+     * Change the memory bytes of resource, and evict unused resources if over budget.
+     */
+    void (*SetBytes)        (ResourceRef* ref, long bytes);
+
+    /**
+     * Set the max resident bytes of class, and evict unused resources if over budget.
+     */
+    void (*SetBudget)       (ResourceClass resourceClass, long budgetBytes);
+    long (*GetBudget)       (ResourceClass resourceClass);
+
+    /**
+     * Get the memory bytes of all resources of class, include unused ones.
+     */
+    long (*GetResidentBytes)(ResourceClass resourceClass);
+
+    /**
+     * Evict all unused resources of class, such as when low memory.
+     */
+    void (*EvictUnused)     (ResourceClass resourceClass);
+};
+
+
+extern struct AResource AResource[1];
+
+
+#endif
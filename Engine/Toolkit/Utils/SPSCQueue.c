@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "Engine/Toolkit/Utils/SPSCQueue.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+#define GetElementPtr(spscQueue, index) \
+    ((spscQueue)->data + (spscQueue)->elementTypeSize * (int) ((index) & (spscQueue)->mask))
+
+
+/**
+ * Get free count for producer, reload headIndex only when the cached one is not enough.
+ */
+static inline unsigned int GetFreeCount(SPSCQueue* spscQueue, unsigned int tailIndex, unsigned int needCount)
+{
+    unsigned int capacity  = spscQueue->mask + 1;
+    unsigned int freeCount = capacity - (tailIndex - spscQueue->cachedHeadIndex);
+
+    if (freeCount < needCount)
+    {
+        spscQueue->cachedHeadIndex = atomic_load_explicit(&spscQueue->headIndex, memory_order_acquire);
+        freeCount                  = capacity - (tailIndex - spscQueue->cachedHeadIndex);
+    }
+
+    return freeCount;
+}
+
+
+/**
+ * Get element count for consumer, reload tailIndex only when the cached one is not enough.
+ */
+static inline unsigned int GetUsedCount(SPSCQueue* spscQueue, unsigned int headIndex, unsigned int needCount)
+{
+    unsigned int usedCount = spscQueue->cachedTailIndex - headIndex;
+
+    if (usedCount < needCount)
+    {
+        spscQueue->cachedTailIndex = atomic_load_explicit(&spscQueue->tailIndex, memory_order_acquire);
+        usedCount                  = spscQueue->cachedTailIndex - headIndex;
+    }
+
+    return usedCount;
+}
+
+
+/**
+ * Copy count elements between circular data and elementArr, split into two parts when wrapped.
+ */
+static inline void CopyElements(SPSCQueue* spscQueue, unsigned int index, char* elementArr, int count, bool isToQueue)
+{
+    int          elementTypeSize = spscQueue->elementTypeSize;
+    unsigned int fromIndex       = index & spscQueue->mask;
+    int          firstCount      = (int) (spscQueue->mask + 1 - fromIndex);
+
+    if (firstCount > count)
+    {
+        firstCount = count;
+    }
+
+    char* queuePtr = spscQueue->data + elementTypeSize * (int) fromIndex;
+
+    if (isToQueue)
+    {
+        memcpy(queuePtr,        elementArr,                                (size_t) (firstCount * elementTypeSize));
+        memcpy(spscQueue->data, elementArr + firstCount * elementTypeSize, (size_t) ((count - firstCount) * elementTypeSize));
+    }
+    else
+    {
+        memcpy(elementArr,                                queuePtr,        (size_t) (firstCount * elementTypeSize));
+        memcpy(elementArr + firstCount * elementTypeSize, spscQueue->data, (size_t) ((count - firstCount) * elementTypeSize));
+    }
+}
+
+
+static bool Push(SPSCQueue* spscQueue, void* elementPtr)
+{
+    unsigned int tailIndex = atomic_load_explicit(&spscQueue->tailIndex, memory_order_relaxed);
+
+    if (GetFreeCount(spscQueue, tailIndex, 1) == 0)
+    {
+        return false;
+    }
+
+    memcpy(GetElementPtr(spscQueue, tailIndex), elementPtr, (size_t) spscQueue->elementTypeSize);
+    atomic_store_explicit(&spscQueue->tailIndex, tailIndex + 1, memory_order_release);
+
+    return true;
+}
+
+
+static bool Pop(SPSCQueue* spscQueue, void* outElementPtr)
+{
+    unsigned int headIndex = atomic_load_explicit(&spscQueue->headIndex, memory_order_relaxed);
+
+    if (GetUsedCount(spscQueue, headIndex, 1) == 0)
+    {
+        return false;
+    }
+
+    memcpy(outElementPtr, GetElementPtr(spscQueue, headIndex), (size_t) spscQueue->elementTypeSize);
+    atomic_store_explicit(&spscQueue->headIndex, headIndex + 1, memory_order_release);
+
+    return true;
+}
+
+
+static int PushBatch(SPSCQueue* spscQueue, void* elementArr, int count)
+{
+    unsigned int tailIndex = atomic_load_explicit(&spscQueue->tailIndex, memory_order_relaxed);
+    unsigned int freeCount = GetFreeCount(spscQueue, tailIndex, (unsigned int) count);
+
+    if ((unsigned int) count > freeCount)
+    {
+        count = (int) freeCount;
+    }
+
+    if (count > 0)
+    {
+        CopyElements(spscQueue, tailIndex, elementArr, count, true);
+        atomic_store_explicit(&spscQueue->tailIndex, tailIndex + (unsigned int) count, memory_order_release);
+    }
+
+    return count;
+}
+
+
+static int PopBatch(SPSCQueue* spscQueue, void* outElementArr, int maxCount)
+{
+    unsigned int headIndex = atomic_load_explicit(&spscQueue->headIndex, memory_order_relaxed);
+    unsigned int usedCount = GetUsedCount(spscQueue, headIndex, (unsigned int) maxCount);
+
+    if ((unsigned int) maxCount > usedCount)
+    {
+        maxCount = (int) usedCount;
+    }
+
+    if (maxCount > 0)
+    {
+        CopyElements(spscQueue, headIndex, outElementArr, maxCount, false);
+        atomic_store_explicit(&spscQueue->headIndex, headIndex + (unsigned int) maxCount, memory_order_release);
+    }
+
+    return maxCount;
+}
+
+
+static int Drain(SPSCQueue* spscQueue, int maxCount, void (*OnElement)(void* elementPtr, void* context), void* context)
+{
+    unsigned int headIndex = atomic_load_explicit(&spscQueue->headIndex, memory_order_relaxed);
+    unsigned int usedCount = GetUsedCount(spscQueue, headIndex, (unsigned int) maxCount);
+
+    if ((unsigned int) maxCount > usedCount)
+    {
+        maxCount = (int) usedCount;
+    }
+
+    // elements are used in place, and the slots are given back to producer after all done
+    for (int i = 0; i < maxCount; ++i)
+    {
+        OnElement(GetElementPtr(spscQueue, headIndex + (unsigned int) i), context);
+    }
+
+    if (maxCount > 0)
+    {
+        atomic_store_explicit(&spscQueue->headIndex, headIndex + (unsigned int) maxCount, memory_order_release);
+    }
+
+    return maxCount;
+}
+
+
+static int GetSize(SPSCQueue* spscQueue)
+{
+    unsigned int headIndex = atomic_load_explicit(&spscQueue->headIndex, memory_order_acquire);
+    unsigned int tailIndex = atomic_load_explicit(&spscQueue->tailIndex, memory_order_acquire);
+
+    return (int) (tailIndex - headIndex);
+}
+
+
+static void Init(int elementTypeSize, int capacity, SPSCQueue* outSPSCQueue)
+{
+    ALog_A(capacity > 0, "ASPSCQueue Init capacity = %d, must greater than 0", capacity);
+
+    unsigned int length = 2;
+
+    while (length < (unsigned int) capacity)
+    {
+        length <<= 1;
+    }
+
+    outSPSCQueue->elementTypeSize = elementTypeSize;
+    outSPSCQueue->mask            = length - 1;
+    outSPSCQueue->data            = malloc((size_t) elementTypeSize * length);
+    outSPSCQueue->cachedTailIndex = 0;
+    outSPSCQueue->cachedHeadIndex = 0;
+
+    ALog_A
+    (
+        outSPSCQueue->data != NULL,
+        "ASPSCQueue Init failed, unable to malloc memory, size = %d, length = %u",
+        elementTypeSize * (int) length, length
+    );
+
+    atomic_init(&outSPSCQueue->headIndex, 0);
+    atomic_init(&outSPSCQueue->tailIndex, 0);
+}
+
+
+static SPSCQueue* Create(int elementTypeSize, int capacity)
+{
+    SPSCQueue* spscQueue = malloc(sizeof(SPSCQueue));
+    Init(elementTypeSize, capacity, spscQueue);
+
+    return spscQueue;
+}
+
+
+static void Release(SPSCQueue* spscQueue)
+{
+    free(spscQueue->data);
+    spscQueue->data = NULL;
+}
+
+
+struct ASPSCQueue ASPSCQueue[1] =
+{{
+    Create,
+    Init,
+    Release,
+    Push,
+    Pop,
+    PushBatch,
+    PopBatch,
+    Drain,
+    GetSize,
+}};
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+
+/**
+ * The bytes of cache line, used to separate the data written by different threads.
+ */
+#define SPSCQueue_CacheLineSize 64
+
+
+/**
+ * The bounded lock-free queue for one producer thread and one consumer thread.
+ * elements are copied into a circular array, the capacity is power of 2.
+ */
+typedef struct
+{
+    int          elementTypeSize;
+
+    /**
+     * The capacity - 1.
+     */
+    unsigned int mask;
+
+    /**
+     * Elements memory space.
+     */
+    char*        data;
+
+    char         padding0[SPSCQueue_CacheLineSize];
+
+    /**
+     * The next index to pop, only written by consumer.
+     */
+    atomic_uint  headIndex;
+
+    /**
+     * The tailIndex last seen by consumer, only used by consumer.
+     */
+    unsigned int cachedTailIndex;
+
+    char         padding1[SPSCQueue_CacheLineSize];
+
+    /**
+     * The next index to push, only written by producer.
+     */
+    atomic_uint  tailIndex;
+
+    /**
+     * The headIndex last seen by producer, only used by producer.
+     */
+    unsigned int cachedHeadIndex;
+
+    char         padding2[SPSCQueue_CacheLineSize];
+}
+SPSCQueue;
+
+
+/**
+ * Control SPSCQueue.
+ * Push functions must be called by only one producer thread,
+ * and Pop functions must be called by only one consumer thread.
+ */
+struct ASPSCQueue
+{
+    /**
+     * The capacity will be rounded up to power of 2.
+     */
+    SPSCQueue* (*Create)   (int elementTypeSize, int capacity);
+    void       (*Init)     (int elementTypeSize, int capacity, SPSCQueue* outSPSCQueue);
+    void       (*Release)  (SPSCQueue* spscQueue);
+
+    /**
+     * Copy element from elementPtr into the tail of SPSCQueue.
+     * return false if SPSCQueue is full.
+     */
+    bool       (*Push)     (SPSCQueue* spscQueue, void* elementPtr);
+
+    /**
+     * Copy top element into outElementPtr.
+     * return false if SPSCQueue is empty.
+     */
+    bool       (*Pop)      (SPSCQueue* spscQueue, void* outElementPtr);
+
+    /**
+     * Copy count elements from elementArr into SPSCQueue, and publish them at once.
+     * return the count of pushed elements, less than count when SPSCQueue is full.
+     */
+    int        (*PushBatch)(SPSCQueue* spscQueue, void* elementArr, int count);
+
+    /**
+     * Copy maxCount elements at most into outElementArr.
+     * return the count of popped elements.
+     */
+    int        (*PopBatch) (SPSCQueue* spscQueue, void* outElementArr, int maxCount);
+
+    /**
+     * Pop maxCount elements at most and pass each one to OnElement in queue order,
+     * the elementPtr is only valid in OnElement. Usually called by main thread every frame.
+     *
+     * return the count of popped elements.
+     */
+    int        (*Drain)    (SPSCQueue* spscQueue, int maxCount, void (*OnElement)(void* elementPtr, void* context), void* context);
+
+    /**
+     * Get the count of elements, the result may be out of date when returned.
+     */
+    int        (*GetSize)  (SPSCQueue* spscQueue);
+};
+
+
+extern struct ASPSCQueue ASPSCQueue[1];
+
+
+/**
+ * Marked SPSCQueue element type.
+ */
+#define SPSCQueue(ElementType) SPSCQueue
+
+
+/**
+ * Shortcut of ASPSCQueue->Push.
+ */
+#define ASPSCQueue_Push(spscQueue, element) \
+    ASPSCQueue->Push(spscQueue, &(element))
+
+
+/**
+ * Shortcut of ASPSCQueue->Pop.
+ */
+#define ASPSCQueue_Pop(spscQueue, outElement) \
+    ASPSCQueue->Pop(spscQueue, &(outElement))
+
+
+#endif
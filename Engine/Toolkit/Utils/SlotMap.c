@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#include <stdlib.h>
+#include "Engine/Toolkit/Utils/SlotMap.h"
+#include "Engine/Toolkit/Platform/Log.h"
+
+
+#define GetSlot(slotMap, slotIndex) \
+    AArrayList_GetPtr((slotMap)->slotList, slotIndex, SlotMapSlot)
+
+
+/**
+ * Get the slot of handle, if handle is invalid return NULL.
+ */
+static inline SlotMapSlot* GetHandleSlot(SlotMap* slotMap, SlotMapHandle handle)
+{
+    int slotIndex = (int) (handle & SlotMap_IndexMask);
+
+    if (slotIndex < slotMap->slotList->size)
+    {
+        SlotMapSlot* slot = GetSlot(slotMap, slotIndex);
+
+        if (slot->generation == handle >> SlotMap_IndexBits)
+        {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * Free slot at slotIndex into free list, and make its handles invalid.
+ */
+static inline void FreeSlot(SlotMap* slotMap, int slotIndex)
+{
+    SlotMapSlot* slot = GetSlot(slotMap, slotIndex);
+
+    if (slot->generation == SlotMap_GenerationMax)
+    {
+        slot->generation = 1;
+    }
+    else
+    {
+        ++slot->generation;
+    }
+
+    slot->index            = slotMap->freeSlotIndex;
+    slotMap->freeSlotIndex = slotIndex;
+}
+
+
+static SlotMapHandle Add(SlotMap* slotMap, void* elementPtr)
+{
+    int slotIndex = slotMap->freeSlotIndex;
+
+    if (slotIndex == -1)
+    {
+        slotIndex = slotMap->slotList->size;
+
+        ALog_A
+        (
+            (uint32_t) slotIndex <= SlotMap_IndexMask,
+            "ASlotMap Add failed, the slot count cannot more than %u",
+            SlotMap_IndexMask + 1
+        );
+
+        SlotMapSlot* slot = AArrayList_GetPtrAdd(slotMap->slotList, SlotMapSlot);
+        slot->generation  = 1;
+        slot->index       = slotMap->elementList->size;
+    }
+    else
+    {
+        SlotMapSlot* slot      = GetSlot(slotMap, slotIndex);
+        slotMap->freeSlotIndex = slot->index;
+        slot->index            = slotMap->elementList->size;
+    }
+
+    AArrayList->Add(slotMap->elementList,   elementPtr);
+    AArrayList_Add (slotMap->slotIndexList, slotIndex);
+
+    return (GetSlot(slotMap, slotIndex)->generation << SlotMap_IndexBits) | (uint32_t) slotIndex;
+}
+
+
+static void* Get(SlotMap* slotMap, SlotMapHandle handle)
+{
+    SlotMapSlot* slot = GetHandleSlot(slotMap, handle);
+
+    if (slot == NULL)
+    {
+        return NULL;
+    }
+
+    return (char*) slotMap->elementList->elementArr->data + slotMap->elementList->elementTypeSize * slot->index;
+}
+
+
+static void RemoveAt(SlotMap* slotMap, int index)
+{
+    int lastIndex = slotMap->elementList->size - 1;
+
+    ALog_A
+    (
+        index >= 0 && index <= lastIndex,
+        "ASlotMap RemoveAt index = %d, out of range [0, %d]",
+        index, lastIndex
+    );
+
+    FreeSlot(slotMap, AArrayList_Get(slotMap->slotIndexList, index, int));
+
+    if (index != lastIndex)
+    {
+        // the last element moved to index, so its slot points to index
+        int lastSlotIndex                      = AArrayList_Get(slotMap->slotIndexList, lastIndex, int);
+        GetSlot(slotMap, lastSlotIndex)->index = index;
+    }
+
+    AArrayList->RemoveByLast(slotMap->elementList,   index);
+    AArrayList->RemoveByLast(slotMap->slotIndexList, index);
+}
+
+
+static bool TryRemove(SlotMap* slotMap, SlotMapHandle handle)
+{
+    SlotMapSlot* slot = GetHandleSlot(slotMap, handle);
+
+    if (slot == NULL)
+    {
+        return false;
+    }
+
+    RemoveAt(slotMap, slot->index);
+
+    return true;
+}
+
+
+static SlotMapHandle GetHandleAt(SlotMap* slotMap, int index)
+{
+    int slotIndex = AArrayList_Get(slotMap->slotIndexList, index, int);
+    return (GetSlot(slotMap, slotIndex)->generation << SlotMap_IndexBits) | (uint32_t) slotIndex;
+}
+
+
+static void Clear(SlotMap* slotMap)
+{
+    for (int i = 0; i < slotMap->slotIndexList->size; ++i)
+    {
+        FreeSlot(slotMap, AArrayList_Get(slotMap->slotIndexList, i, int));
+    }
+
+    AArrayList->Clear(slotMap->elementList);
+    AArrayList->Clear(slotMap->slotIndexList);
+}
+
+
+static void Release(SlotMap* slotMap)
+{
+    AArrayList->Release(slotMap->elementList);
+    AArrayList->Release(slotMap->slotIndexList);
+    AArrayList->Release(slotMap->slotList);
+    slotMap->freeSlotIndex = -1;
+}
+
+
+static void Init(int elementTypeSize, SlotMap* outSlotMap)
+{
+    AArrayList->Init(elementTypeSize,     outSlotMap->elementList);
+    AArrayList->Init(sizeof(int),         outSlotMap->slotIndexList);
+    AArrayList->Init(sizeof(SlotMapSlot), outSlotMap->slotList);
+    outSlotMap->freeSlotIndex = -1;
+}
+
+
+static SlotMap* Create(int elementTypeSize)
+{
+    SlotMap* slotMap = malloc(sizeof(SlotMap));
+    Init(elementTypeSize, slotMap);
+
+    return slotMap;
+}
+
+
+struct ASlotMap ASlotMap[1] =
+{{
+    Create,
+    Init,
+    Release,
+    Add,
+    Get,
+    TryRemove,
+    RemoveAt,
+    GetHandleAt,
+    Clear,
+}};
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) scott.cgi All Rights Reserved.
+ *
+ * This source code belongs to project Mojoc, which is a pure C Game Engine hosted on GitHub.
+ * The Mojoc Game Engine is licensed under the MIT License, and will continue to be iterated with coding passion.
+ *
+ * License  : https://github.com/scottcgi/Mojoc/blob/master/LICENSE
+ * GitHub   : https://github.com/scottcgi/Mojoc
+ * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
+ *
+ * Since    : 2026-10-17
+ * Update   : 2026-10-17
+ * Author   : scott.cgi
+ */
+
+
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "Engine/Toolkit/Utils/ArrayList.h"
+
+
+/**
+ * The handle of element in SlotMap,
+ * low SlotMap_IndexBits bits are slot index and high bits are generation of slot.
+ * the handle becomes invalid after its element removed, and 0 is always invalid.
+ */
+typedef uint32_t SlotMapHandle;
+
+
+/**
+ * The bits of slot index in SlotMapHandle, so SlotMap can store 2^20 elements at most.
+ */
+#define SlotMap_IndexBits 20
+
+
+/**
+ * The mask of slot index in SlotMapHandle.
+ */
+#define SlotMap_IndexMask ((1u << SlotMap_IndexBits) - 1u)
+
+
+/**
+ * The max generation of slot, the generation is in [1, SlotMap_GenerationMax].
+ */
+#define SlotMap_GenerationMax ((1u << (32 - SlotMap_IndexBits)) - 1u)
+
+
+/**
+ * The indirection from SlotMapHandle to element.
+ */
+typedef struct
+{
+    /**
+     * Increase when element removed, so the old handles of slot become invalid.
+     */
+    uint32_t generation;
+
+    /**
+     * If slot in use it is the index of element in elementList,
+     * else it is the next free slot index, -1 means no next.
+     */
+    int      index;
+}
+SlotMapSlot;
+
+
+/**
+ * The elements are packed in elementList for linear iteration,
+ * and the SlotMapHandle finds element by slot, so add, remove and get are O(1).
+ * remove moves the last element to removed index, so the order of elements may change.
+ */
+typedef struct
+{
+    /**
+     * The first free slot index, -1 means no free slot.
+     */
+    int                    freeSlotIndex;
+
+    /**
+     * Store all elements packed.
+     */
+    ArrayList(ElementType) elementList  [1];
+
+    /**
+     * The slot index of each element in elementList.
+     */
+    ArrayList(int)         slotIndexList[1];
+
+    /**
+     * All slots.
+     */
+    ArrayList(SlotMapSlot) slotList     [1];
+}
+SlotMap;
+
+
+/**
+ * Control SlotMap.
+ */
+struct ASlotMap
+{
+    SlotMap*      (*Create)     (int elementTypeSize);
+    void          (*Init)       (int elementTypeSize, SlotMap* outSlotMap);
+    void          (*Release)    (SlotMap* slotMap);
+
+    /**
+     * Copy element from elementPtr into SlotMap.
+     * return the handle of element.
+     */
+    SlotMapHandle (*Add)        (SlotMap* slotMap, void* elementPtr);
+
+    /**
+     * Get elementPtr by handle.
+     * if handle is invalid return NULL.
+     */
+    void*         (*Get)        (SlotMap* slotMap, SlotMapHandle handle);
+
+    /**
+     * Remove element by handle, the last element will be moved to the removed index.
+     * return true success, false handle is invalid.
+     */
+    bool          (*TryRemove)  (SlotMap* slotMap, SlotMapHandle handle);
+
+    /**
+     * Remove element at index of elementList, the last element will be moved to the index.
+     */
+    void          (*RemoveAt)   (SlotMap* slotMap, int index);
+
+    /**
+     * Get the handle of element at index of elementList.
+     */
+    SlotMapHandle (*GetHandleAt)(SlotMap* slotMap, int index);
+
+    /**
+     * Remove all elements, and all handles become invalid.
+     */
+    void          (*Clear)      (SlotMap* slotMap);
+};
+
+
+extern struct ASlotMap ASlotMap[1];
+
+
+/**
+ * Marked SlotMap element type.
+ */
+#define SlotMap(ElementType) SlotMap
+
+
+/**
+ * Init constant SlotMap.
+ * example: SlotMap slotMap[1] = ASlotMap_Init(ElementType, increase)
+ */
+#define ASlotMap_Init(ElementType, increase)        \
+    {                                               \
+        -1,                                         \
+        AArrayList_Init(ElementType, increase),     \
+        AArrayList_Init(int,         increase),     \
+        AArrayList_Init(SlotMapSlot, increase),     \
+    }
+
+
+/**
+ * Shortcut of ASlotMap->Add.
+ */
+#define ASlotMap_Add(slotMap, element) \
+    ASlotMap->Add(slotMap, &(element))
+
+
+/**
+ * Shortcut of ASlotMap->Get.
+ * return element.
+ */
+#define ASlotMap_Get(slotMap, handle, ElementType) \
+    (*(ElementType*) ASlotMap->Get(slotMap, handle))
+
+
+/**
+ * Shortcut of ASlotMap->Get.
+ * return elementPtr, or NULL if handle is invalid.
+ */
+#define ASlotMap_GetPtr(slotMap, handle, ElementType) \
+    ((ElementType*) ASlotMap->Get(slotMap, handle))
+
+
+/**
+ * Get the element at index of elementList.
+ */
+#define ASlotMap_GetAt(slotMap, index, ElementType) \
+    AArrayList_Get((slotMap)->elementList, index, ElementType)
+
+
+#endif
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-6-8
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -19,6 +19,7 @@
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Toolkit/Utils/ArrayIntMap.h"
 #include "Engine/Toolkit/Utils/ArrayQueue.h"
+#include "Engine/Toolkit/Utils/Pool.h"
 
 
 typedef struct
@@ -41,30 +42,42 @@ typedef struct
 Tween;
 
 
-static ArrayIntMap(tweenID, Tween*) tweenRunningMap[1] = AArrayIntMap_Init(Tween*,       25);
-static ArrayList  (Tween*)          tweenCacheList [1] = AArrayList_Init  (Tween*,       25);
-static ArrayList  (TweenAction*)    actionCacheList[1] = AArrayList_Init  (TweenAction*, 25);
+static void OnCreateTween(void* element)
+{
+    Tween* tween = element;
 
+    AArrayQueue->InitWithCapacity(sizeof(TweenAction*), 8, tween->queue);
 
-static inline Tween* GetTween()
+    AArrayList->Init(sizeof(TweenAction*),  tween->current);
+    tween->current->increase = 6;
+}
+
+
+static void OnCreateAction(void* element)
 {
-    Tween* tween = AArrayList_Pop(tweenCacheList, Tween*);
+    TweenAction* action = element;
+    AArrayList->InitWithBuffer
+    (
+        sizeof(TweenActionValue),
+        action->actionValueBuffer,
+        TweenAction_ValueBufferLength,
+        action->actionValueList
+    );
+    action->actionValueList->increase = 6;
+}
 
-    if (tween == NULL)
-    {
-        tween = malloc(sizeof(Tween));
 
-        AArrayQueue->Init(sizeof(TweenAction*), tween->queue);
-        tween->queue->elementList->increase = 6;
+static ArrayIntMap(tweenID, Tween*) tweenRunningMap[1] = AArrayIntMap_Init(Tween*,      25);
+static Pool       (Tween)           tweenPool      [1] = APool_Init       (Tween,       25, OnCreateTween,  NULL);
+static Pool       (TweenAction)     actionPool     [1] = APool_Init       (TweenAction, 25, OnCreateAction, NULL);
 
-        AArrayList->Init(sizeof(TweenAction*),  tween->current);
-        tween->current->increase            = 6;
-    }
-    else
-    {
-        AArrayQueue->Clear(tween->queue);
-        AArrayList ->Clear(tween->current);
-    }
+
+static inline Tween* GetTween()
+{
+    Tween* tween = APool_Get(tweenPool, Tween);
+
+    AArrayQueue->Clear(tween->queue);
+    AArrayList ->Clear(tween->current);
 
     tween->queueAction = NULL;
 
@@ -74,18 +87,8 @@ static inline Tween* GetTween()
 
 static TweenAction* GetAction()
 {
-    TweenAction* action = AArrayList_Pop(actionCacheList, TweenAction*);
-
-    if (action == NULL)
-    {
-        action = malloc(sizeof(TweenAction));
-        AArrayList->InitWithCapacity(sizeof(TweenActionValue), 6, action->actionValueList);
-        action->actionValueList->increase = 6;
-    }
-    else
-    {
-        AArrayList->Clear(action->actionValueList);
-    }
+    TweenAction* action = APool_Get(actionPool, TweenAction);
+    AArrayList->Clear(action->actionValueList);
 
     AUserData_Init(action->userData);
     action->curTime    = 0.0f;
@@ -205,20 +208,20 @@ static bool TryRemoveAction(void* tweenID, TweenAction* action)
                 }
 
                 AArrayList->RemoveByLast(tween->current, i);
-                AArrayList_Add(actionCacheList, action);
+                APool->Free(actionPool, action);
 
                 return true;
             }
         }
 
-        for (int i = tween->queue->topIndex; i < tween->queue->elementList->size; ++i)
+        for (int i = 0; i < tween->queue->size; ++i)
         {
-            TweenAction* tweenAction = AArrayList_Get(tween->queue->elementList, i, TweenAction*);
+            TweenAction* tweenAction = AArrayQueue_GetAt(tween->queue, i, TweenAction*);
 
             if (action == tweenAction)
             {
                 AArrayQueue->RemoveAt(tween->queue, i);
-                AArrayList_Add(actionCacheList, action);
+                APool->Free(actionPool, action);
 
                 return true;
             }
@@ -239,14 +242,14 @@ static bool TryRemoveAllActions(void* tweenID)
 
         for (int i = 0; i < tween->current->size; ++i)
         {
-            AArrayList_Add(actionCacheList, AArrayList_Get(tween->current, i, TweenAction*));
+            APool->Free(actionPool, AArrayList_Get(tween->current, i, TweenAction*));
         }
         AArrayList->Clear(tween->current);
 
         TweenAction* action;
         while ((action = AArrayQueue_Pop(tween->queue, TweenAction*)))
         {
-            AArrayList_Add(actionCacheList, action);
+            APool->Free(actionPool, action);
         }
 
         // if queueAction not NULL it must be in tweenData->current
@@ -292,7 +295,7 @@ static bool TryCompleteAllActions(void* tweenID, bool isFireOnComplete)
         {
             TweenAction* action = AArrayList_Get(tween->current, i, TweenAction*);
             SetActionComplete(action, isFireOnComplete);
-            AArrayList_Add(actionCacheList, action);
+            APool->Free(actionPool, action);
         }
         AArrayList->Clear(tween->current);
 
@@ -300,7 +303,7 @@ static bool TryCompleteAllActions(void* tweenID, bool isFireOnComplete)
         while ((action = AArrayQueue_Pop(tween->queue, TweenAction*)))
         {
             SetActionComplete(action, isFireOnComplete);
-            AArrayList_Add(actionCacheList, action);
+            APool->Free(actionPool, action);
         }
 
         // if queueAction not NULL it must be in tweenData->current
@@ -322,7 +325,7 @@ static bool HasAction(void* tweenID)
     {
         Tween* tween = AArrayIntMap_GetAt(tweenRunningMap, index, Tween*);
 
-        if (tween->current->size > 0 || tween->queue->elementList->size > 0)
+        if (tween->current->size > 0 || tween->queue->size > 0)
         {
             return true;
         }
@@ -356,8 +359,8 @@ static void Update(float deltaSeconds)
         if (tween->current->size == 0)
         {
             // all actions complete so remove tweenData and push to cache
-            AArrayList_Add        (tweenCacheList, tween);
-            AArrayIntMap->RemoveAt(tweenRunningMap,    i);
+            APool       ->Free    (tweenPool,       tween);
+            AArrayIntMap->RemoveAt(tweenRunningMap, i);
             continue;
         }
 
@@ -401,7 +404,7 @@ static void Update(float deltaSeconds)
                 }
 
                 AArrayList->RemoveByLast(tween->current, j);
-                AArrayList_Add(actionCacheList, action);
+                APool->Free(actionPool, action);
             }
         }
     }
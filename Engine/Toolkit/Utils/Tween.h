@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2016-6-8
- * Update   : 2019-1-8
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -84,6 +84,12 @@ TweenActionValue;
  */
 typedef struct TweenAction TweenAction;
 
+
+/**
+ * The length of TweenAction actionValueBuffer.
+ */
+#define TweenAction_ValueBufferLength 4
+
 /**
  * When TweenAction finished callback.
  */
@@ -119,6 +125,11 @@ struct TweenAction
      */
     ArrayList(TweenActionValue) actionValueList[1];
 
+    /**
+     * The first TweenActionValues of actionValueList store in it.
+     */
+    TweenActionValue            actionValueBuffer[TweenAction_ValueBufferLength];
+
     /**
      * When action complete callback.
      */
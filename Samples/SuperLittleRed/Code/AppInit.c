@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2013-1-20
- * Update   : 2019-2-16
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -23,12 +23,16 @@
 #include "Engine/Application/Scheduler.h"
 #include "Engine/Application/Platform/SystemInfo.h"
 #include "Engine/Extension/Font.h"
+#include "Engine/Extension/Loader.h"
+#include "Engine/Extension/TextureAtlas.h"
+#include "Engine/Extension/Spine/SkeletonData.h"
 #include "Engine/Toolkit/Utils/Coroutine.h"
 #include "Engine/Graphics/OpenGL/Camera.h"
 #include "Engine/Graphics/OpenGL/GLTool.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/OpenGL/Platform/gl3.h"
 #include "Engine/Toolkit/Utils/FileTool.h"
+#include "Engine/Toolkit/Utils/Pack.h"
 #include "Engine/Toolkit/Platform/Log.h"
 #include "Engine/Graphics/OpenGL/Sprite.h"
 
@@ -46,6 +50,7 @@
 
 
 static const char* saveDataFileName = "MojocSampleSupperLittleRed";
+static const char* packFileName     = "SuperLittleRed.pack";
 static int         progressSize     = AppInit_FunctionsCount + Enemy_KindsNum * Enemy_EachKindInitNum;
 static GLbitfield  clearBits        = GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT;
 static Font*       font;
@@ -54,6 +59,64 @@ static Scheduler*  loadingScheduler;
 static Sprite*     logoSprite;
 
 
+/**
+ * Preload by ALoader while logo showing, the InitFunctions get them from cache.
+ */
+static const char* preloadSkeletonDatas[AppInit_SkeletonsCount] =
+{
+    "Stage/Stage11",
+    "Animation/redgirl",
+    "Animation/wood",
+    "Animation/hit",
+    "UI/HUD",
+    "UI/Curtain",
+};
+
+static const char* preloadTextureAtlases[AppInit_AtlasesCount] =
+{
+    "Font/TalkChar.atlas",
+    "Font/UINumber.atlas",
+    "Texture/Drop.atlas",
+    "Texture/Arrow.atlas",
+};
+
+
+/**
+ * The references of preloaded resources, kept until the InitFunctions get them,
+ * so the unused resources in cache cannot be evicted before.
+ */
+static void* preloadedSkeletonDatas [AppInit_SkeletonsCount];
+static void* preloadedTextureAtlases[AppInit_AtlasesCount];
+
+
+static void OnPreloaded(const char* filePath, void* resource, void* param)
+{
+    *(void**) param = resource;
+}
+
+
+static void ReleasePreloaded()
+{
+    for (int i = 0; i < AppInit_SkeletonsCount; ++i)
+    {
+        if (preloadedSkeletonDatas[i] != NULL)
+        {
+            ASkeletonData->Release(preloadedSkeletonDatas[i]);
+            preloadedSkeletonDatas[i] = NULL;
+        }
+    }
+
+    for (int i = 0; i < AppInit_AtlasesCount; ++i)
+    {
+        if (preloadedTextureAtlases[i] != NULL)
+        {
+            ATextureAtlas->Release(preloadedTextureAtlases[i]);
+            preloadedTextureAtlases[i] = NULL;
+        }
+    }
+}
+
+
 typedef void (*InitFunction)(void);
 static InitFunction InitFunctions[AppInit_FunctionsCount];
 
@@ -87,6 +150,11 @@ static void LoadingRun(Coroutine* coroutine)
     ATweenTool->AddFadeTo(-1.0f, 0.8f)->RunActions(logoSprite->drawable);
     ACoroutine_YieldSeconds(0.8f);
 
+    while (ALoader->GetProgress() < 1.0f)
+    {
+        ACoroutine_YieldFrames(0);
+    }
+
     for (; progress < progressSize; ++progress)
     {
         if (progress < AppInit_FunctionsCount)
@@ -111,6 +179,9 @@ static void LoadingRun(Coroutine* coroutine)
         ACoroutine_YieldFrames(0);
     }
 
+    // the InitFunctions and enemy caches hold their own references
+    ReleasePreloaded();
+
     ACoroutine_YieldSeconds(1.0f);
     ACoroutine_End();
 
@@ -149,6 +220,10 @@ static void InitWithSavedData()
 
 static void OnReady()
 {
+    // the Android build packs all assets into one pack file,
+    // and IOS has no pack file that the assets are read from NSBundle
+    APack->Mount(packFileName);
+
     glEnable   (GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
@@ -183,6 +258,24 @@ static void OnReady()
     logoSprite = ASprite->CreateWithFile("Texture/Logo.png");
     ADrawable_SetOpacity(logoSprite->drawable, 0.0f);
 
+    // the map is used first
+    for (int i = 0; i < AppInit_SkeletonsCount; ++i)
+    {
+        ALoader->Load
+        (
+            LoaderType_SkeletonData,
+            preloadSkeletonDatas[i],
+            i == 0 ? 1 : 0,
+            OnPreloaded,
+            preloadedSkeletonDatas + i
+        );
+    }
+
+    for (int i = 0; i < AppInit_AtlasesCount; ++i)
+    {
+        ALoader->Load(LoaderType_TextureAtlas, preloadTextureAtlases[i], 0, OnPreloaded, preloadedTextureAtlases + i);
+    }
+
     loadingScheduler = AScheduler->Schedule(LoadingUpdate, 0.0f);
     ACoroutine->StartCoroutine(LoadingRun);
 
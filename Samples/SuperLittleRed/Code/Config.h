@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  * 
  * Since    : 2015-4-13
- * Update   : 2019-2-16
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -37,6 +37,8 @@ enum
     Enemy_BossSpeedX       = 2,
 
     AppInit_FunctionsCount = 8,
+    AppInit_SkeletonsCount = 6,
+    AppInit_AtlasesCount   = 4,
 };
 
 
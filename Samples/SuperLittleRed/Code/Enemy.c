@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-9-29
- * Update   : 2019-2-16
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -354,7 +354,7 @@ static void Destroy(Enemy* enemy)
 
     AArrayList->Clear(enemy->arrowSet->elementList);
 
-    AArrayIntSet->TryRemove    (enemy->belongAI, (intptr_t) enemy);
+    ASlotMap->TryRemove        (enemy->belongAI, enemy->belongAIHandle);
     ATween->TryRemoveAllActions(AEnemy_GetDrawable(enemy));
     AComponent->RemoveObserver (AHero->component, enemy->component);
 
@@ -735,6 +735,7 @@ static Enemy* Create(const char* filePath, float bornX, float bornY)
     AArrayIntSet->Init(enemy->arrowSet);
 
     enemy->belongAI             = NULL;
+    enemy->belongAIHandle       = 0;
     enemy->belongAIAction       = NULL;
     enemy->attackBoxBody        = NULL;
     enemy->attackBoxDrawable    = NULL;
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-9-29
- * Update   : 2019-2-16
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -23,6 +23,7 @@
 #include "Engine/Application/Component.h"
 #include "Engine/Toolkit/Utils/Tween.h"
 #include "Engine/Toolkit/Utils/ArrayIntSet.h"
+#include "Engine/Toolkit/Utils/SlotMap.h"
 #include "Config.h"
 
 
@@ -68,7 +69,8 @@ typedef struct
     SkeletonAnimationPlayer dizzyEffect[1];
 
     ArrayIntSet(Arrow*)     arrowSet   [1];
-    ArrayIntSet(Enemy*)*    belongAI;
+    SlotMap    (Enemy*)*    belongAI;
+    SlotMapHandle           belongAIHandle;
     TweenAction*            belongAIAction;
 
     int                     hp;
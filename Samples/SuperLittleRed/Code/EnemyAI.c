@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-4-29
- * Update   : 2019-2-16
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -21,7 +21,7 @@
 #include "Engine/Toolkit/Utils/ArrayList.h"
 #include "Engine/Toolkit/Utils/TweenTool.h"
 #include "Engine/Application/Scheduler.h"
-#include "Engine/Toolkit/Utils/ArrayIntSet.h"
+#include "Engine/Toolkit/Utils/SlotMap.h"
 #include "Engine/Graphics/OpenGL/GLTool.h"
 #include "Engine/Toolkit/Platform/Log.h"
 
@@ -36,12 +36,12 @@
     (AMath_Random() > AMath_Random())
 
 
-static ArrayIntSet woodSet       [1];
+static SlotMap woodMap[1];
 
 
-static ArrayIntSet* enemySets[Enemy_KindsNum] =
+static SlotMap* enemyMaps[Enemy_KindsNum] =
 {
-    woodSet,
+    woodMap,
 };
 
 
@@ -56,11 +56,11 @@ AIResult;
 typedef AIResult (*EnemyAI)(Enemy* enemy, Drawable* enemyDrawable, Drawable* heroDrawable, float deltaX);
 
 
-static void DoEnemySetAI(ArrayIntSet* enemySet, EnemyAI enemyAI)
+static void DoEnemyMapAI(SlotMap* enemyMap, EnemyAI enemyAI)
 {
-    for (int i = 0; i < enemySet->elementList->size; ++i)
+    for (int i = 0; i < enemyMap->elementList->size; ++i)
     {
-        Enemy*    enemy         = AArrayList_Get(enemySet->elementList, i, Enemy*);
+        Enemy*    enemy         = ASlotMap_GetAt(enemyMap, i, Enemy*);
         Drawable* enemyDrawable = AEnemy_GetDrawable(enemy);
         Drawable* heroDrawable  = AHero_GetDrawable();
         float     deltaX        = enemyDrawable->positionX - ADrawable->ConvertBetweenLocalPositionX
@@ -204,7 +204,7 @@ static void DoEnemyAI(Scheduler* scheduler, float deltaSeconds)
     {
         for (int i = 0; i < Enemy_KindsNum; ++i)
         {
-            DoEnemySetAI(enemySets[i], enemyAIs[i]);
+            DoEnemyMapAI(enemyMaps[i], enemyAIs[i]);
         }
     }
 }
@@ -361,11 +361,11 @@ static void CreateEnemy(Scheduler* scheduler, float deltaSeconds)
                 kindIndex = AMath_RandomInt(0, Enemy_KindsNum - 1);
             }
 
-            float  x        = ADrawable->ConvertToLocalPositionX(AGameMap->beforeDrawable, pos);
-            Enemy* enemy    = Creates  [kindIndex](x);
-            enemy->belongAI = enemySets[kindIndex];
+            float  x              = ADrawable->ConvertToLocalPositionX(AGameMap->beforeDrawable, pos);
+            Enemy* enemy          = Creates  [kindIndex](x);
+            enemy->belongAI       = enemyMaps[kindIndex];
+            enemy->belongAIHandle = ASlotMap_Add(enemyMaps[kindIndex], enemy);
 
-            AArrayIntSet->TryAdd(enemySets[kindIndex], (intptr_t) enemy);
             ++AEnemyAI->currentEnemyNum;
             ++createNum;
 
@@ -401,7 +401,7 @@ static void Init()
 
     for (int i = 0; i < Enemy_KindsNum; ++i)
     {
-        AArrayIntSet->Init(enemySets[i]);
+        ASlotMap->Init(sizeof(Enemy*), enemyMaps[i]);
     }
 }
 
@@ -432,11 +432,11 @@ static void SetAllEnemy(int enemyStateID, float enemyMoveDis)
 
     for (int i = 0; i < Enemy_KindsNum; ++i)
     {
-        ArrayIntSet* enemySet = enemySets[i];
+        SlotMap* enemyMap = enemyMaps[i];
 
-        for (int j = 0; j < enemySet->elementList->size; ++j)
+        for (int j = 0; j < enemyMap->elementList->size; ++j)
         {
-            Enemy* enemy = AArrayList_Get(enemySet->elementList, j, Enemy*);
+            Enemy* enemy = ASlotMap_GetAt(enemyMap, j, Enemy*);
 
             if (enemy->component->curState->id >= EnemyState_Die)
             {
@@ -489,11 +489,11 @@ static void Restart()
 {
     for (int i = 0; i < Enemy_KindsNum; ++i)
     {
-        ArrayIntSet* enemySet = enemySets[i];
+        SlotMap* enemyMap = enemyMaps[i];
 
-        while (enemySet->elementList->size > 0)
+        while (enemyMap->elementList->size > 0)
         {
-            AEnemy->Destroy(AArrayList_Get(enemySet->elementList, 0, Enemy*));
+            AEnemy->Destroy(ASlotMap_GetAt(enemyMap, 0, Enemy*));
         }
     }
 
@@ -9,7 +9,7 @@
  * CodeStyle: https://github.com/scottcgi/Mojoc/wiki/Code-Style
  *
  * Since    : 2015-9-17
- * Update   : 2019-2-16
+ * Update   : 2026-10-17
  * Author   : scott.cgi
  */
 
@@ -584,7 +584,11 @@ static void Ready(Component* component, bool isMultiTouch)
         }
         else
         {
-            arrow->sprite->texture = ATexture->Get(buff);
+            // the sprite owns the reference of texture got
+            Texture* texture       = ATexture->Get(buff);
+            ATexture->Release(arrow->sprite->texture);
+            arrow->sprite->texture = texture;
+
             ADrawable_SetVisible(arrow->sprite->drawable);
             ADrawable_SetScale2 (arrow->sprite->drawable, 1.0f, 1.0f);
         }